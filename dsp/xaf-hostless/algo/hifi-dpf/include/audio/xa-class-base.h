@@ -49,6 +49,12 @@ typedef struct XACodecBase XACodecBase;
 /* ...memory buffer initialization */
 typedef XA_ERRORCODE  (*xa_codec_memtab_f)(XACodecBase *codec, WORD32 i, WORD32 type, WORD32 size, WORD32 align, UWORD32 core);
 
+/* ...memory buffer re-binding on in-place reset */
+typedef XA_ERRORCODE  (*xa_codec_reset_f)(XACodecBase *codec, WORD32 i, WORD32 type, WORD32 size, WORD32 align, UWORD32 core);
+
+/* ...port state save (restore == 0) or restore; size query with NULL buffer */
+typedef XA_ERRORCODE  (*xa_codec_snapshot_f)(XACodecBase *codec, void *buf, UWORD32 *size, UWORD32 restore);
+
 /* ...preprocessing operation */
 typedef XA_ERRORCODE  (*xa_codec_preprocess_f)(XACodecBase *);
 
@@ -62,6 +68,31 @@ typedef XA_ERRORCODE  (*xa_codec_setparam_f)(XACodecBase *, WORD32, pVOID p);
 typedef XA_ERRORCODE  (*xa_codec_getparam_f)(XACodecBase *, WORD32, pVOID p);
 
 typedef struct xf_channel_info xf_channel_info_t;
+
+/*******************************************************************************
+ * End-to-end latency statistics
+ ******************************************************************************/
+
+/* ...histogram bucket width in microseconds */
+#define XA_LATENCY_BUCKET_USEC          250
+
+/* ...number of histogram buckets (last one collects overflows) */
+#define XA_LATENCY_BUCKETS              64
+
+/* ...capture-to-sink latency histogram */
+typedef struct xa_latency_stats
+{
+    /* ...number of frames falling into each bucket */
+    UWORD32                 hist[XA_LATENCY_BUCKETS];
+
+    /* ...total number of stamped frames accounted */
+    UWORD32                 count;
+
+    /* ...worst-case latency observed (usec) */
+    UWORD32                 max;
+
+}   xa_latency_stats_t;
+
 /*******************************************************************************
  * Codec instance structure
  ******************************************************************************/
@@ -96,12 +127,27 @@ struct XACodecBase
     /* ...codec control state */
     UWORD32                     state;
 
+    /* ...memory table requirements per memory type (graph memory planning) */
+    UWORD32                 memtab_size[XA_MEMTYPE_OUTPUT + 1];
+
+    /* ...latency of stamped data reaching this component's sink */
+    xa_latency_stats_t      latency;
+
+    /* ...memory charged to this component, per xaf_mem_type */
+    xf_mem_acct_t           mem_acct;
+
     /***************************************************************************
      * Codec-specific methods
      **************************************************************************/
 
     /* ...memory buffer initialization */
     xa_codec_memtab_f       memtab;
+
+    /* ...memory buffer re-binding on in-place reset (optional) */
+    xa_codec_reset_f        reset;
+
+    /* ...port state snapshot and restore (optional) */
+    xa_codec_snapshot_f     snapshot;
  
     /* ...preprocessing function */
     xa_codec_preprocess_f   preprocess;
@@ -374,6 +420,9 @@ extern void xa_base_schedule(XACodecBase *base, UWORD64 dts);
 /* ...cancel internal scheduling message */
 extern void xa_base_cancel(XACodecBase *base);
 
+/* ...account latency of data carrying capture timestamp */
+extern void xa_base_latency_record(XACodecBase *base, UWORD32 ts);
+
 /* ...base codec factory */
 extern XACodecBase * xa_base_factory(UWORD32 core, UWORD32 size, xa_codec_func_t process);
 
@@ -36,6 +36,7 @@
 
 #include "osal-thread.h"
 #include "osal-msgq.h"
+#include "osal-timer.h"
 
 /* ...platform HAL layer */
 #include "xf-dp_hal.h"
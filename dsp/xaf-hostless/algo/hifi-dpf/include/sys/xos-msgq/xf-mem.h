@@ -32,11 +32,22 @@
 
  /*******************************************************************************/
 
+/* ...per-component memory accounting, bytes per memory type */
+typedef struct xf_mem_acct
+{
+    UWORD32 curr[XAF_MEM_TYPE_NUM];
+    UWORD32 peak[XAF_MEM_TYPE_NUM];
+} xf_mem_acct_t;
+
 /* ...memory allocation metadata */
 typedef struct xf_mem_info
 {
     void *buf_ptr;
     UWORD32 alloc_size;
+
+    /* ...owner accounting (NULL if allocation is not charged to a component) */
+    xf_mem_acct_t *acct;
+    UWORD32 type;
 } __attribute__((__packed__)) xf_mem_info_t;
 
 #define _MAX(a, b)  (((a) > (b))?(a):(b))
@@ -103,6 +114,7 @@ static inline void * xf_mem_alloc(UWORD32 size, UWORD32 align, UWORD32 core, UWO
     mem_info = (xf_mem_info_t *) ((UWORD32)aligned_ptr+size);
     mem_info->buf_ptr = ptr;
     mem_info->alloc_size = aligned_size;
+    mem_info->acct = NULL;
 
     return aligned_ptr;
 }
@@ -121,9 +133,44 @@ static inline void xf_mem_free(void *p, UWORD32 size, UWORD32 core, UWORD32 shar
 
     /* ...fetch alignment metadata and free */
     xf_mem_info_t *mem_info = (xf_mem_info_t *) ((UWORD32)p + size);
+
+    /* ...uncharge the owner component, if any */
+    if (mem_info->acct)
+    {
+        mem_info->acct->curr[mem_info->type] -= mem_info->alloc_size;
+    }
+
     xf_mm_free(&XF_CORE_DATA(core)->local_pool, mem_info->buf_ptr, mem_info->alloc_size);
 }
 
+/* ...charge bytes of given memory type to the component accounting */
+static inline void xf_mem_acct_add(xf_mem_acct_t *acct, UWORD32 type, UWORD32 size)
+{
+    if ((acct->curr[type] += size) > acct->peak[type])
+    {
+        acct->peak[type] = acct->curr[type];
+    }
+}
+
+/* ...tag local allocation with the owner component; uncharged in xf_mem_free */
+static inline void xf_mem_tag(void *p, UWORD32 size, UWORD32 shared, xf_mem_acct_t *acct, UWORD32 type)
+{
+    xf_mem_info_t *mem_info;
+
+#if XF_CFG_CORES_NUM > 1
+    /* ...shared pool allocations carry no metadata */
+    if (shared)     return;
+#endif
+
+    if (p == NULL)  return;
+
+    mem_info = (xf_mem_info_t *) ((UWORD32)p + size);
+    mem_info->acct = acct;
+    mem_info->type = type;
+
+    xf_mem_acct_add(acct, type, mem_info->alloc_size);
+}
+
 /* ...allocate AP-DSP shared memory */
 static inline int xf_shmem_alloc(UWORD32 core, xf_message_t *m)
 {
@@ -105,9 +105,24 @@ struct xf_worker {
 #ifdef LOCAL_SCHED
     xf_sched_t          sched;
 #else
-    xf_msg_queue_t base_cancel_queue;
-    xf_msg_pool_t base_cancel_pool;
+    /* ...per-client count of cancelled process requests still in the queue */
+    UWORD32 cancelled[XF_CFG_MAX_CLIENTS];
+    /* ...per-client flag of a process request sitting in the queue */
+    UWORD8 scheduled[XF_CFG_MAX_CLIENTS];
 #endif
+    /* ...per-client count of messages sitting in the queue */
+    UWORD32 pending[XF_CFG_MAX_CLIENTS];
+
+    /* ...message budget of the queue and messages held against it */
+    UWORD32 depth;
+    UWORD32 used;
+
+    /* ...messages deferred while the budget is exhausted (FIFO, behind the queue) */
+    xf_msg_queue_t deferred;
+    UWORD32 n_deferred;
+
+    /* ...queue statistics, visible to the application */
+    xaf_worker_queue_stats_t *stats;
 };
 
 /* ...per-core local data */
@@ -205,6 +220,17 @@ typedef struct {
 
     UWORD32 worker_thread_scratch_size[XAF_MAX_WORKER_THREADS]; /* ...user configurable worker scratch size */
 
+    UWORD32 worker_queue_depth[XAF_MAX_WORKER_THREADS]; /* ...user configurable worker queue depth */
+
+    xaf_worker_queue_stats_t worker_queue_stats[XAF_MAX_WORKER_THREADS];
+
+    UWORD32 resp_coalesce_count;    /* ...responses sent before the application is notified */
+    UWORD32 resp_coalesce_usec;     /* ...age of the oldest response before the application is notified */
+    UWORD32 resp_count;
+    UWORD32 resp_doorbells;
+
+    void *txn_active;               /* ...transaction being executed by DSP proxy */
+
 } xf_dsp_t;
 
 extern xf_dsp_t *xf_g_dsp;
@@ -212,6 +238,7 @@ extern xf_dsp_t *xf_g_dsp;
 typedef struct xf_worker_msg {
     xf_component_t *component;
     xf_message_t *msg;
+    UWORD32 client;
 } xf_worker_msg_t;
 
 /*******************************************************************************
@@ -231,3 +258,6 @@ extern int  xf_global_init(void);
 extern void xf_core_service(UWORD32 core);
 extern void xf_core_process(xf_component_t *component);
 extern void xf_core_process_message(xf_component_t *component, xf_message_t *msg);
+
+/* ...response to a command issued on behalf of a transaction */
+extern void xf_txn_complete(xf_message_t *m);
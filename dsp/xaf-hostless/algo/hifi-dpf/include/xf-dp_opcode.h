@@ -42,12 +42,12 @@
 #define XF_MSG_AP_TO_USER(id)           \
     ((id) & ~(0xF << 18))
 
-/* ...port specification (12 bits) */
+/* ...port specification (13 bits) */
 #define __XF_PORT_SPEC(core, id, port)  ((core) | ((id) << 2) | ((port) << 8))
 #define __XF_PORT_SPEC2(id, port)       ((id) | ((port) << 8))
 #define XF_PORT_CORE(spec)              ((spec) & 0x3)
 #define XF_PORT_CLIENT(spec)            (((spec) >> 2) & 0x3F)
-#define XF_PORT_ID(spec)                (((spec) >> 8) & 0xF)
+#define XF_PORT_ID(spec)                (((spec) >> 8) & 0x1F)
 
 /* ...message id contains source and destination ports specification */
 #define __XF_MSG_ID(src, dst)           (((src) & 0xFFFF) | (((dst) & 0xFFFF) << 16))
@@ -55,13 +55,13 @@
 #define XF_MSG_SRC_CORE(id)             (((id) >> 0) & 0x3)
 #define XF_MSG_SRC_CLIENT(id)           (((id) >> 2) & 0x3F)
 #define XF_MSG_SRC_ID(id)               (((id) >> 0) & 0xFF)
-#define XF_MSG_SRC_PORT(id)             (((id) >> 8) & 0xF)
+#define XF_MSG_SRC_PORT(id)             (((id) >> 8) & 0x1F)
 #define XF_MSG_SRC_PROXY(id)            (((id) >> 15) & 0x1)
 #define XF_MSG_DST(id)                  (((id) >> 16) & 0xFFFF)
 #define XF_MSG_DST_CORE(id)             (((id) >> 16) & 0x3)
 #define XF_MSG_DST_CLIENT(id)           (((id) >> 18) & 0x3F)
 #define XF_MSG_DST_ID(id)               (((id) >> 16) & 0xFF)
-#define XF_MSG_DST_PORT(id)             (((id) >> 24) & 0xF)
+#define XF_MSG_DST_PORT(id)             (((id) >> 24) & 0x1F)
 #define XF_MSG_DST_PROXY(id)            (((id) >> 31) & 0x1)
 
 /* ...special treatment of AP-proxy destination field */
@@ -71,6 +71,9 @@
 #define __XF_DSP_PROXY(core)            ((core) | 0x8000)
 #define __XF_AP_CLIENT(core, client)    ((core) | ((client) << 6) | 0x8000)
 
+/* ...AP client reserved for commands issued by DSP proxy on behalf of a transaction */
+#define XF_TXN_AP_CLIENT                0x1FF
+
 /* ...check if DSP message is shared between cores */
 #define XF_MSG_SHARED(id)               \
     ({ UWORD32 __id = (id); (XF_CFG_CORES_NUM > 1 ? (__id ^ (__id >> 16)) & 0x3 : 0); })
@@ -154,8 +157,23 @@
 /* ...channel setup */
 #define XF_EVENT                        __XF_OPCODE(1, 0, 20)
 
+/* ...batch of commands executed in one round trip */
+#define XF_TRANSACTION                  __XF_OPCODE(1, 1, 21)
+
+/* ...channel delivery counters */
+#define XF_EVENT_CHANNEL_STATS          __XF_OPCODE(1, 1, 22)
+
+/* ...in-place component reset with new parameters */
+#define XF_RESET                        __XF_OPCODE(1, 0, 23)
+
+/* ...component state snapshot into application buffer */
+#define XF_SNAPSHOT                     __XF_OPCODE(1, 1, 24)
+
+/* ...component state restore from application buffer */
+#define XF_RESTORE                      __XF_OPCODE(1, 0, 25)
+
 /* ...total amount of supported decoder commands */
-#define __XF_OP_NUM                     21
+#define __XF_OP_NUM                     26
 
 /*******************************************************************************
  * XF_START message definition
@@ -238,6 +256,9 @@ typedef struct xf_set_param_msg
 /* ...length of the command message */
 #define XF_SET_PARAM_CMD_LEN(params)    (sizeof(xf_set_param_item_t) * (params))
 
+/* ...XF_RESET carries the new parameters in XF_SET_PARAM format */
+#define XF_RESET_CMD_LEN(params)        XF_SET_PARAM_CMD_LEN(params)
+
 /*******************************************************************************
  * XF_SET_PARAM_EXT/XF_GET_PARAM_EXT message
  ******************************************************************************/
@@ -264,6 +285,21 @@ typedef struct xf_ext_param_msg
 
 }   __attribute__ ((__packed__, __aligned__(4))) xf_ext_param_msg_t;
 
+/*******************************************************************************
+ * XF_SNAPSHOT/XF_RESTORE definition
+ ******************************************************************************/
+
+/* ...component state transfer */
+typedef struct xf_snapshot_msg
+{
+    /* ...application buffer holding the snapshot */
+    UWORD32                 buffer;
+
+    /* ...buffer size (command), snapshot length (response) */
+    UWORD32                 length;
+
+}   __attribute__ ((__packed__)) xf_snapshot_msg_t;
+
 /*******************************************************************************
  * XF_ROUTE definition
  ******************************************************************************/
@@ -303,6 +339,48 @@ typedef struct xf_unroute_port_msg
 
 }	__attribute__((__packed__)) xf_unroute_port_msg_t;
 
+/*******************************************************************************
+ * XF_TRANSACTION definition
+ ******************************************************************************/
+
+/* ...transaction command descriptor */
+typedef struct xf_txn_cmd
+{
+    /* ...destination port specification */
+    UWORD32                 dst;
+
+    /* ...command opcode; replaced with response opcode */
+    UWORD32                 opcode;
+
+    /* ...payload offset from transaction start */
+    UWORD32                 offset;
+
+    /* ...payload length; replaced with response length */
+    UWORD32                 length;
+
+    /* ...response error code */
+    WORD32                  error;
+
+}   __attribute__((__packed__)) xf_txn_cmd_t;
+
+/* ...transaction of commands executed in order by DSP proxy */
+typedef struct xf_txn_msg
+{
+    /* ...number of commands */
+    UWORD32                 num;
+
+    /* ...index of command being executed (DSP Interface Layer use) */
+    UWORD32                 cur;
+
+    /* ...transaction session-id and length (DSP Interface Layer use) */
+    UWORD32                 id;
+    UWORD32                 length;
+
+    /* ...command descriptors; payloads follow */
+    xf_txn_cmd_t            cmd[0];
+
+}   __attribute__((__packed__)) xf_txn_msg_t;
+
 #ifndef XA_DISABLE_EVENT
 /*******************************************************************************
  * XF_EVENT_CHANNEL_CREATE definition
@@ -332,8 +410,18 @@ typedef struct xf_event_channel_msg
 	/* ...alignment restriction for a buffer */
 	UWORD32                 alloc_align;
 
+    /* ...delivery policy: coalescing mode, events per batch, minimal interval (usec) */
+    UWORD32                 coalesce_mode;
+    UWORD32                 batch_size;
+    UWORD32                 min_interval;
+
 }	__attribute__((__packed__)) xf_event_channel_msg_t;
 
+/* ...event buffer size: a count trails the payload of merged and batched events */
+#define XF_EVENT_CHANNEL_BUF_SIZE(size, mode, batch)                        \
+    ((mode) == XAF_EVENT_COALESCE_COUNT ? (size) + sizeof(UWORD32) :        \
+     (mode) == XAF_EVENT_COALESCE_BATCH ? (size) * (batch) + sizeof(UWORD32) : (size))
+
 /*******************************************************************************
  * XF_EVENT_CHANNEL_DELETE definition
  ******************************************************************************/
@@ -354,6 +442,32 @@ typedef struct xf_event_channel_delete_msg
     UWORD32                 dst_cfg_param;
 
 }	__attribute__((__packed__)) xf_event_channel_delete_msg_t;
+
+/*******************************************************************************
+ * XF_EVENT_CHANNEL_STATS definition
+ ******************************************************************************/
+
+/* ...event channel counters query */
+typedef struct xf_event_channel_stats_msg
+{
+	/* ...source port specification */
+	UWORD32                 src;
+
+	/* ...destination port specification */
+	UWORD32                 dst;
+
+    /* ... source command */
+    UWORD32                 src_cfg_param;
+
+    /* ... dest command */
+    UWORD32                 dst_cfg_param;
+
+    /* ...counters (response) */
+    UWORD32                 delivered;
+    UWORD32                 merged;
+    UWORD32                 dropped;
+
+}	__attribute__((__packed__)) xf_event_channel_stats_msg_t;
 #endif  /* XA_DISABLE_EVENT */
 /*******************************************************************************
  * XF_SET_PRIORITIES definition
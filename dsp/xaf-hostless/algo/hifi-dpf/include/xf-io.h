@@ -58,6 +58,9 @@ typedef struct xf_input_port
     /* ...execution flags */
     UWORD32                     flags;
 
+    /* ...capture timestamp of current input message */
+    UWORD32                     ts;
+
 }   xf_input_port_t;
 
 /*******************************************************************************
@@ -131,6 +134,12 @@ static inline UWORD32 xf_input_port_level(xf_input_port_t *port)
     return port->filled;
 }
 
+/* ...get capture timestamp of current input data (0 - not stamped) */
+static inline UWORD32 xf_input_port_ts(xf_input_port_t *port)
+{
+    return port->ts;
+}
+
 /*******************************************************************************
  * Output port data
  ******************************************************************************/
@@ -152,6 +161,9 @@ typedef struct xf_output_port
     /* ...output port flags */
     UWORD32                     flags;
 
+    /* ...capture timestamp attached to the next produced message */
+    UWORD32                     ts;
+
 }   xf_output_port_t;
 
 /*******************************************************************************
@@ -231,6 +243,12 @@ static inline int xf_output_port_flushing(xf_output_port_t *port)
     return ((port->flags & XF_OUTPUT_FLAG_FLUSHING) != 0);
 }
 
+/* ...set capture timestamp of data being produced into output port */
+static inline void xf_output_port_stamp(xf_output_port_t *port, UWORD32 ts)
+{
+    port->ts = ts;
+}
+
 /*******************************************************************************
  * Input port API
  ******************************************************************************/
@@ -275,6 +293,10 @@ extern void * xf_output_port_data(xf_output_port_t *port);
 /* ...route output port */
 extern int xf_output_port_route(xf_output_port_t *port, UWORD32 id, UWORD32 n, UWORD32 length, UWORD32 align);
 
+/* ...charge routed port buffers to component memory accounting */
+struct xf_mem_acct;
+extern void xf_output_port_tag(xf_output_port_t *port, struct xf_mem_acct *acct, UWORD32 type);
+
 /* ...unroute output port */
 extern void xf_output_port_unroute(xf_output_port_t *port);
 
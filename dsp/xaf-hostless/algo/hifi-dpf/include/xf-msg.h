@@ -62,6 +62,9 @@ struct xf_message
 
     /* ...error response*/
     WORD32                 error;
+
+    /* ...capture timestamp of the payload (usec; 0 - not stamped) */
+    UWORD32                 ts;
 };
 
 /* ...cache-line aligned message buffer */
@@ -129,4 +129,28 @@ static inline int xf_time_before(UWORD32 a, UWORD32 b)
 {
     return ((WORD32)(a - b) < 0);
 }
+
+/*******************************************************************************
+ * Wall-clock capture timestamps
+ ******************************************************************************/
+
+/* ...current wall-clock time in microseconds; zero is reserved for "not stamped" */
+static inline UWORD32 xf_timebase_now(void)
+{
+    UWORD32     ts = (UWORD32)__xf_time_usec();
+
+    return (ts ? ts : 1);
+}
+
+/* ...select the older of two capture timestamps (unstamped ones are ignored) */
+static inline UWORD32 xf_timebase_oldest(UWORD32 a, UWORD32 b)
+{
+    return (!a ? b : (!b ? a : (xf_time_before(a, b) ? a : b)));
+}
+
+/* ...time elapsed since the capture timestamp (in microseconds) */
+static inline UWORD32 xf_timebase_elapsed(UWORD32 ts)
+{
+    return xf_timebase_now() - ts;
+}
     
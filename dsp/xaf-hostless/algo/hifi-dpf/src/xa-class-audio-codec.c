@@ -100,6 +100,18 @@ typedef struct XAAudioCodec
 
 }   XAAudioCodec;
 
+/* ...port state carried by a component snapshot; followed by input buffer data */
+typedef struct xa_codec_port_state
+{
+    /* ...stream counters */
+    UWORD32                     produced;
+    UWORD32                     consumed;
+
+    /* ...input buffer fill level */
+    UWORD32                     filled;
+
+}   xa_codec_port_state_t;
+
 /*******************************************************************************
  * Auxiliary codec execution flags
  ******************************************************************************/
@@ -431,6 +443,7 @@ static XA_ERRORCODE xa_codec_port_route(XACodecBase *base, xf_message_t *m)
 
     /* ...route output port - allocate queue */
     XF_CHK_ERR(xf_output_port_route(port, __XF_MSG_ID(dst, src), cmd->alloc_number, cmd->alloc_size, cmd->alloc_align) == 0, XA_API_FATAL_MEM_ALLOC);
+    xf_output_port_tag(port, &base->mem_acct, XAF_MEM_TYPE_IO);
 
     /* ...schedule processing instantly */
     xa_base_schedule(base, 0);
@@ -729,6 +742,32 @@ static XA_ERRORCODE xa_codec_port_resume(XACodecBase *base, xf_message_t *m)
  * Generic codec API
  ******************************************************************************/
 
+/* ...probe port setup once both I/O ports are created */
+static XA_ERRORCODE xa_codec_probe_init(XAAudioCodec *codec)
+{
+    if (codec->probe_enabled)
+    {
+    	if (xf_input_port_created(&codec->input) && xf_output_port_created(&codec->output))
+    	{
+    		WORD32 probe_size;
+
+            /* ...return probe buffers held from previous run */
+            (xf_output_port_created(&codec->probe) ? xf_output_port_flush(&codec->probe, XF_FLUSH) : 0);
+
+            probe_size  = XF_CHK_PORT_MASK(codec->probe_enabled, 0) ? XF_ALIGNED_PROBE_SIZE(codec->input.length)  : 0;
+            probe_size += XF_CHK_PORT_MASK(codec->probe_enabled, 1) ? XF_ALIGNED_PROBE_SIZE(codec->output.length) : 0;
+
+    		/* ...initialize probe output port queue (no allocation here yet) */
+    		XF_CHK_ERR(xf_output_port_init(&codec->probe, probe_size) == 0, XA_API_FATAL_MEM_ALLOC);
+
+            /* ...put probe port into pause state */
+            xa_port_set_flags(&codec->probe.flags, XA_CODEC_PROBE_PORT_PAUSED);
+    	}
+    }
+
+    return XA_NO_ERROR;
+}
+
 /* ...memory buffer handling */
 static XA_ERRORCODE xa_codec_memtab(XACodecBase *base, WORD32 idx, WORD32 type, WORD32 size, WORD32 align, UWORD32 core)
 {
@@ -738,6 +777,7 @@ static XA_ERRORCODE xa_codec_memtab(XACodecBase *base, WORD32 idx, WORD32 type,
     {
         /* ...input port specification; allocate internal buffer */
         XF_CHK_ERR(xf_input_port_init(&codec->input, size, align, core) == 0, XA_API_FATAL_MEM_ALLOC);
+        xf_mem_tag(codec->input.buffer, codec->input.length, 0, &base->mem_acct, XAF_MEM_TYPE_IO);
 
         /* ...save input port index */
         codec->in_idx = idx;
@@ -771,21 +811,114 @@ static XA_ERRORCODE xa_codec_memtab(XACodecBase *base, WORD32 idx, WORD32 type,
         xa_port_clear_flags(&codec->output.flags, XA_CODEC_OUT_PORT_PAUSED);
     }
 
-    if (codec->probe_enabled)
+    return xa_codec_probe_init(codec);
+}
+
+/* ...memory buffer re-binding on in-place reset; port buffers are reused */
+static XA_ERRORCODE xa_codec_reset(XACodecBase *base, WORD32 idx, WORD32 type, WORD32 size, WORD32 align, UWORD32 core)
+{
+    XAAudioCodec   *codec = (XAAudioCodec *) base;
+
+    if (type == XA_MEMTYPE_INPUT)
     {
-    	if (xf_input_port_created(&codec->input) && xf_output_port_created(&codec->output))
-    	{
-    		WORD32 probe_size;
+        /* ...internal buffer must be large enough and suitably aligned */
+        XF_CHK_ERR((UWORD32)size <= codec->input.length, XA_API_FATAL_MEM_ALLOC);
+        XF_CHK_ERR(((UWORD32)codec->input.buffer & (align - 1)) == 0, XA_API_FATAL_MEM_ALIGN);
 
-            probe_size  = XF_CHK_PORT_MASK(codec->probe_enabled, 0) ? XF_ALIGNED_PROBE_SIZE(codec->input.length)  : 0;
-            probe_size += XF_CHK_PORT_MASK(codec->probe_enabled, 1) ? XF_ALIGNED_PROBE_SIZE(codec->output.length) : 0;
+        /* ...return queued input buffers; reset fill level */
+        xf_input_port_purge(&codec->input);
 
-    		/* ...initialize probe output port queue (no allocation here yet) */
-    		XF_CHK_ERR(xf_output_port_init(&codec->probe, probe_size) == 0, XA_API_FATAL_MEM_ALLOC);
+        /* ...save input port index */
+        codec->in_idx = idx;
 
-            /* ...put probe port into pause state */
-            xa_port_set_flags(&codec->probe.flags, XA_CODEC_PROBE_PORT_PAUSED);
-    	}
+        /* ...set input buffer pointer as needed */
+        if(size)
+        {
+            XA_API(base, XA_API_CMD_SET_MEM_PTR, idx, codec->input.buffer);
+        }
+
+        /* ...put input port into running state */
+        xa_port_clear_flags(&codec->input.flags, XA_CODEC_INP_PORT_PAUSED);
+    }
+    else
+    {
+        /* ...output buffer specification */
+        XF_CHK_ERR(type == XA_MEMTYPE_OUTPUT, XA_API_FATAL_INVALID_CMD_TYPE);
+
+        /* ...runtime initialization response goes to the application; routed output needs re-creation */
+        XF_CHK_ERR(!xf_output_port_routed(&codec->output), XA_API_FATAL_INVALID_CMD);
+
+        /* ...return queued output buffers */
+        xf_output_port_flush(&codec->output, XF_FLUSH);
+
+        /* ...release temporary buffer of an initialization that did not complete */
+        if (codec->pinit_output != NULL)
+        {
+            xf_mem_free(codec->pinit_output, codec->output.length, core, 0);
+            codec->pinit_output = NULL;
+        }
+
+        /* ...re-initialize output port with the new length */
+        XF_CHK_ERR(xf_output_port_init(&codec->output, size) == 0, XA_API_FATAL_MEM_ALLOC);
+
+        /* ...save output port index */
+        codec->out_idx = idx;
+
+        /* ...temporary output buffer for the runtime initialization, as on creation */
+        XF_CHK_ERR(codec->pinit_output = xf_mem_alloc(size, align, core, 0), XAF_MEMORY_ERR);
+
+        /* ...put output port into running state */
+        xa_port_clear_flags(&codec->output.flags, XA_CODEC_OUT_PORT_PAUSED);
+    }
+
+    /* ...reset stream counters */
+    codec->produced = 0, codec->consumed = 0;
+
+    return xa_codec_probe_init(codec);
+}
+
+/* ...port state save/restore; input data held by the port is carried along */
+static XA_ERRORCODE xa_codec_snapshot(XACodecBase *base, void *buf, UWORD32 *size, UWORD32 restore)
+{
+    XAAudioCodec           *codec = (XAAudioCodec *) base;
+    xa_codec_port_state_t  *ps = buf;
+
+    if (ps == NULL)
+    {
+        /* ...worst case is a full internal input buffer */
+        *size = sizeof(*ps) + codec->input.length;
+    }
+    else if (!restore)
+    {
+        /* ...input still queued would be lost; application stops feeding until all its buffers are returned */
+        XF_CHK_ERR(xf_msg_queue_head(&codec->input.queue) == NULL, XA_API_FATAL_INVALID_CMD);
+
+        ps->produced = codec->produced;
+        ps->consumed = codec->consumed;
+        ps->filled = (xf_input_port_bypass(&codec->input) ? 0 : xf_input_port_level(&codec->input));
+
+        XF_CHK_ERR(*size >= sizeof(*ps) + ps->filled, XA_API_FATAL_MEM_ALLOC);
+
+        (ps->filled ? memcpy(ps + 1, codec->input.buffer, ps->filled) : 0);
+
+        *size = sizeof(*ps) + ps->filled;
+    }
+    else
+    {
+        XF_CHK_ERR(*size >= sizeof(*ps) && *size >= sizeof(*ps) + ps->filled, XA_API_FATAL_INVALID_CMD_TYPE);
+        XF_CHK_ERR(ps->filled <= codec->input.length, XA_API_FATAL_INVALID_CMD_TYPE);
+
+        /* ...input queued at this component does not belong to the restored stream */
+        xf_input_port_purge(&codec->input);
+
+        (ps->filled ? memcpy(codec->input.buffer, ps + 1, ps->filled) : 0);
+        codec->input.filled = ps->filled;
+
+        codec->produced = ps->produced;
+        codec->consumed = ps->consumed;
+
+        /* ...input is set up anew; end-of-stream sequence restarts */
+        base->state &= ~(XA_CODEC_FLAG_INPUT_SETUP | XA_CODEC_FLAG_EOS_SEQ_DONE);
     }
 
     return XA_NO_ERROR;
@@ -1012,6 +1145,15 @@ static XA_ERRORCODE xa_codec_postprocess(XACodecBase *base, int done)
         /* ...increment total number of produced samples (really don't like division here - tbd) */
         codec->produced += produced / codec->sample_size;
 
+        /* ...carry capture timestamp of the input over to the output */
+        xf_output_port_stamp(&codec->output, xf_input_port_ts(&codec->input));
+
+        /* ...output delivered to application terminates the latency path */
+        if (!xf_output_port_routed(&codec->output))
+        {
+            xa_base_latency_record(base, xf_input_port_ts(&codec->input));
+        }
+
         /* ...immediately complete output buffer (don't wait until it gets filled) */
         xf_output_port_produce(&codec->output, produced);
 
@@ -1248,6 +1390,13 @@ static int xa_audio_codec_destroy(xf_component_t *component, xf_message_t *m)
     /* ...destroy input port */
     xf_input_port_destroy(&codec->input, core);
 
+    /* ...release temporary buffer of a codec deleted before its initialization completed */
+    if (codec->pinit_output != NULL)
+    {
+        xf_mem_free(codec->pinit_output, codec->output.length, core, 0);
+        codec->pinit_output = NULL;
+    }
+
     /* ...destroy output port */
     xf_output_port_destroy(&codec->output, core);
 
@@ -1325,6 +1474,8 @@ xf_component_t * xa_audio_codec_factory(UWORD32 core, xa_codec_func_t process, x
 
     /* ...set base codec API methods */
     codec->base.memtab = xa_codec_memtab;
+    codec->base.reset = xa_codec_reset;
+    codec->base.snapshot = xa_codec_snapshot;
     codec->base.preprocess = xa_codec_preprocess;
     codec->base.postprocess = xa_codec_postprocess;
     codec->base.getparam = xa_codec_getparam;
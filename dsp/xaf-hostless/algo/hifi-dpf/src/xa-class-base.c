@@ -52,10 +52,58 @@ struct xf_channel_info
     UWORD32                 client_id_dst;
     UWORD32                 event_buf_count;
     UWORD32                 buf_size;
+
+    /* ...delivery policy */
+    UWORD32                 coalesce_mode;
+    UWORD32                 batch_size;
+    UWORD32                 min_interval;
+
+    /* ...payload size of a single event */
+    UWORD32                 event_size;
+
+    /* ...events represented by the not yet delivered message */
+    UWORD32                 pending;
+
+    /* ...message being filled in batch mode */
+    xf_message_t            *batch_msg;
+
+    /* ...time of the last delivered message */
+    UWORD32                 last_ts;
+
+    /* ...delivery counters */
+    UWORD32                 delivered;
+    UWORD32                 merged;
+    UWORD32                 dropped;
 };
 #endif
 
 #define XAF_4BYTE_ALIGN    4
+
+/* ...component snapshot header; followed by class port state and plugin state */
+typedef struct xa_snapshot_hdr
+{
+    /* ...format tag */
+    UWORD32                 magic;
+
+    /* ...component type and memory requirements; must match on restore */
+    UWORD32                 comp_type;
+    UWORD32                 memtab_size[XA_MEMTYPE_OUTPUT + 1];
+
+    /* ...class port state length */
+    UWORD32                 port_size;
+
+    /* ...plugin state length */
+    UWORD32                 plugin_size;
+
+}   xa_snapshot_hdr_t;
+
+#define XA_SNAPSHOT_MAGIC               0x50414E53
+
+/* ...plugin state follows port state at 4-bytes aligned offset */
+#define XA_SNAPSHOT_ALIGNED(n)          (((n) + XAF_4BYTE_ALIGN - 1) & ~(XAF_4BYTE_ALIGN - 1))
+
+/* ...memory table size rounded up to its alignment */
+#define XF_MEMTAB_ALIGNED(size, align)  (((size) + (align) - 1) & ~((align) - 1))
 /*******************************************************************************
  * Internal functions definitions
  ******************************************************************************/
@@ -99,6 +147,7 @@ static XA_ERRORCODE xa_base_preinit(XACodecBase *base, UWORD32 core)
 
     /* ...allocate memory for codec API structure (4-bytes aligned) */
     XMALLOC(&base->api, n, 4, core);
+    xf_mem_tag(base->api.addr, base->api.size, 0, &base->mem_acct, XAF_MEM_TYPE_PERSIST);
 
     /* ...set default config parameters */
     XA_API(base, XA_API_CMD_INIT, XA_CMD_TYPE_INIT_API_PRE_CONFIG_PARAMS, NULL);
@@ -108,6 +157,7 @@ static XA_ERRORCODE xa_base_preinit(XACodecBase *base, UWORD32 core)
     {
         /* ...allocate memory for tables (4-bytes aligned) */
         XMALLOC(&base->mem_tabs, n, 4, core);
+        xf_mem_tag(base->mem_tabs.addr, base->mem_tabs.size, 0, &base->mem_acct, XAF_MEM_TYPE_PERSIST);
 
         /* ...set pointer for process memory tables */
         XA_API(base, XA_API_CMD_SET_MEMTABS_PTR, 0, base->mem_tabs.addr);
@@ -118,8 +168,8 @@ static XA_ERRORCODE xa_base_preinit(XACodecBase *base, UWORD32 core)
     return XA_NO_ERROR;
 }
 
-/* ...post-initialization setup */
-static XA_ERRORCODE xa_base_postinit(XACodecBase *base, UWORD32 core)
+/* ...post-initialization setup; on in-place reset the buffers already allocated are re-bound */
+static XA_ERRORCODE xa_base_postinit(XACodecBase *base, UWORD32 core, UWORD32 reset)
 {
     WORD32  n, i;
     
@@ -132,6 +182,9 @@ static XA_ERRORCODE xa_base_postinit(XACodecBase *base, UWORD32 core)
     /* ...No scratch memory */
     base->scratch_idx = -1;
 
+    /* ...requirements are collected anew */
+    memset(base->memtab_size, 0, sizeof(base->memtab_size));
+
     /* ...allocate memory buffers */
     for (i = 0; i < n; i++)
     {
@@ -148,6 +201,12 @@ static XA_ERRORCODE xa_base_postinit(XACodecBase *base, UWORD32 core)
         /* ...get alignment */
         XA_API(base, XA_API_CMD_GET_MEM_INFO_ALIGNMENT, i, &align);
 
+        /* ...account the aligned requirement for graph memory planning */
+        if (type <= XA_MEMTYPE_OUTPUT)
+        {
+            base->memtab_size[type] += XF_MEMTAB_ALIGNED(size, align);
+        }
+
         /* ...process individual buffer */
         switch (type)
         {
@@ -168,13 +227,27 @@ static XA_ERRORCODE xa_base_postinit(XACodecBase *base, UWORD32 core)
             /* ... scratch memory index */
             base->scratch_idx = i;
 
+            /* ...scratch belongs to the worker; account the component share only */
+            base->mem_acct.curr[XAF_MEM_TYPE_SCRATCH] = 0;
+            xf_mem_acct_add(&base->mem_acct, XAF_MEM_TYPE_SCRATCH, size);
+
             TRACE(INIT, _b("Mem tab %d: sz=%d al=%d ty=%d Scratch memory (%p)"), i, size, align, type, base->scratch);
 
             break;
 
         case XA_MEMTYPE_PERSIST:
-            /* ...allocate persistent memory */
-            XMALLOC(&base->persist, size, align, core);
+            if (reset)
+            {
+                /* ...persistent memory is reused; it must still fit */
+                XF_CHK_ERR(base->persist.addr != NULL && (UWORD32)size <= base->persist.size, XA_API_FATAL_MEM_ALLOC);
+                XF_CHK_ERR(((UWORD32)base->persist.addr & (align - 1)) == 0, XA_API_FATAL_MEM_ALIGN);
+            }
+            else
+            {
+                /* ...allocate persistent memory */
+                XMALLOC(&base->persist, size, align, core);
+                xf_mem_tag(base->persist.addr, base->persist.size, 0, &base->mem_acct, XAF_MEM_TYPE_PERSIST);
+            }
 
             /* ...and set the pointer instantly */
             XA_API(base, XA_API_CMD_SET_MEM_PTR, i, base->persist.addr);
@@ -186,7 +259,14 @@ static XA_ERRORCODE xa_base_postinit(XACodecBase *base, UWORD32 core)
         case XA_MEMTYPE_INPUT:
         case XA_MEMTYPE_OUTPUT:
             /* ...input/output buffer specification; pass to codec function */
-            CODEC_API(base, memtab, i, type, size, align, core);
+            if (reset)
+            {
+                CODEC_API(base, reset, i, type, size, align, core);
+            }
+            else
+            {
+                CODEC_API(base, memtab, i, type, size, align, core);
+            }
 
             break;
 
@@ -221,6 +301,9 @@ static XA_ERRORCODE xa_component_setparam(XACodecBase *base, WORD32 id, pVOID pv
         if(XF_CORE_DATA(core)->n_workers <= 0) return XA_NO_ERROR;
 
         UWORD32 sched_flag = (base->state & XA_BASE_FLAG_SCHEDULE);
+        UWORD32 priority = base->component.priority;
+        void   *scratch = base->scratch;
+        XA_ERRORCODE e;
 
         /* ...check if the component priority request is valid. */
         XF_CHK_ERR((*v + 1) < XF_CORE_DATA(core)->n_workers, XAF_INVALIDVAL_ERR);
@@ -236,7 +319,19 @@ static XA_ERRORCODE xa_component_setparam(XACodecBase *base, WORD32 id, pVOID pv
         {
             XA_CHK( xf_scratch_mem_alloc( base, core));
             
-            XA_API(base, XA_API_CMD_SET_MEM_PTR, base->scratch_idx, base->scratch);
+            /* ...plugin may keep state in its scratch; it stays on the current worker if it cannot move */
+            e = XA_API_NORET(base, XA_API_CMD_SET_MEM_PTR, base->scratch_idx, base->scratch);
+            if (XA_ERROR_SEVERITY(e))
+            {
+                base->component.priority = priority;
+                base->scratch = scratch;
+
+                if(sched_flag)
+                {
+                    xa_base_schedule(base, 0);
+                }
+                return e;
+            }
         }
 
         if(sched_flag)
@@ -251,28 +346,134 @@ static XA_ERRORCODE xa_component_setparam(XACodecBase *base, WORD32 id, pVOID pv
     }
 }
 
-/* ...SET-PARAM processing (enabled in all states) */
-XA_ERRORCODE xa_base_set_param(XACodecBase *base, xf_message_t *m)
+static int is_component_getparam(WORD32 id)
 {
-    xf_set_param_msg_t     *cmd = m->buffer;
-    xf_set_param_item_t    *param = &cmd->item[0];
-    WORD32                  n, i;
-    WORD32                  error = 0;
-    UWORD32 core = XF_MSG_DST_CORE(m->id);
+    return (((id >= XAF_COMP_CONFIG_PARAM_MEMTAB_PERSIST) && (id <= XAF_COMP_CONFIG_PARAM_LATENCY_MAX)) ||
+            ((id >= XAF_COMP_CONFIG_PARAM_MEM_CURR_PERSIST) && (id <= XAF_COMP_CONFIG_PARAM_SNAPSHOT_SIZE)));
+}
 
-    /* ...calculate total amount of parameters */
-    n = m->length / sizeof(*param);
+/* ...port and plugin state sizes of a snapshot; port size is the worst case */
+static XA_ERRORCODE xa_base_snapshot_size(XACodecBase *base, UWORD32 *port_size, UWORD32 *plugin_size)
+{
+    /* ...class must be able to save its port state */
+    XF_CHK_ERR(base->snapshot != NULL, XA_API_FATAL_INVALID_CMD);
 
-    /* ...check the message length is sane */
-    XF_CHK_ERR(m->length == XF_SET_PARAM_CMD_LEN(n), XA_API_FATAL_INVALID_CMD_TYPE);
+    CODEC_API(base, snapshot, NULL, port_size, 0);
 
-    /* ...revert priority to default after set-config message is popped from worker queue at pre-init */
-    if ((base->state & XA_BASE_FLAG_POSTINIT) == 0)
+    /* ...plugins opt in by implementing the state commands */
+    XA_API(base, XA_API_CMD_GET_STATE_SIZE, 0, plugin_size);
+
+    return XA_NO_ERROR;
+}
+
+/* ...latency percentile (upper edge of the bucket), clipped by the observed maximum */
+static UWORD32 xa_latency_percentile(xa_latency_stats_t *stats, UWORD32 pct)
+{
+    UWORD32 target = (stats->count * pct + 99) / 100;
+    UWORD32 sum = 0;
+    UWORD32 i;
+
+    if (stats->count == 0)  return 0;
+
+    for (i = 0; i < XA_LATENCY_BUCKETS - 1; i++)
     {
-        base->component.priority = 0;
+        if ((sum += stats->hist[i]) >= target)  break;
+    }
+
+    return ((i + 1) * XA_LATENCY_BUCKET_USEC < stats->max ? (i + 1) * XA_LATENCY_BUCKET_USEC : stats->max);
+}
+
+/* ...account latency of data carrying capture timestamp */
+void xa_base_latency_record(XACodecBase *base, UWORD32 ts)
+{
+    xa_latency_stats_t *stats = &base->latency;
+    UWORD32             t, k;
+
+    /* ...data is not stamped by the capture side */
+    if (ts == 0)    return;
+
+    t = xf_timebase_elapsed(ts);
+    k = t / XA_LATENCY_BUCKET_USEC;
+
+    stats->hist[(k < XA_LATENCY_BUCKETS ? k : XA_LATENCY_BUCKETS - 1)]++;
+    stats->count++;
+    (t > stats->max ? stats->max = t : 0);
+}
+
+static XA_ERRORCODE xa_component_getparam(XACodecBase *base, WORD32 id, pVOID pv)
+{
+    UWORD32 *v = pv;
+
+    switch (id) {
+    case XAF_COMP_CONFIG_PARAM_LATENCY_P50:
+        *v = xa_latency_percentile(&base->latency, 50);
+        return XA_NO_ERROR;
+
+    case XAF_COMP_CONFIG_PARAM_LATENCY_P90:
+        *v = xa_latency_percentile(&base->latency, 90);
+        return XA_NO_ERROR;
+
+    case XAF_COMP_CONFIG_PARAM_LATENCY_P99:
+        *v = xa_latency_percentile(&base->latency, 99);
+        return XA_NO_ERROR;
+
+    case XAF_COMP_CONFIG_PARAM_LATENCY_MAX:
+        *v = base->latency.max;
+        return XA_NO_ERROR;
+
+    case XAF_COMP_CONFIG_PARAM_MEM_CURR_PERSIST ... XAF_COMP_CONFIG_PARAM_MEM_CURR_EVENT:
+        *v = base->mem_acct.curr[id - XAF_COMP_CONFIG_PARAM_MEM_CURR_PERSIST];
+        return XA_NO_ERROR;
+
+    case XAF_COMP_CONFIG_PARAM_MEM_PEAK_PERSIST ... XAF_COMP_CONFIG_PARAM_MEM_PEAK_EVENT:
+        *v = base->mem_acct.peak[id - XAF_COMP_CONFIG_PARAM_MEM_PEAK_PERSIST];
+        return XA_NO_ERROR;
+    }
+
+    /* ...memory tables are known only after post-initialization */
+    XF_CHK_ERR(base->state & XA_BASE_FLAG_POSTINIT, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    switch (id) {
+    case XAF_COMP_CONFIG_PARAM_MEMTAB_PERSIST:
+        *v = base->memtab_size[XA_MEMTYPE_PERSIST];
+        return XA_NO_ERROR;
+
+    case XAF_COMP_CONFIG_PARAM_MEMTAB_SCRATCH:
+        *v = base->memtab_size[XA_MEMTYPE_SCRATCH];
+        return XA_NO_ERROR;
+
+    case XAF_COMP_CONFIG_PARAM_MEMTAB_IO:
+        *v = base->memtab_size[XA_MEMTYPE_INPUT] + base->memtab_size[XA_MEMTYPE_OUTPUT];
+        return XA_NO_ERROR;
+
+    case XAF_COMP_CONFIG_PARAM_MEMTAB_WORKER:
+        /* ...scratch is shared by all components executing on one worker */
+        *v = base->component.priority;
+        return XA_NO_ERROR;
+
+    case XAF_COMP_CONFIG_PARAM_SNAPSHOT_SIZE:
+    {
+        UWORD32 port_size, plugin_size;
+
+        XA_CHK(xa_base_snapshot_size(base, &port_size, &plugin_size));
+
+        *v = sizeof(xa_snapshot_hdr_t) + XA_SNAPSHOT_ALIGNED(port_size) + plugin_size;
+        return XA_NO_ERROR;
+    }
+
+    default:
+        return XA_API_FATAL_INVALID_CMD_TYPE;
     }
+}
+
+/* ...apply parameters list; only the first error is recorded in the message */
+static XA_ERRORCODE xa_base_apply_params(XACodecBase *base, xf_message_t *m, xf_set_param_item_t *param, WORD32 n)
+{
+    WORD32                  i;
+    WORD32                  error = 0;
+    UWORD32 core = XF_MSG_DST_CORE(m->id);
 
-    /* ...apply all parameters; pass to codec-specific function */
+    /* ...pass each parameter to codec-specific function */
     for (i = 0; i < n; i++)
     {
         TRACE(SETUP, _b("set-param[%p]: [%u]=%u"), base, param[i].id, param[i].value);
@@ -293,11 +494,35 @@ XA_ERRORCODE xa_base_set_param(XACodecBase *base, xf_message_t *m)
             m->error = error;
     }
 
+    return XA_NO_ERROR;
+}
+
+/* ...SET-PARAM processing (enabled in all states) */
+XA_ERRORCODE xa_base_set_param(XACodecBase *base, xf_message_t *m)
+{
+    xf_set_param_msg_t     *cmd = m->buffer;
+    WORD32                  n;
+
+    /* ...calculate total amount of parameters */
+    n = m->length / sizeof(xf_set_param_item_t);
+
+    /* ...check the message length is sane */
+    XF_CHK_ERR(m->length == XF_SET_PARAM_CMD_LEN(n), XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...revert priority to default after set-config message is popped from worker queue at pre-init */
+    if ((base->state & XA_BASE_FLAG_POSTINIT) == 0)
+    {
+        base->component.priority = 0;
+    }
+
+    /* ...apply all parameters */
+    XA_CHK(xa_base_apply_params(base, m, &cmd->item[0], n));
+
     /* ...check if we need to do post-initialization */
     if ((base->state & XA_BASE_FLAG_POSTINIT) == 0)
     {
         /* ...do post-initialization step */
-        XA_CHK_CRITICAL(xa_base_postinit(base, XF_MSG_DST_CORE(m->id)));
+        XA_CHK_CRITICAL(xa_base_postinit(base, XF_MSG_DST_CORE(m->id), 0));
         
         /* ...mark the codec static configuration is set */
         base->state ^= XA_BASE_FLAG_POSTINIT | XA_BASE_FLAG_RUNTIME_INIT;
@@ -309,6 +534,146 @@ XA_ERRORCODE xa_base_set_param(XACodecBase *base, xf_message_t *m)
     return XA_NO_ERROR;
 }
 
+/* ...RESET processing; re-run initialization with new parameters, keeping memory and routes */
+static XA_ERRORCODE xa_base_reset(XACodecBase *base, xf_message_t *m)
+{
+    xf_set_param_msg_t     *cmd = m->buffer;
+    WORD32                  n, size;
+
+    /* ...calculate total amount of parameters */
+    n = m->length / sizeof(xf_set_param_item_t);
+
+    /* ...check the message length is sane */
+    XF_CHK_ERR(m->length == XF_RESET_CMD_LEN(n), XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...component must be configured and its class able to re-bind port buffers */
+    XF_CHK_ERR(base->state & XA_BASE_FLAG_POSTINIT, XA_API_FATAL_INVALID_CMD);
+    XF_CHK_ERR(base->reset != NULL, XA_API_FATAL_INVALID_CMD);
+
+    /* ...cancel pending data processing */
+    xa_base_cancel(base);
+
+    /* ...plugin state is lost from here on; component is unusable until reset succeeds */
+    base->state |= XA_BASE_FLAG_COMP_FATAL_ERROR;
+
+    /* ...restore default config parameters */
+    XA_API(base, XA_API_CMD_INIT, XA_CMD_TYPE_INIT_API_PRE_CONFIG_PARAMS, NULL);
+
+    /* ...memory tables are reused; re-bind them */
+    if (XA_API(base, XA_API_CMD_GET_MEMTABS_SIZE, 0, &size), size != 0)
+    {
+        XF_CHK_ERR(base->mem_tabs.addr != NULL && (UWORD32)size <= base->mem_tabs.size, XA_API_FATAL_MEM_ALLOC);
+
+        XA_API(base, XA_API_CMD_SET_MEMTABS_PTR, 0, base->mem_tabs.addr);
+    }
+
+    /* ...apply new parameters */
+    XA_CHK(xa_base_apply_params(base, m, &cmd->item[0], n));
+
+    /* ...re-bind buffers; fails if the new requirements exceed the existing allocation */
+    XA_CHK(xa_base_postinit(base, XF_MSG_DST_CORE(m->id), 1));
+
+    /* ...component is back in the runtime-initialization stage */
+    base->state = XA_BASE_FLAG_POSTINIT | XA_BASE_FLAG_RUNTIME_INIT;
+
+    TRACE(INIT, _b("Codec[%p] reset completed"), base);
+
+    /* ...complete message processing; output buffer is empty */
+    xf_response_ok(m);
+
+    return XA_NO_ERROR;
+}
+
+/* ...SNAPSHOT processing; save port and plugin state into application buffer */
+static XA_ERRORCODE xa_base_snapshot(XACodecBase *base, xf_message_t *m)
+{
+    xf_snapshot_msg_t      *cmd = m->buffer;
+    xa_snapshot_hdr_t      *hdr;
+    UWORD8                 *p;
+    UWORD32                 port_size, plugin_size;
+
+    /* ...check the message length is sane */
+    XF_CHK_ERR(m->length == sizeof(*cmd), XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...runtime initialization must be completed */
+    XF_CHK_ERR((base->state & XA_BASE_FLAG_POSTINIT) && !(base->state & XA_BASE_FLAG_RUNTIME_INIT), XA_API_FATAL_INVALID_CMD);
+
+    XA_CHK(xa_base_snapshot_size(base, &port_size, &plugin_size));
+
+    /* ...buffer must hold the worst case */
+    XF_CHK_ERR(cmd->length >= sizeof(*hdr) + XA_SNAPSHOT_ALIGNED(port_size) + plugin_size, XA_API_FATAL_MEM_ALLOC);
+
+    hdr = (xa_snapshot_hdr_t *)cmd->buffer;
+    p = (UWORD8 *)(hdr + 1);
+
+    /* ...port state; actual size is returned */
+    CODEC_API(base, snapshot, p, &port_size, 0);
+    p += XA_SNAPSHOT_ALIGNED(port_size);
+
+    /* ...plugin state */
+    XA_API(base, XA_API_CMD_SAVE_STATE, plugin_size, p);
+    p += plugin_size;
+
+    hdr->magic = XA_SNAPSHOT_MAGIC;
+    hdr->comp_type = base->comp_type;
+    memcpy(hdr->memtab_size, base->memtab_size, sizeof(hdr->memtab_size));
+    hdr->port_size = port_size;
+    hdr->plugin_size = plugin_size;
+
+    TRACE(INFO, _b("Codec[%p] snapshot: port=%u plugin=%u"), base, port_size, plugin_size);
+
+    /* ...pass snapshot length to caller */
+    cmd->length = (UWORD32)(p - (UWORD8 *)hdr);
+
+    xf_response_data(m, sizeof(*cmd));
+
+    return XA_NO_ERROR;
+}
+
+/* ...RESTORE processing; load port and plugin state of a component of the same type and configuration */
+static XA_ERRORCODE xa_base_restore(XACodecBase *base, xf_message_t *m)
+{
+    xf_snapshot_msg_t      *cmd = m->buffer;
+    xa_snapshot_hdr_t      *hdr;
+    UWORD8                 *p;
+    UWORD32                 port_size;
+
+    /* ...check the message length is sane */
+    XF_CHK_ERR(m->length == sizeof(*cmd), XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...runtime initialization must be completed */
+    XF_CHK_ERR((base->state & XA_BASE_FLAG_POSTINIT) && !(base->state & XA_BASE_FLAG_RUNTIME_INIT), XA_API_FATAL_INVALID_CMD);
+    XF_CHK_ERR(base->snapshot != NULL, XA_API_FATAL_INVALID_CMD);
+
+    hdr = (xa_snapshot_hdr_t *)cmd->buffer;
+
+    /* ...snapshot must come from a component of the same type and configuration */
+    XF_CHK_ERR(cmd->length >= sizeof(*hdr) && hdr->magic == XA_SNAPSHOT_MAGIC, XA_API_FATAL_INVALID_CMD_TYPE);
+    XF_CHK_ERR(hdr->comp_type == base->comp_type, XA_API_FATAL_INVALID_CMD_TYPE);
+    XF_CHK_ERR(memcmp(hdr->memtab_size, base->memtab_size, sizeof(hdr->memtab_size)) == 0, XA_API_FATAL_INVALID_CMD_TYPE);
+    XF_CHK_ERR(cmd->length >= sizeof(*hdr) + XA_SNAPSHOT_ALIGNED(hdr->port_size) + hdr->plugin_size, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...cancel pending data processing */
+    xa_base_cancel(base);
+
+    p = (UWORD8 *)(hdr + 1);
+    port_size = hdr->port_size;
+
+    /* ...plugin state first; port state is left untouched if plugin rejects it */
+    XA_API(base, XA_API_CMD_RESTORE_STATE, hdr->plugin_size, p + XA_SNAPSHOT_ALIGNED(port_size));
+
+    CODEC_API(base, snapshot, p, &port_size, 1);
+
+    /* ...stream continues from the restored point */
+    base->state = (base->state & ~XA_BASE_FLAG_COMPLETED) | XA_BASE_FLAG_EXECUTION;
+
+    TRACE(INFO, _b("Codec[%p] restored: port=%u plugin=%u"), base, hdr->port_size, hdr->plugin_size);
+
+    xf_response_ok(m);
+
+    return XA_NO_ERROR;
+}
+
 /* ...GET-PARAM message processing (enabled in all states) */
 XA_ERRORCODE xa_base_get_param(XACodecBase *base, xf_message_t *m)
 {
@@ -328,7 +693,11 @@ XA_ERRORCODE xa_base_get_param(XACodecBase *base, xf_message_t *m)
     for (i = 0; i < n; i++)
     {
         /* ...place the result into same location */
-        if (base->getparam)
+        if (is_component_getparam(id[i]))
+        {
+            error = XA_CHK_CRITICAL(xa_component_getparam(base, id[i], &value[i]));
+        }
+        else if (base->getparam)
         {
             error = CODEC_API_CRITICAL(base, getparam, id[i], &value[i]);
         }
@@ -550,6 +919,117 @@ static XA_ERRORCODE xa_base_process(XACodecBase *base)
 }
 
 #ifndef XA_DISABLE_EVENT
+/* ...check the minimal interval since the last message of the channel has elapsed */
+static inline int xa_event_channel_ready(xf_channel_info_t *channel_info)
+{
+    return (!channel_info->min_interval || !channel_info->last_ts || (xf_timebase_elapsed(channel_info->last_ts) >= channel_info->min_interval));
+}
+
+/* ...deliver the pending message of a coalescing channel, if allowed */
+static XA_ERRORCODE xa_event_channel_flush(XACodecBase *base, xf_channel_info_t *channel_info)
+{
+    xf_message_t   *m;
+    UWORD8         *payload;
+
+    if (!channel_info->pending || !xa_event_channel_ready(channel_info))
+        return XA_NO_ERROR;
+
+    if (channel_info->coalesce_mode == XAF_EVENT_COALESCE_BATCH)
+    {
+        /* ...partial batch goes out only when rate limiting is in effect */
+        if ((channel_info->pending < channel_info->batch_size) && !channel_info->min_interval)
+            return XA_NO_ERROR;
+
+        m = channel_info->batch_msg, channel_info->batch_msg = NULL;
+    }
+    else if ((m = xf_msg_dequeue(&channel_info->queue)) == NULL)
+    {
+        /* ...stays pending until a buffer is returned */
+        return XA_NO_ERROR;
+    }
+
+    payload = (UWORD8 *)m->buffer + sizeof(channel_info->event_id_dst);
+
+    /* ...reset message error field */
+    m->error = 0;
+
+    if (channel_info->event_id_dst == XF_CFG_ID_EVENT_TO_APP)
+    {
+        *(UWORD32 *)m->buffer = channel_info->event_id_src;
+        channel_info->event_buf_count--;
+    }
+    else
+    {
+        *(UWORD32 *)m->buffer = channel_info->event_id_dst;
+    }
+
+    /* ...latest value wins; it is read at delivery time */
+    if ((channel_info->coalesce_mode != XAF_EVENT_COALESCE_BATCH) && channel_info->event_size)
+    {
+        XA_API(base, XA_API_CMD_GET_CONFIG_PARAM, channel_info->event_id_src, payload);
+    }
+
+    /* ...number of events represented by the message trails the payload */
+    if (channel_info->coalesce_mode != XAF_EVENT_COALESCE_LATEST)
+    {
+        memcpy(payload + channel_info->buf_size - sizeof(UWORD32), &channel_info->pending, sizeof(UWORD32));
+    }
+
+    xf_response_data(m, (channel_info->buf_size + sizeof(channel_info->event_id_dst)));
+
+    channel_info->pending = 0;
+    channel_info->delivered++;
+    channel_info->last_ts = xf_timebase_now();
+
+    return XA_NO_ERROR;
+}
+
+/* ...merge the event into the pending message of a coalescing channel */
+static XA_ERRORCODE xa_event_channel_post(XACodecBase *base, xf_channel_info_t *channel_info, UWORD32 event_id)
+{
+    if (channel_info->coalesce_mode == XAF_EVENT_COALESCE_BATCH)
+    {
+        /* ...batch is full and not yet deliverable */
+        if (channel_info->pending == channel_info->batch_size)
+        {
+            channel_info->dropped++;
+            return XA_NO_ERROR;
+        }
+
+        if ((channel_info->batch_msg == NULL) && ((channel_info->batch_msg = xf_msg_dequeue(&channel_info->queue)) == NULL))
+        {
+            channel_info->dropped++;
+            return XA_NO_ERROR;
+        }
+
+        /* ...values are collected as events are raised */
+        if (channel_info->event_size)
+        {
+            XA_API(base, XA_API_CMD_GET_CONFIG_PARAM, event_id, (UWORD8 *)channel_info->batch_msg->buffer + sizeof(channel_info->event_id_dst) + channel_info->pending * channel_info->event_size);
+        }
+    }
+
+    (channel_info->pending++ ? channel_info->merged++ : 0);
+
+    return xa_event_channel_flush(base, channel_info);
+}
+
+/* ...deliver pending messages of all channels once their interval elapses */
+static XA_ERRORCODE xa_base_event_flush(XACodecBase *base)
+{
+    xf_channel_info_t  *channel_info;
+
+    for (channel_info = base->channel_info_chain; channel_info != NULL; channel_info = channel_info->next)
+    {
+        if (channel_info->pending && (channel_info->delete_msg == NULL))
+        {
+            XA_CHK(xa_event_channel_flush(base, channel_info));
+        }
+    }
+
+    return XA_NO_ERROR;
+}
+
 static XA_ERRORCODE xa_base_event_handler(XACodecBase *base, UWORD32 event_id, XA_ERRORCODE error_code)
 {
     xf_channel_info_t   *channel_info, *p_channel_info_curr = NULL;
@@ -571,6 +1051,23 @@ static XA_ERRORCODE xa_base_event_handler(XACodecBase *base, UWORD32 event_id, X
             if (channel_info->delete_msg != NULL)
             {
                 TRACE(WARNING, _b("Event undelivered. Channel is being deleted. Event id: %d, base ptr: [%p] comp_type=%d"), event_id, base, base->comp_type);
+                channel_info->dropped++;
+                pp_channel_info_curr = &p_channel_info_curr->next;
+                continue;
+            }
+
+            /* ...errors are never merged or rate limited */
+            if (!error_code && (channel_info->coalesce_mode != XAF_EVENT_COALESCE_NONE))
+            {
+                XA_CHK(xa_event_channel_post(base, channel_info, event_id));
+                pp_channel_info_curr = &p_channel_info_curr->next;
+                continue;
+            }
+
+            if (!error_code && !xa_event_channel_ready(channel_info))
+            {
+                TRACE(EXEC, _b("Event dropped, rate limited. Event id: %d, base ptr: [%p]"), event_id, base);
+                channel_info->dropped++;
                 pp_channel_info_curr = &p_channel_info_curr->next;
                 continue;
             }
@@ -580,6 +1077,7 @@ static XA_ERRORCODE xa_base_event_handler(XACodecBase *base, UWORD32 event_id, X
             if (m == NULL) 
             {
                 TRACE(WARNING, _b("Event undelivered. Channel queue is empty for event id: %d, base ptr: [%p] "), event_id, base);
+                channel_info->dropped++;
                 pp_channel_info_curr = &p_channel_info_curr->next;
                 continue;
             }
@@ -613,6 +1111,9 @@ static XA_ERRORCODE xa_base_event_handler(XACodecBase *base, UWORD32 event_id, X
 
             /* ...complete message with specified amount of bytes produced */
             xf_response_data(m, (channel_info->buf_size + sizeof(channel_info->event_id_dst)));     // Tbd: should be +sizeof(event_id) for events to app
+
+            channel_info->delivered++;
+            channel_info->last_ts = xf_timebase_now();
         }
         pp_channel_info_curr = &p_channel_info_curr->next;
     }
@@ -703,15 +1204,24 @@ static XA_ERRORCODE xa_base_create_event_channel(XACodecBase *base, xf_message_t
             break;
     }
 
+    /*... check delivery policy */
+    XF_CHK_ERR(cmd->coalesce_mode <= XAF_EVENT_COALESCE_BATCH, XAF_INVALIDVAL_ERR);
+    XF_CHK_ERR((cmd->coalesce_mode != XAF_EVENT_COALESCE_BATCH) || ((cmd->batch_size >= 1) && (cmd->batch_size <= XAF_EVENT_BATCH_MAX)), XAF_INVALIDVAL_ERR);
+
     /* ... check if channel info allocation is ok */
     XF_CHK_ERR(channel_info = (xf_channel_info_t *) xf_mem_alloc(sizeof(xf_channel_info_t), XF_EVENT_CHANNEL_INFO_ALIGNMENT, core, shared), XAF_MEMORY_ERR);
+    xf_mem_tag(channel_info, sizeof(xf_channel_info_t), shared, &base->mem_acct, XAF_MEM_TYPE_EVENT);
 
     /* ...initializing channel_info structure */
     memset(channel_info, 0, sizeof(xf_channel_info_t));  
     
     channel_info->event_id_src      = cmd->src_cfg_param;
     channel_info->event_id_dst      = cmd->dst_cfg_param;
-    channel_info->buf_size          = cmd->alloc_size;
+    channel_info->event_size        = cmd->alloc_size;
+    channel_info->coalesce_mode     = cmd->coalesce_mode;
+    channel_info->batch_size        = cmd->batch_size;
+    channel_info->min_interval      = cmd->min_interval;
+    channel_info->buf_size          = XF_EVENT_CHANNEL_BUF_SIZE(cmd->alloc_size, cmd->coalesce_mode, cmd->batch_size);
     channel_info->client_id_dst     = XF_PORT_CLIENT(cmd->dst);
     channel_info->delete_msg        = NULL;
 
@@ -747,6 +1257,7 @@ static XA_ERRORCODE xa_base_create_event_channel(XACodecBase *base, xf_message_t
             msg->opcode = XF_EVENT;
             msg->length = channel_info->buf_size;
             msg->buffer = xf_mem_alloc((msg->length + sizeof(channel_info->event_id_dst)), cmd->alloc_align, core, shared);
+            xf_mem_tag(msg->buffer, msg->length + sizeof(channel_info->event_id_dst), shared, &base->mem_acct, XAF_MEM_TYPE_EVENT);
 
             /* ...if allocation failed, do a cleanup */
             if (!msg->buffer)
@@ -820,6 +1331,16 @@ static XA_ERRORCODE xa_base_delete_event_channel(XACodecBase *base, xf_message_t
     /* ...look-up successful */
     channel_info = p_channel_info_curr;
 
+    /* ...pending events are discarded, partially filled batch is released */
+    if (channel_info->batch_msg != NULL)
+    {
+        xf_msg_enqueue(&channel_info->queue, channel_info->batch_msg);
+        channel_info->batch_msg = NULL;
+    }
+
+    channel_info->dropped += channel_info->pending;
+    channel_info->pending = 0;
+
     while((msg = xf_msg_dequeue(&channel_info->queue)) != NULL)
     {
         if (channel_info->event_id_dst == XF_CFG_ID_EVENT_TO_APP)
@@ -867,6 +1388,29 @@ static XA_ERRORCODE xa_base_delete_event_channel(XACodecBase *base, xf_message_t
     return XAF_NO_ERR;
 }
 
+static XA_ERRORCODE xa_base_event_channel_stats(XACodecBase *base, xf_message_t *m)
+{
+    xf_event_channel_stats_msg_t    *cmd = m->buffer;
+    xf_channel_info_t               *channel_info;
+
+    /* ...channel look-up; same parameters may be connected to several destinations */
+    for (channel_info = base->channel_info_chain; channel_info != NULL; channel_info = channel_info->next)
+    {
+        if ((channel_info->event_id_src == cmd->src_cfg_param) && (channel_info->event_id_dst == cmd->dst_cfg_param) && (channel_info->client_id_dst == XF_PORT_CLIENT(cmd->dst)))
+            break;
+    }
+
+    XF_CHK_ERR(channel_info != NULL, XAF_INVALIDPTR_ERR);
+
+    cmd->delivered  = channel_info->delivered;
+    cmd->merged     = channel_info->merged;
+    cmd->dropped    = channel_info->dropped;
+
+    xf_response_data(m, sizeof(*cmd));
+
+    return XAF_NO_ERR;
+}
+
 static XA_ERRORCODE xa_base_process_event(XACodecBase *base, xf_message_t *m)
 {
     UWORD32     event_id = (UWORD32)*(UWORD32*)m->buffer;
@@ -919,6 +1463,9 @@ static XA_ERRORCODE xa_base_process_event(XACodecBase *base, xf_message_t *m)
 
             if (channel_info->event_id_dst == XF_CFG_ID_EVENT_TO_APP)
                 channel_info->event_buf_count++;
+
+            /* ...message held back for lack of a buffer may go out now */
+            XA_CHK(xa_event_channel_flush(base, channel_info));
         }
         else
         {
@@ -976,6 +1523,15 @@ static int xa_base_command(xf_component_t *component, xf_message_t *m)
         error = xa_base_process(base);
         XF_CHK_ERR(!XA_ERROR_SEVERITY(error), error);
 
+#ifndef XA_DISABLE_EVENT
+        /* ...rate-limited events may be due */
+        if (base->num_channels)
+        {
+            error = xa_base_event_flush(base);
+            XF_CHK_ERR(!XA_ERROR_SEVERITY(error), error);
+        }
+#endif
+
         return 0;
     }
 
@@ -999,12 +1555,44 @@ static int xa_base_command(xf_component_t *component, xf_message_t *m)
         return 0;
     }
 
+    if ((cmd = XF_OPCODE_TYPE(m->opcode)) == XF_OPCODE_TYPE(XF_EVENT_CHANNEL_STATS))
+    {
+        if(xa_base_event_channel_stats(base, m) < 0)
+            xf_response_err(m);
+
+        return 0;
+    }
+
     if ((cmd = XF_OPCODE_TYPE(m->opcode)) == XF_OPCODE_TYPE(XF_EVENT))
     {
         return (xa_base_process_event(base, m));
 
     }
 #endif 
+    if ((cmd = XF_OPCODE_TYPE(m->opcode)) == XF_OPCODE_TYPE(XF_RESET))
+    {
+        if (xa_base_reset(base, m) != XA_NO_ERROR)
+            xf_response_err(m);
+
+        return 0;
+    }
+
+    if ((cmd = XF_OPCODE_TYPE(m->opcode)) == XF_OPCODE_TYPE(XF_SNAPSHOT))
+    {
+        if (xa_base_snapshot(base, m) != XA_NO_ERROR)
+            xf_response_err(m);
+
+        return 0;
+    }
+
+    if ((cmd = XF_OPCODE_TYPE(m->opcode)) == XF_OPCODE_TYPE(XF_RESTORE))
+    {
+        if (xa_base_restore(base, m) != XA_NO_ERROR)
+            xf_response_err(m);
+
+        return 0;
+    }
+
     /* ...bail out if this is forced termination command (I do have a map; maybe I'd better have a hook? - tbd) */
     if ((cmd = XF_OPCODE_TYPE(m->opcode)) == XF_OPCODE_TYPE(XF_UNREGISTER))
     {
@@ -1113,22 +1701,17 @@ void xa_base_cancel(XACodecBase *base)
         if(xf_sched_cancel(&cd->sched, &base->component.task))
         {
             /* ...node is not on the schedule-tree, then it must be in workerQ */
-            while(cd->worker)
+            if(cd->worker)
             {
-                xf_message_t *m;
                 struct xf_worker *worker = &cd->worker[base->component.priority];
-            
-                if((m = xf_msg_pool_get(&worker->base_cancel_pool)) == NULL)
-                {
-                    /* ...This condition should never occur */
-                    TRACE(EXEC, _b("codec[%p] processing cancel failed, insufficient pool buffer"), base);
-                    break;
-                }
-            
-                m->buffer = (void *)&base->component;
-            
-                /* ...enqueue the node to be cancelled. It will not be submitted to process at the worker dequeue. */
-                xf_msg_enqueue(&worker->base_cancel_queue, m);
+                UWORD32 client = XF_PORT_CLIENT(base->component.id);
+                unsigned long flags = __xf_disable_interrupts();
+
+                /* ...mark the queued node cancelled; it will be dropped at the worker dequeue */
+                if (worker->scheduled[client])
+                    worker->cancelled[client] = 1;
+
+                __xf_restore_interrupts(flags);
 
                 return;
             }
@@ -1166,6 +1749,9 @@ XACodecBase * xa_base_factory(UWORD32 core, UWORD32 size, xa_codec_func_t proces
     /* ...reset codec memory */
     memset(base, 0, size);
 
+    /* ...component object is charged to the component itself */
+    xf_mem_tag(base, size, 0, &base->mem_acct, XAF_MEM_TYPE_PERSIST);
+
     /* ...set low-level codec API function */
     base->process = process;
 
@@ -289,6 +289,7 @@ static XA_ERRORCODE xa_capturer_port_route(XACodecBase *base, xf_message_t *m)
 
     /* ...route output port - allocate queue */
     XF_CHK_ERR(xf_output_port_route(port, __XF_MSG_ID(dst, src), cmd->alloc_number, cmd->alloc_size, cmd->alloc_align) == 0, XA_API_FATAL_MEM_ALLOC);
+    xf_output_port_tag(port, &base->mem_acct, XAF_MEM_TYPE_IO);
 
     /* ...pass success result to caller */
     xf_response_ok(m);
@@ -518,6 +519,9 @@ static XA_ERRORCODE xa_capturer_postprocess(XACodecBase *base, int done)
 
     if (produced)
     {
+        /* ...stamp captured frame for end-to-end latency measurement */
+        xf_output_port_stamp(&capturer->output, xf_timebase_now());
+
         /* ...immediately complete output buffer (don't wait until it gets filled) */
         xf_output_port_produce(&capturer->output, produced);
     }
@@ -777,6 +777,7 @@ static XA_ERRORCODE xa_mimo_proc_port_route(XACodecBase *base, xf_message_t *m)
 
     /* ...route output port - allocate queue */
     XF_CHK_ERR(xf_output_port_route(port, __XF_MSG_ID(dst, src), cmd->alloc_number, cmd->alloc_size, cmd->alloc_align) == 0, XA_API_FATAL_MEM_ALLOC);
+    xf_output_port_tag(port, &base->mem_acct, XAF_MEM_TYPE_IO);
 
     /* ...set routed flag */
     xa_out_track_set_flags(&mimo_proc->out_track[i], XA_OUT_TRACK_FLAG_ROUTED);
@@ -1022,6 +1023,7 @@ static XA_ERRORCODE xa_mimo_proc_memtab(XACodecBase *base, WORD32 idx, WORD32 ty
 
         /* ...create input port for a track */
         XF_CHK_ERR(xf_input_port_init(&track->input, size, align, core) == 0, XA_API_FATAL_MEM_ALLOC);
+        xf_mem_tag(track->input.buffer, track->input.length, 0, &base->mem_acct, XAF_MEM_TYPE_IO);
 
         if(size)
         {
@@ -1282,6 +1284,7 @@ static XA_ERRORCODE xa_mimo_proc_postprocess(XACodecBase *base, int done)
     UWORD32         i;
     UWORD32         probe_length = 0;
     void           *probe_outptr = mimo_proc->probe_output;
+    UWORD32         ts = 0;
 
     /* ...input ports maintenance; process all tracks */
     for (in_track = &mimo_proc->in_track[i = 0]; i < mimo_proc->num_in_ports; i++, in_track++)
@@ -1289,6 +1292,9 @@ static XA_ERRORCODE xa_mimo_proc_postprocess(XACodecBase *base, int done)
         /* ...skip the tracks that are not runing */
         if (!xa_in_track_test_flags(in_track, XA_IN_TRACK_FLAG_ACTIVE))  continue;
 
+        /* ...output inherits the oldest capture timestamp of the inputs */
+        ts = xf_timebase_oldest(ts, xf_input_port_ts(&in_track->input));
+
         if (!(done && (base->state & XA_BASE_FLAG_EXECUTION)))
         {
             /* ...get total amount of consumed bytes */
@@ -1393,6 +1399,7 @@ static XA_ERRORCODE xa_mimo_proc_postprocess(XACodecBase *base, int done)
             }
 
             /* ...push data from output port */
+            xf_output_port_stamp(&out_track->output, ts);
             xf_output_port_produce(&out_track->output, produced);
 
             /* ...clear output-setup and flush-done condition */
@@ -484,6 +484,7 @@ static XA_ERRORCODE xa_mixer_port_route(XACodecBase *base, xf_message_t *m)
 
     /* ...route output port - allocate queue */
     XF_CHK_ERR(xf_output_port_route(port, __XF_MSG_ID(dst, src), cmd->alloc_number, cmd->alloc_size, cmd->alloc_align) == 0, XA_API_FATAL_MEM_ALLOC);
+    xf_output_port_tag(port, &base->mem_acct, XAF_MEM_TYPE_IO);
 
     /* ...schedule processing instantly - tbd - check if we have anything pending on input */
     xa_base_schedule(base, 0);
@@ -768,6 +769,7 @@ static XA_ERRORCODE xa_mixer_memtab(XACodecBase *base, WORD32 idx, WORD32 type,
 
         /* ...create input port for a track */
         XF_CHK_ERR(xf_input_port_init(&track->input, size, align, core) == 0, XA_API_FATAL_MEM_ALLOC);
+        xf_mem_tag(track->input.buffer, track->input.length, 0, &base->mem_acct, XAF_MEM_TYPE_IO);
 
         if(size)
         {
@@ -1007,6 +1009,7 @@ static XA_ERRORCODE xa_mixer_postprocess(XACodecBase *base, int done)
     UWORD8              i;
     UWORD32         probe_length = 0;
     void           *probe_outptr = mixer->probe_output;
+    UWORD32         ts = 0;
 
     if (done)
     {
@@ -1034,6 +1037,9 @@ static XA_ERRORCODE xa_mixer_postprocess(XACodecBase *base, int done)
 
         /* ...clear input setup flag */
         xa_track_clear_flags(track, XA_TRACK_FLAG_INPUT_SETUP);
+
+        /* ...mixed output inherits the oldest capture timestamp of the tracks */
+        ts = xf_timebase_oldest(ts, xf_input_port_ts(&track->input));
         
         /* ...advance track presentation timestamp */
         track->pts += mixer->frame_size;
@@ -1103,6 +1109,7 @@ static XA_ERRORCODE xa_mixer_postprocess(XACodecBase *base, int done)
         mixer->pts += mixer->frame_size;
 
         /* ...push data from output port */
+        xf_output_port_stamp(&mixer->output, ts);
         xf_output_port_produce(&mixer->output, produced);
 
         /* ...clear output-setup condition */
@@ -395,6 +395,7 @@ static XA_ERRORCODE xa_renderer_memtab(XACodecBase *base, WORD32 idx, WORD32 typ
 
         /* ...create input port for a track */
         XF_CHK_ERR(xf_input_port_init(&renderer->input, size, align, core) == 0, XA_API_FATAL_MEM_ALLOC);
+        xf_mem_tag(renderer->input.buffer, renderer->input.length, 0, &base->mem_acct, XAF_MEM_TYPE_IO);
 
         /* ...well, we want to use buffers without copying them into interim buffer */
         TRACE(INIT, _b("renderer input port created - size=%u"), size);
@@ -569,6 +570,9 @@ static XA_ERRORCODE xa_renderer_postprocess(XACodecBase *base, int done)
         /* ...output buffer maintenance; check if we have produced anything */
         if (produced)
         {
+            /* ...reference output carries capture timestamp of the rendered data */
+            xf_output_port_stamp(&renderer->output, xf_input_port_ts(&renderer->input));
+
             /* ...immediately complete output buffer (don't wait until it gets filled) */
             xf_output_port_produce(&renderer->output, produced);
         
@@ -582,6 +586,9 @@ static XA_ERRORCODE xa_renderer_postprocess(XACodecBase *base, int done)
     /* ...input buffer maintenance; consume that amount from input port */
     if (consumed)
     {
+        /* ...account capture-to-render latency of the frame */
+        xa_base_latency_record(base, xf_input_port_ts(&renderer->input));
+
         /* ...consume bytes from input buffer */
         xf_input_port_consume(&renderer->input, consumed);
     }
@@ -665,6 +672,7 @@ static XA_ERRORCODE xa_renderer_port_route(XACodecBase *base, xf_message_t *m)
 
     /* ...route output port - allocate queue */
     XF_CHK_ERR(xf_output_port_route(port, __XF_MSG_ID(dst, src), cmd->alloc_number, cmd->alloc_size, cmd->alloc_align) == 0, XA_API_FATAL_MEM_ALLOC);
+    xf_output_port_tag(port, &base->mem_acct, XAF_MEM_TYPE_IO);
 #if 0
     /* ...schedule processing instantly */
     xa_base_schedule(base, 0);
@@ -68,6 +68,106 @@ static inline void xf_client_free(xf_core_data_t *cd, UWORD32 client)
     cd->cmap[client].next = cd->free, cd->free = client;
 }
 
+/* ...queue capacity beyond the message budget: purge marker, exit command and coalesced process requests */
+#ifdef LOCAL_SCHED
+#define XF_WORKER_QUEUE_RESERVED    2
+#else
+#define XF_WORKER_QUEUE_RESERVED    (2 + XF_CFG_MAX_CLIENTS)
+#endif
+
+/* ...post message to a worker; never blocks, messages beyond the queue budget are deferred */
+static void xf_worker_msg_post(struct xf_worker *worker, xf_component_t *component, xf_message_t *m)
+{
+    xf_worker_msg_t worker_msg = {
+        .component = component,
+        .msg = m,
+        .client = XF_PORT_CLIENT(component->id),
+    };
+    unsigned long flags = __xf_disable_interrupts();
+    UWORD32 queued;
+
+    /* ...account message before it becomes visible to the worker (senders may run on any thread) */
+    worker->pending[XF_MSG_DST_CLIENT(m->id)]++;
+
+    /* ...once a message is deferred, the following ones are deferred too to keep the order */
+    if ((queued = (worker->n_deferred == 0 && worker->used < worker->depth)))
+    {
+        if (++worker->used > worker->stats->used_hwm)
+            worker->stats->used_hwm = worker->used;
+    }
+    else
+    {
+        xf_msg_enqueue(&worker->deferred, m);
+
+        worker->stats->deferred++;
+        if (++worker->n_deferred > worker->stats->deferred_hwm)
+            worker->stats->deferred_hwm = worker->n_deferred;
+    }
+
+    __xf_restore_interrupts(flags);
+
+    if (queued)
+    {
+        /* ...slot is reserved; send does not block */
+        __xf_msgq_send(worker->queue, &worker_msg, sizeof(worker_msg));
+    }
+}
+
+/* ...release the slot of a message taken out of the worker queue */
+static void xf_worker_msg_release(struct xf_worker *worker, UWORD32 client)
+{
+    xf_message_t *m;
+    unsigned long flags = __xf_disable_interrupts();
+
+    worker->pending[client]--;
+
+    /* ...hand the slot over to the oldest deferred message, if any */
+    if ((m = xf_msg_dequeue(&worker->deferred)) != NULL)
+        worker->n_deferred--;
+    else
+        worker->used--;
+
+    __xf_restore_interrupts(flags);
+
+    if (m)
+    {
+        /* ...component is looked up by the worker at dequeue */
+        xf_worker_msg_t worker_msg = {
+            .component = NULL,
+            .msg = m,
+            .client = XF_MSG_DST_CLIENT(m->id),
+        };
+
+        __xf_msgq_send(worker->queue, &worker_msg, sizeof(worker_msg));
+    }
+}
+
+#ifndef LOCAL_SCHED
+/* ...merge process request into the one already in the worker queue, if any */
+static inline int xf_worker_sched_coalesce(struct xf_worker *worker, UWORD32 client)
+{
+    unsigned long flags = __xf_disable_interrupts();
+    int coalesced = worker->scheduled[client];
+
+    if (coalesced)
+    {
+        /* ...queued request might have been cancelled meanwhile; revive it */
+        if (worker->cancelled[client])
+            worker->cancelled[client]--;
+
+        worker->stats->coalesced++;
+    }
+    else
+    {
+        worker->scheduled[client] = 1;
+    }
+
+    __xf_restore_interrupts(flags);
+
+    return coalesced;
+}
+#endif
+
 /*******************************************************************************
  * Process commands to a proxy
  ******************************************************************************/
@@ -295,7 +395,7 @@ static void *dsp_worker_entry(void *arg)
         {
             int rc = __xf_msgq_recv_blocking(worker->queue, &msg, sizeof(msg)); /* ...wait indefinitely, TENA_2435. */
             
-            if (rc || !msg.component)
+            if (rc || (!msg.component && !msg.msg))
             {
                 TRACE(DISP, _b("dsp_worker_entry thread_exit, worker:%p msgq_err:%x msg.component:%p"), worker, rc, msg.component);
                 break;
@@ -305,7 +405,11 @@ static void *dsp_worker_entry(void *arg)
         if (msg.msg)
         {
             UWORD32 client      = XF_MSG_DST_CLIENT(msg.msg->id);
-            if (xf_client_lookup(cd, client))
+
+            /* ...message has left the queue */
+            xf_worker_msg_release(worker, client);
+
+            if ((msg.component = xf_client_lookup(cd, client)))
             {
                 xf_core_process_message(msg.component, msg.msg);
             }
@@ -331,46 +435,24 @@ static void *dsp_worker_entry(void *arg)
         else
         {
 #ifndef LOCAL_SCHED
-            /* ... base-cancel is required only for global sched-tree */
-            if(!xf_msg_queue_empty(&worker->base_cancel_queue)){
-                UWORD32 flag_found = 0;
-                xf_message_t *mprev;
-                xf_message_t *m = worker->base_cancel_queue.head;
-
-                if(m->buffer == msg.component){
-                    worker->base_cancel_queue.head = m->next;
-
-                    /* ...release the buffer back to pool */
-                    xf_msg_pool_put(&worker->base_cancel_pool, m);
-
-                    /* ...get the next processing node. */
-                    continue;
-                }
-
-                mprev = m;
-                m = m->next;
-
-                while(!flag_found && m){
+            unsigned long flags = __xf_disable_interrupts();
+            UWORD32 cancelled = worker->cancelled[msg.client];
 
-                    if(m->buffer == msg.component){
-                        flag_found = 1;
+            /* ...process request has left the queue */
+            worker->scheduled[msg.client] = 0;
 
-                        /* ...node in the queue is a match, update the queue */
-                        mprev->next = m->next;
+            /* ... base-cancel is required only for global sched-tree */
+            if (cancelled)
+                worker->cancelled[msg.client]--;
 
-                        /* ...release the buffer back to pool */
-                        xf_msg_pool_put(&worker->base_cancel_pool, m);
+            __xf_restore_interrupts(flags);
 
-                        break;
-                    }
-                    mprev = m;
-                    m = m->next;
-                }
+            if (cancelled)
+            {
+                /* ...node was cancelled while in the queue; drop it without touching the component */
 
-                if(flag_found){
-                    /* ...get the next processing node. */
-                    continue;
-                }
+                /* ...get the next processing node. */
+                continue;
             }
 #endif //ifndef LOCAL_SCHED
             /* ...commit the node for processing. */
@@ -404,7 +486,8 @@ static void *dsp_worker_entry(void *arg)
 }
 
 static int xaf_proxy_create_worker(struct xf_worker *worker,
-                                   UWORD32 priority, UWORD32 stack_size)
+                                   UWORD32 priority, UWORD32 stack_size,
+                                   UWORD32 depth, xaf_worker_queue_stats_t *stats)
 {
     int ret;
 
@@ -416,7 +499,7 @@ static int xaf_proxy_create_worker(struct xf_worker *worker,
     worker->stack = NULL;
 #endif /* HAVE_FREERTOS */
 
-    worker->queue = __xf_msgq_create(100, sizeof(xf_worker_msg_t));
+    worker->queue = __xf_msgq_create(depth + XF_WORKER_QUEUE_RESERVED, sizeof(xf_worker_msg_t));
     if (!worker->queue) {
         ret = XAF_INVALIDPTR_ERR;
         goto err_queue;
@@ -426,15 +509,21 @@ static int xaf_proxy_create_worker(struct xf_worker *worker,
     /* ...local-scheduler initialized with DUMMY locks by default */
     xf_sched_init(&worker->sched);
 #else
-    if (xf_msg_pool_init(&worker->base_cancel_pool, XF_CFG_MAX_CLIENTS, worker->core))
-    {
-        ret = XAF_INVALIDPTR_ERR;
-        __xf_msgq_destroy(worker->queue);
-        goto err_queue;
-    }
-    xf_msg_queue_init(&worker->base_cancel_queue);
+    memset(worker->cancelled, 0, sizeof(worker->cancelled));
+    memset(worker->scheduled, 0, sizeof(worker->scheduled));
 #endif //LOCAL_SCHED
 
+    memset(worker->pending, 0, sizeof(worker->pending));
+
+    worker->depth = depth;
+    worker->used = 0;
+    xf_msg_queue_init(&worker->deferred);
+    worker->n_deferred = 0;
+
+    worker->stats = stats;
+    memset(stats, 0, sizeof(*stats));
+    stats->depth = depth;
+
 #ifdef LOCAL_MSGQ
     xf_msg_queue_init(&worker->local_msg_queue);
 #endif
@@ -450,10 +539,6 @@ static int xaf_proxy_create_worker(struct xf_worker *worker,
 err_thread:
     __xf_msgq_destroy(worker->queue);
 
-#ifndef LOCAL_SCHED
-    xf_msg_pool_destroy(&worker->base_cancel_pool, worker->core);
-#endif
-
 err_queue:
 #if !defined(HAVE_FREERTOS)
     xf_mem_free(worker->stack, stack_size, 0, 0);
@@ -467,6 +552,7 @@ static int xf_proxy_set_priorities(UWORD32 core, xf_message_t *m)
     int rc;
     xf_core_data_t *cd = XF_CORE_DATA(core);
     xf_set_priorities_msg_t *cmd = m->buffer;
+    UWORD32 *depth = xf_g_dsp->dsp_thread_args[XF_DSP_THREAD_ARG_IDX_WORKER_QUEUE_DEPTH];
 
     cd->worker = xf_mem_alloc((cmd->n_rt_priorities + 1) * sizeof(struct xf_worker),
                               4, 0, 0);
@@ -476,7 +562,8 @@ static int xf_proxy_set_priorities(UWORD32 core, xf_message_t *m)
         return XAF_MEMORY_ERR;
 
     cd->worker->core = core;
-    rc = xaf_proxy_create_worker(cd->worker, cmd->bg_priority, cmd->stack_size);
+    rc = xaf_proxy_create_worker(cd->worker, cmd->bg_priority, cmd->stack_size,
+                                 depth[0], &xf_g_dsp->worker_queue_stats[0]);
     if (rc < 0)
     {
         TRACE(DISP, _b("dsp_thread_create failed, bgworker:%p priority:%d"), cd->worker, cmd->bg_priority);
@@ -487,7 +574,8 @@ static int xf_proxy_set_priorities(UWORD32 core, xf_message_t *m)
         cd->worker[i+1].core = core;
         rc = xaf_proxy_create_worker(cd->worker + i + 1,
                                      cmd->rt_priority_base + i,
-                                     cmd->stack_size);
+                                     cmd->stack_size,
+                                     depth[i + 1], &xf_g_dsp->worker_queue_stats[i + 1]);
         if (rc < 0)
         {
             TRACE(DISP, _b("dsp_thread_create failed, worker:%p priority:%d"), cd->worker + i + 1, cmd->rt_priority_base + i);
@@ -544,6 +632,90 @@ static int xf_proxy_set_priorities(UWORD32 core, xf_message_t *m)
     return 0;
 }
 
+/* ...issue next command of a transaction, or complete the transaction */
+static void xf_txn_next(xf_message_t *m, xf_txn_msg_t *txn)
+{
+    UWORD32         core = XF_MSG_DST_CORE(txn->id);
+    xf_txn_cmd_t   *cmd;
+
+    if (txn->cur < txn->num)
+    {
+        cmd = &txn->cmd[txn->cur];
+
+        /* ...command appears as issued by App Interface Layer; response is intercepted by DSP proxy */
+        m->id = __XF_MSG_ID(__XF_AP_CLIENT(core, XF_TXN_AP_CLIENT), cmd->dst);
+        m->opcode = cmd->opcode;
+        m->length = cmd->length;
+        m->buffer = (void *)((UWORD32)txn + cmd->offset);
+        m->error = 0;
+
+        TRACE(EXEC, _b("txn[%p]: cmd %u/%u [%08x]:(%08x,%u)"), txn, txn->cur, txn->num, m->id, m->opcode, m->length);
+
+        xf_msg_submit(m);
+    }
+    else
+    {
+        xf_g_dsp->txn_active = NULL;
+
+        /* ...restore transaction message and return it to App Interface Layer */
+        m->id = txn->id;
+        m->opcode = XF_TRANSACTION;
+        m->buffer = txn;
+        m->error = 0;
+
+        xf_response_data(m, txn->length);
+    }
+}
+
+/* ...response to a command issued on behalf of a transaction */
+void xf_txn_complete(xf_message_t *m)
+{
+    xf_txn_msg_t   *txn = xf_g_dsp->txn_active;
+    xf_txn_cmd_t   *cmd;
+
+    BUG(txn == NULL, _x("No active transaction: %08x"), m->id);
+
+    cmd = &txn->cmd[txn->cur++];
+
+    /* ...save response; commands after a failed one are still executed */
+    cmd->opcode = m->opcode;
+    cmd->length = m->length;
+    cmd->error = (m->length == XF_MSG_LENGTH_INVALID && m->error == 0 ? XAF_INVALIDVAL_ERR : m->error);
+
+    xf_txn_next(m, txn);
+}
+
+/* ...execute batch of commands in order */
+static int xf_proxy_transaction(UWORD32 core, xf_message_t *m)
+{
+    xf_txn_msg_t   *txn = m->buffer;
+    UWORD32         i;
+
+    /* ...transactions are serialized by App Interface Layer */
+    XF_CHK_ERR(xf_g_dsp->txn_active == NULL, XAF_INVALIDVAL_ERR);
+
+    /* ...command descriptors and payloads must be within the message */
+    XF_CHK_ERR(txn && m->length >= sizeof(*txn), XAF_INVALIDVAL_ERR);
+    XF_CHK_ERR(txn->num <= (m->length - sizeof(*txn)) / sizeof(xf_txn_cmd_t), XAF_INVALIDVAL_ERR);
+
+    for (i = 0; i < txn->num; i++)
+    {
+        XF_CHK_ERR(txn->cmd[i].offset <= m->length && txn->cmd[i].length <= m->length - txn->cmd[i].offset, XAF_INVALIDVAL_ERR);
+    }
+
+    txn->id = m->id;
+    txn->length = m->length;
+    txn->cur = 0;
+
+    TRACE(EXEC, _b("txn[%p]: %u commands"), txn, txn->num);
+
+    xf_g_dsp->txn_active = txn;
+
+    xf_txn_next(m, txn);
+
+    return 0;
+}
+
 /* ...proxy command processing table */
 static int (* const xf_proxy_cmd[])(UWORD32, xf_message_t *) = 
 {
@@ -557,6 +729,7 @@ static int (* const xf_proxy_cmd[])(UWORD32, xf_message_t *) =
     [XF_OPCODE_TYPE(XF_FLUSH)] = xf_proxy_flush,
 #endif
     [XF_OPCODE_TYPE(XF_SET_PRIORITIES)] = xf_proxy_set_priorities,
+    [XF_OPCODE_TYPE(XF_TRANSACTION)] = xf_proxy_transaction,
 };
 
 /* ...total number of commands supported */
@@ -569,7 +742,7 @@ static void xf_proxy_command(UWORD32 core, xf_message_t *m)
     int     res;
 
     /* ...dispatch command to proper hook */
-    if (XF_OPCODE_TYPE(opcode) < XF_PROXY_CMD_NUM)
+    if (XF_OPCODE_TYPE(opcode) < XF_PROXY_CMD_NUM && xf_proxy_cmd[XF_OPCODE_TYPE(opcode)])
     {
         if ((res = xf_proxy_cmd[XF_OPCODE_TYPE(opcode)](core, m)) >= 0)
         {
@@ -718,11 +891,62 @@ void xf_core_process(xf_component_t *component)
     }
 }
 
+/* ...complete message addressed to a client getting unregistered */
+static void xf_worker_msg_reject(xf_core_data_t *cd, struct xf_worker *worker, UWORD32 client, xf_message_t *m)
+{
+    if (XF_MSG_SRC_PROXY(m->id))
+    {
+        TRACE(DISP, _b("Error response to proxy message id=%08x - client %u:%u getting unregistered"), m->id, worker->core, client);
+        xf_response_err(m);
+    }
+    else if(xf_client_lookup(cd, XF_MSG_SRC_CLIENT(m->id)))
+    {
+        TRACE(DISP, _b("Failure response to message id=%08x - client %u:%u getting unregistered"), m->id, worker->core, client);
+        /* ...send failure response to all messages which are received for client getting unregistered*/
+        xf_response_failure(m);
+    }
+    else
+    {
+        TRACE(DISP, _b("Discard message id=%08x - dest client %u:%u getting unregistered and src client:%u not registered"), m->id, worker->core, client, XF_MSG_SRC_CLIENT(m->id));
+    }
+}
+
 static void xf_worker_queue_purge(xf_core_data_t *cd, UWORD32 client, UWORD32 priority)
 {
     struct xf_worker *worker = cd->worker +priority;
 
     xf_worker_msg_t marker_msg, msg_tmp;
+    xf_msg_queue_t kept, purged;
+    xf_message_t *m;
+    unsigned long flags;
+
+    /* ...take messages of the client out of the deferred list first, they are behind the queue */
+    xf_msg_queue_init(&kept);
+    xf_msg_queue_init(&purged);
+
+    flags = __xf_disable_interrupts();
+
+    while ((m = xf_msg_dequeue(&worker->deferred)) != NULL)
+    {
+        if (XF_MSG_DST_CLIENT(m->id) == client)
+        {
+            xf_msg_enqueue(&purged, m);
+            worker->pending[client]--;
+            worker->n_deferred--;
+        }
+        else
+        {
+            xf_msg_enqueue(&kept, m);
+        }
+    }
+    worker->deferred = kept;
+
+    __xf_restore_interrupts(flags);
+
+    while ((m = xf_msg_dequeue(&purged)) != NULL)
+    {
+        xf_worker_msg_reject(cd, worker, client, m);
+    }
 
     /* ...creating a marker message */
     marker_msg.msg = NULL;
@@ -743,21 +967,10 @@ static void xf_worker_queue_purge(xf_core_data_t *cd, UWORD32 client, UWORD32 pr
         {
             if(XF_MSG_DST_CLIENT(msg_tmp.msg->id) == client)
             {
-                if (XF_MSG_SRC_PROXY(msg_tmp.msg->id))
-                {
-                    TRACE(DISP, _b("Error response to proxy message id=%08x - client %u:%u getting unregistered"), msg_tmp.msg->id, worker->core, client);
-                    xf_response_err(msg_tmp.msg);
-                }
-                else if(xf_client_lookup(cd, XF_MSG_SRC_CLIENT(msg_tmp.msg->id)))
-                {
-                    TRACE(DISP, _b("Failure response to message id=%08x - client %u:%u getting unregistered"), msg_tmp.msg->id, worker->core, client);
-                    /* ...send failure response to all messages which are received for client getting unregistered*/
-                    xf_response_failure(msg_tmp.msg);
-                }
-                else
-                {
-                    TRACE(DISP, _b("Discard message id=%08x - dest client %u:%u getting unregistered and src client:%u not registered"), msg_tmp.msg->id, worker->core, client, XF_MSG_SRC_CLIENT(msg_tmp.msg->id));
-                }
+                /* ...message is taken out of the queue */
+                xf_worker_msg_release(worker, client);
+
+                xf_worker_msg_reject(cd, worker, client, msg_tmp.msg);
                 continue;
             }
        	}
@@ -769,7 +982,12 @@ static void xf_worker_queue_purge(xf_core_data_t *cd, UWORD32 client, UWORD32 pr
 
 static inline void xf_client_cleanup(xf_core_data_t *cd, UWORD32 client, UWORD32 priority)
 {
-    if(cd->n_workers)
+    if(cd->n_workers && cd->worker[priority].pending[client] == 0)
+    {
+        /* ...no message is queued for the client; nothing to purge */
+        xf_client_free(cd, client);
+    }
+    else if(cd->n_workers)
     { 
         /* ...save current priority of thread */
         UWORD32 old_priority = __xf_thread_get_priority(NULL);
@@ -877,18 +1095,32 @@ static void xf_comp_send(xf_component_t *component, xf_message_t *msg)
         else
             xf_core_process(component);
     } else {
-        xf_msgq_t q;
-        xf_worker_msg_t worker_msg = {
-            .component = component,
-            .msg = msg,
-        };
+        struct xf_worker *worker;
 
         if (component->priority < cd->n_workers)
-            q = cd->worker[component->priority].queue;
+            worker = &cd->worker[component->priority];
+        else
+            worker = &cd->worker[cd->n_workers - 1];
+
+        if (msg)
+        {
+            xf_worker_msg_post(worker, component, msg);
+        }
         else
-            q = cd->worker[cd->n_workers - 1].queue;
+        {
+            xf_worker_msg_t worker_msg = {
+                .component = component,
+                .msg = NULL,
+                .client = XF_PORT_CLIENT(component->id),
+            };
 
-        __xf_msgq_send(q, &worker_msg, sizeof(worker_msg));
+#ifndef LOCAL_SCHED
+            /* ...at most one process request per client is queued; it has a reserved slot */
+            if (xf_worker_sched_coalesce(worker, worker_msg.client))
+                return;
+#endif
+            __xf_msgq_send(worker->queue, &worker_msg, sizeof(worker_msg));
+        }
     }
 }
 
@@ -1418,9 +1650,6 @@ int xf_core_deinit(UWORD32 core)
 
             __xf_thread_join(&worker->thread, NULL);
             __xf_thread_destroy(&worker->thread);
-#ifndef LOCAL_SCHED
-            xf_msg_pool_destroy(&worker->base_cancel_pool, core);
-#endif
 #if defined(HAVE_XOS)
             xf_mem_free(worker->stack, stack_size, 0, 0);
 #endif
@@ -63,7 +63,7 @@ int xf_input_port_init(xf_input_port_t *port, UWORD32 size, UWORD32 align, UWORD
     port->flags = XF_INPUT_FLAG_ENABLED | XF_INPUT_FLAG_CREATED;
 
     /* ...mark buffer is empty */
-    port->filled = 0, port->access = NULL;
+    port->filled = 0, port->access = NULL, port->ts = 0;
     
     TRACE(INIT, _b("input-port[%p] created - %p@%u[%u]"), port, port->buffer, align, size);
 
@@ -105,7 +105,7 @@ int xf_input_port_put(xf_input_port_t *port, xf_message_t *m)
     if (xf_msg_enqueue(&port->queue, m))
     {
         /* ...first message put - set access pointer and length */
-        port->access = m->buffer, port->remaining = m->length;
+        port->access = m->buffer, port->remaining = m->length, port->ts = m->ts;
 
 #if 1
         /* ...if first message is empty, mark port is done */
@@ -142,7 +142,7 @@ static inline int xf_input_port_complete(xf_input_port_t *port)
     if ((m = xf_msg_queue_head(&port->queue)) != NULL)
     {
         /* ...set new access pointers */
-        port->access = m->buffer, port->remaining = m->length;
+        port->access = m->buffer, port->remaining = m->length, port->ts = m->ts;
 
         /* ...return indication that there is an input message */
         return 1;
@@ -321,7 +321,7 @@ void xf_input_port_purge(xf_input_port_t *port)
     }
 
     /* ...reset internal buffer position */
-    port->filled = 0, port->access = NULL;
+    port->filled = 0, port->access = NULL, port->ts = 0;
     
     /* ...reset port flags */
     port->flags = (port->flags & ~__XF_INPUT_FLAGS(~0)) | XF_INPUT_FLAG_ENABLED | XF_INPUT_FLAG_CREATED;
@@ -426,6 +426,7 @@ int xf_output_port_route(xf_output_port_t *port, UWORD32 id, UWORD32 n, UWORD32
         m->id = id;
         m->opcode = XF_FILL_THIS_BUFFER;
         m->length = length;
+        m->ts = 0;
         m->buffer = xf_mem_alloc(length, align, core, shared);
 
         /* ...if allocation failed, do a cleanup */
@@ -476,6 +477,21 @@ error:
     return XAF_MEMORY_ERR;
 }
 
+/* ...charge routed port buffers to the owner component */
+void xf_output_port_tag(xf_output_port_t *port, struct xf_mem_acct *acct, UWORD32 type)
+{
+    xf_message_t   *m;
+    UWORD32         i;
+
+    /* ...item #0 is a control message without buffer */
+    for (i = 1; i < port->pool.n; i++)
+    {
+        m = xf_msg_pool_item(&port->pool, i);
+
+        xf_mem_tag(m->buffer, port->length, XF_MSG_SHARED(m->id), acct, type);
+    }
+}
+
 /* ...start output port unrouting sequence */
 void xf_output_port_unroute_start(xf_output_port_t *port, xf_message_t *m)
 {
@@ -577,6 +593,9 @@ int xf_output_port_produce(xf_output_port_t *port, UWORD32 n)
     /* ...it is not permitted to invoke this when port is being unrouted (or flushed - tbd) */
     BUG(xf_output_port_unrouting(port), _x("invalid transaction"));
 
+    /* ...propagate capture timestamp of the payload */
+    m->ts = port->ts;
+
     /* ...complete message with specified amount of bytes produced */
     xf_response_data(m, n);
 
@@ -155,6 +155,7 @@ static UWORD32 xf_shmem_process_input(UWORD32 core)
         m->opcode = command.opcode;
         m->length = command.length;
         m->error  = 0;
+        m->ts     = 0;
         m->buffer = xf_ipc_a2b(core, command.address);
 
         TRACE(CMD, _b("C[%08x]:(%08x,%u,%p,%d)"), m->id, m->opcode, m->length, m->buffer, m->error);
@@ -173,7 +174,7 @@ static UWORD32 xf_shmem_process_input(UWORD32 core)
 }
 
 /* ...send out all pending outgoing responses to the shared memory ring-buffer */
-static UWORD32 xf_shmem_process_output(UWORD32 core)
+static UWORD32 xf_shmem_process_output(UWORD32 core, UWORD32 *count)
 {
     xf_message_t   *m;
     UWORD32             status = 0;
@@ -192,8 +193,8 @@ static UWORD32 xf_shmem_process_output(UWORD32 core)
         if ((m = xf_msg_proxy_get(core)) == NULL)
             break;
 
-        /* ...notify App Interface Layer each time we send it a message (only if it was empty?) */
-        status = XF_PROXY_STATUS_REMOTE | XF_PROXY_STATUS_LOCAL;
+        /* ...App Interface Layer notification is coalesced by the caller */
+        status = XF_PROXY_STATUS_LOCAL;
 
 #if 0
         /* ...need to decide on best strategy - tbd */
@@ -225,8 +226,14 @@ static UWORD32 xf_shmem_process_output(UWORD32 core)
 
         /* ...return message back to the pool */
         xf_msg_pool_put(&XF_CORE_RO_DATA(core)->pool, m);
+
+        (*count)++;
     }
 
+    /* ...App Interface Layer must drain a full queue before anything else can be sent */
+    if (status && __xf_msgq_full(resp_msgq))
+        status |= XF_PROXY_STATUS_REMOTE;
+
     /* ...return interface status change flags */
     return status;
 }
@@ -239,6 +246,9 @@ static UWORD32 xf_shmem_process_output(UWORD32 core)
 void xf_shmem_process_queues(UWORD32 core)
 {
     UWORD32     status;
+    UWORD32     count;
+    UWORD32     unsignaled = 0;
+    UWORD32     ts = 0;
 
     do
     {
@@ -246,23 +256,58 @@ void xf_shmem_process_queues(UWORD32 core)
         XF_PROXY_SYNC_PEER(core);
 
         /* ...send out pending response messages (frees message buffers, so do it first) */
-        status = xf_shmem_process_output(core);
+        count = 0;
+        status = xf_shmem_process_output(core, &count);
 
         /* ...receive and forward incoming command messages (allocates message buffers) */
         status |= xf_shmem_process_input(core);
 
+        /* ...coalesce notifications of the responses sent until count/latency threshold is hit */
+        if (count)
+        {
+            if (unsignaled == 0)
+                ts = xf_timebase_now();
+
+            unsignaled += count;
+            xf_g_dsp->resp_count += count;
+
+            if (unsignaled >= xf_g_dsp->resp_coalesce_count ||
+                (xf_g_dsp->resp_coalesce_usec && xf_timebase_elapsed(ts) >= xf_g_dsp->resp_coalesce_usec))
+            {
+                status |= XF_PROXY_STATUS_REMOTE;
+            }
+        }
+
         /* ...assert remote mailbox interrupt if global update bit is set */
         if (status & XF_PROXY_STATUS_REMOTE)
         {
+            xf_g_dsp->resp_doorbells += (unsignaled ? 1 : 0);
+            unsignaled = 0;
+
             xf_ipi_assert(core);
         }
     }
     while (status);
+
+    /* ...never leave responses unsignaled when going idle */
+    if (unsignaled)
+    {
+        xf_g_dsp->resp_doorbells++;
+
+        xf_ipi_assert(core);
+    }
 }
 
 /* ...completion callback for message originating from App Interface Layer */
 void xf_msg_proxy_complete(xf_message_t *m)
 {
+    /* ...transaction commands are completed on DSP Interface Layer */
+    if (XF_AP_CLIENT(m->id) == XF_TXN_AP_CLIENT)
+    {
+        xf_txn_complete(m);
+        return;
+    }
+
     /* ...place message into proxy response queue */
     xf_msg_proxy_put(m);
 }
@@ -36,6 +36,7 @@
 #include "xaf-api.h"
 #include "xaf-structs.h"
 #include "osal-msgq.h"
+#include "osal-isr.h"
 
 /*******************************************************************************
  * Global Definitions
@@ -135,6 +136,7 @@ int ipc_msgq_delete(xf_msgq_t *cmdq, xf_msgq_t *respq)
 /* ...pass command to remote DSP */
 int xf_ipc_send(xf_proxy_ipc_data_t *ipc, xf_proxy_msg_t *msg, void *b)
 {
+    unsigned long   flags;
 
     TRACE(CMD, _b("C[%08x]:(%x,%08x,%u,%d)"), msg->id, msg->opcode, msg->address, msg->length, msg->error);
 
@@ -143,13 +145,77 @@ int xf_ipc_send(xf_proxy_ipc_data_t *ipc, xf_proxy_msg_t *msg, void *b)
         if (msg->address) XF_PROXY_FLUSH((void *)msg->address, msg->length);
     }
     
+    /* ...make sure DSP drains the queue if a batch fills it up */
+    if (ipc->batch && __xf_msgq_full(ipc->cmd_msgq))
+    {
+        xf_ipc_doorbell(ipc);
+    }
+
     /* ...pass message to xos message queue */
     __xf_msgq_send(ipc->cmd_msgq, msg, sizeof(*msg));
-	__xf_event_set(ipc->msgq_event, CMD_MSGQ_READY);
+
+    flags = __xf_disable_interrupts();
+
+    ipc->cmd_count++;
+
+    if (ipc->batch)
+    {
+        /* ...notification is deferred until the batch is closed */
+        ipc->pending++;
+        __xf_restore_interrupts(flags);
+    }
+    else
+    {
+        ipc->cmd_doorbells++;
+        __xf_restore_interrupts(flags);
+        __xf_event_set(ipc->msgq_event, CMD_MSGQ_READY);
+    }
 
     return 0;
 }
 
+/* ...notify DSP of the commands published in a batch */
+void xf_ipc_doorbell(xf_proxy_ipc_data_t *ipc)
+{
+    unsigned long   flags = __xf_disable_interrupts();
+    UWORD32         pending = ipc->pending;
+
+    ipc->pending = 0;
+    ipc->cmd_doorbells += (pending ? 1 : 0);
+
+    __xf_restore_interrupts(flags);
+
+    if (pending)
+    {
+        TRACE(CMD, _b("doorbell: %u commands"), pending);
+        __xf_event_set(ipc->msgq_event, CMD_MSGQ_READY);
+    }
+}
+
+/* ...open command batch */
+void xf_ipc_batch_begin(xf_proxy_ipc_data_t *ipc)
+{
+    unsigned long   flags = __xf_disable_interrupts();
+
+    ipc->batch++;
+
+    __xf_restore_interrupts(flags);
+}
+
+/* ...close command batch; DSP is notified once all nested batches are closed */
+void xf_ipc_batch_end(xf_proxy_ipc_data_t *ipc)
+{
+    unsigned long   flags = __xf_disable_interrupts();
+    UWORD32         batch = (ipc->batch ? --ipc->batch : 0);
+
+    __xf_restore_interrupts(flags);
+
+    if (batch == 0)
+    {
+        xf_ipc_doorbell(ipc);
+    }
+}
+
 int xf_ipc_wait(xf_proxy_ipc_data_t *ipc, UWORD32 timeout)
 {
     __xf_event_wait_any(ipc->msgq_event, RESP_MSGQ_READY | DIE_MSGQ_ENTRY);
@@ -162,10 +228,16 @@ int xf_ipc_wait(xf_proxy_ipc_data_t *ipc, UWORD32 timeout)
 /* ...read response from proxy - blocking API */
 int xf_ipc_recv(xf_proxy_ipc_data_t *ipc, xf_proxy_msg_t *msg, void **buffer)
 {
+    UWORD32 full = __xf_msgq_full(ipc->resp_msgq);
+
     if (__xf_msgq_empty(ipc->resp_msgq) ||
         __xf_msgq_recv(ipc->resp_msgq, msg, sizeof(*msg)) < 0)
         return 0;
 
+    /* ...DSP holds further responses back while the queue is full; let it resume sending */
+    if (full)
+        __xf_event_set(ipc->msgq_event, CMD_MSGQ_READY);
+
     TRACE(RSP, _b("R[%08x]:(%x,%u,%08x,%d)"), msg->id, msg->opcode, msg->length, msg->address, msg->error);
 
     /* ...translate shared address into local pointer */
@@ -189,6 +261,9 @@ int xf_ipc_open(xf_proxy_ipc_data_t *ipc, UWORD32 core)
     /* ...allocation mustn't fail on App Interface Layer */
     BUG(ipc->lresp_msgq == NULL, _x("Out-of-memeory"));
 
+    ipc->batch = ipc->pending = 0;
+    ipc->cmd_count = ipc->cmd_doorbells = ipc->resp_waits = 0;
+
     TRACE(INIT, _b("proxy-%u interface opened"), core);
 
     return 0;
@@ -45,6 +45,15 @@ typedef struct xf_proxy_ipc_data
     /* ...local response message queue pointer */
     void                   *lresp_msgq;
 
+    /* ...command batch nesting, and commands published without notifying the DSP */
+    UWORD32                 batch;
+    UWORD32                 pending;
+
+    /* ...statistics */
+    UWORD32                 cmd_count;
+    UWORD32                 cmd_doorbells;
+    UWORD32                 resp_waits;
+
 }   xf_proxy_ipc_data_t;
 
 /*******************************************************************************
@@ -92,6 +101,13 @@ extern int xf_ipc_data_destroy(xf_ipc_data_t *ipc);
 /* ...send asynchronous command */
 extern int  xf_ipc_send(xf_proxy_ipc_data_t *ipc, xf_proxy_msg_t *msg, void *b);
 
+/* ...notify DSP of the commands published in a batch */
+extern void xf_ipc_doorbell(xf_proxy_ipc_data_t *ipc);
+
+/* ...open/close a command batch; the DSP is notified once when the outermost batch is closed */
+extern void xf_ipc_batch_begin(xf_proxy_ipc_data_t *ipc);
+extern void xf_ipc_batch_end(xf_proxy_ipc_data_t *ipc);
+
 /* ...wait for response from DSP Interface Layer */
 extern int  xf_ipc_wait(xf_proxy_ipc_data_t *ipc, UWORD32 timeout);
 
@@ -23,8 +23,9 @@
 #include <xtensa/simcall-errno.h>
 #include "xaf-api.h"
 
-/* ...size of auxiliary pool for communication with HiFi */
-#define XAF_AUX_POOL_SIZE                   32
+/* ...size of auxiliary pool for communication with HiFi; every component handle holds one buffer,
+ * so this covers 64 components plus commands in flight */
+#define XAF_AUX_POOL_SIZE                   80
 
 /* ...length of auxiliary pool messages */
 #define XAF_AUX_POOL_MSG_LENGTH             256
@@ -44,6 +45,21 @@
 
 #define XAF_MAX_CONFIG_PARAMS               (XAF_AUX_POOL_MSG_LENGTH >> 3)
 
+/* ...number of chunks of a streamed extended parameter in flight */
+#define XAF_EXT_STREAM_DEPTH                4
+
+/* ...per-chunk message overhead of a streamed extended parameter */
+#define XAF_EXT_STREAM_OVERHEAD             (sizeof(xf_ext_param_msg_t) + sizeof(UWORD32) + sizeof(xaf_ext_chunk_t))
+
+/* ...maximum number of commands recorded in a transaction */
+#define XAF_TXN_MAX_CMDS                    32
+
+/* ...length of transaction buffer holding command descriptors and payloads */
+#define XAF_TXN_BUF_SIZE                    2048
+
+/* ...number of transactions that can be recorded concurrently */
+#define XAF_TXN_POOL_SIZE                   2
+
 #define MAX_IO_PORTS                        (XF_CFG_MAX_IN_PORTS + XF_CFG_MAX_OUT_PORTS)
 #define PORT_NOT_CONNECTED                  (0xFFFFFFFF)
 
@@ -73,6 +89,7 @@ typedef struct xaf_comp_format_s {
 typedef struct xaf_connect_map_s {
     void               *ptr;
     UWORD32             port;
+    UWORD32             num_buf;
 } xaf_connect_map_t;
 
 #ifndef XA_DISABLE_EVENT
@@ -134,6 +151,10 @@ struct xaf_comp {
 #ifndef XA_DISABLE_EVENT
     UWORD32         error_channel_ctl;
 #endif
+
+    /* ...response completion notification, invoked from proxy thread */
+    xaf_comp_completion_fxn_t completion_cb;
+    void           *completion_cb_data;
 };
 
 typedef struct xaf_adev_s {
@@ -161,4 +182,44 @@ typedef struct xaf_adev_s {
 #endif
 
     UWORD32 dsp_thread_priority;
+
+    /* ...signalled by proxy thread on every component response */
+    xf_event_t  completion_event;
+
+    /* ...component polled first by the next xaf_comp_wait_any() */
+    UWORD32 wait_cursor;
+
+    /* ...real-time worker threads set by xaf_adev_set_priorities() */
+    WORD32      n_rt_priorities;
+
+    /* ...transaction buffers, allocated on first xaf_txn_begin() */
+    xf_pool_t   *txn_pool;
 } xaf_adev_t;
+
+/* ...application-side record of a transaction command */
+typedef struct xaf_txn_cmd_s {
+    xaf_comp_t         *p_comp;
+    UWORD32             opcode;
+
+    /* ...get-config results are copied back on commit */
+    WORD32             *p_param;
+    WORD32              num_param;
+
+    /* ...connect peer; connection map is updated on commit */
+    xaf_comp_t         *p_dest;
+    WORD32              src_port;
+    WORD32              dest_port;
+    WORD32              num_buf;
+} xaf_txn_cmd_t;
+
+typedef struct xaf_txn_s {
+    xaf_adev_t         *p_adev;
+
+    /* ...shared buffer holding xf_txn_msg_t followed by payloads */
+    xf_buffer_t        *buf;
+
+    /* ...bytes of transaction buffer used */
+    UWORD32             length;
+
+    xaf_txn_cmd_t       cmd[XAF_TXN_MAX_CMDS];
+} xaf_txn_t;
@@ -74,7 +74,11 @@ extern int      xf_set_config(xf_handle_t *comp, void *buffer, UWORD32 length, U
 extern int      xf_set_config_with_lock(xf_handle_t *comp, void *buffer, UWORD32 length, WORD32 num_param, WORD32 *p_param, UWORD32 cfg_ext_flag);
 extern int      xf_get_config(xf_handle_t *comp, void *buffer, UWORD32 length, UWORD32 cfg_ext_flag);
 extern int      xf_get_config_with_lock(xf_handle_t *comp, void *buffer, UWORD32 length, WORD32 num_param, WORD32 *p_param, UWORD32 cfg_ext_flag);
+extern int      xf_reset(xf_handle_t *comp, void *buffer, WORD32 num_param, WORD32 *p_param);
+extern int      xf_snapshot(xf_handle_t *comp, void *buffer, UWORD32 opcode, void *data, UWORD32 *length);
+extern int      xf_set_config_stream(xf_handle_t *comp, xf_buffer_t **chunk_buf, UWORD32 depth, WORD32 id, xaf_ext_buffer_t *blob, UWORD32 chunk_size);
 extern int      xf_set_priorities(xf_proxy_t *proxy, UWORD32 core, UWORD32 n_rt_priorities, UWORD32 rt_priority_base, UWORD32 bg_priority);
+extern int      xf_transaction(xf_proxy_t *proxy, void *buffer, UWORD32 length);
 
 /* ...shared buffers operations */
 extern int      xf_pool_alloc(xf_proxy_t *proxy, UWORD32 number, UWORD32 length, xf_pool_type_t type, xf_pool_t **pool, WORD32 id);
@@ -86,8 +90,9 @@ extern void     xf_buffer_put(xf_buffer_t *buffer);
 extern int      xf_proxy_init(xf_proxy_t *proxy, UWORD32 core);
 extern void     xf_proxy_close(xf_proxy_t *proxy);
 
-#ifndef DISABLE_EVENT
+#ifndef XA_DISABLE_EVENT
 /* ...event channel operations */
-extern int xf_create_event_channel(xf_handle_t *src, UWORD32 src_config_param, xf_handle_t *dst, UWORD32 dst_config_param, UWORD32 num, UWORD32 size, UWORD32 align);
+extern int xf_create_event_channel(xf_handle_t *src, UWORD32 src_config_param, xf_handle_t *dst, UWORD32 dst_config_param, UWORD32 num, UWORD32 size, UWORD32 align, xaf_event_channel_config_t *cfg);
 extern int xf_delete_event_channel(xf_handle_t *src, UWORD32 src_config_param, xf_handle_t *dst, UWORD32 dst_config_param);
+extern int xf_get_event_channel_stats(xf_handle_t *src, UWORD32 src_config_param, xf_handle_t *dst, UWORD32 dst_config_param, xaf_event_channel_stats_t *stats);
 #endif
@@ -125,6 +125,9 @@ struct xf_pool
     /* ...pointer to first free buffer in a pool */
     xf_buffer_t        *free;
 
+    /* ...free list lock; keeps buffer hand-off off the global proxy lock */
+    xf_lock_t           lock;
+
     /* ...individual buffers */
     xf_buffer_t         buffer[0];
 };
@@ -156,6 +159,25 @@ typedef union xf_proxy_cmap_link
 
 }   xf_proxy_cmap_link_t;
 
+/* ...proxy message delivery thread */
+typedef struct xf_proxy_dispatch
+{
+    /* ...reference to proxy data */
+    xf_proxy_t             *proxy;
+
+    /* ...messages waiting for delivery */
+    xf_msgq_t               msgq;
+
+    /* ...delivery thread handle and stack */
+    xf_thread_t             thread;
+    void                   *stack;
+
+    /* ...barrier used to wait until queued messages are delivered */
+    xf_lock_t               sync_lock;
+    xf_event_t              sync_event;
+
+}   xf_proxy_dispatch_t;
+
 /* ...proxy data structure */
 struct xf_proxy
 {
@@ -178,6 +200,15 @@ struct xf_proxy
     xf_proxy_cmap_link_t    cmap[XF_CFG_PROXY_MAX_CLIENTS];
 
     UWORD32 proxy_thread_priority;
+
+    /* ...response dispatchers; responses of a client are always delivered by the same one */
+    UWORD32                 n_dispatch;
+    xf_proxy_dispatch_t     dispatch[XAF_MAX_DISPATCH_THREADS];
+
+#ifndef XA_DISABLE_EVENT
+    /* ...event delivery, kept off the response path when dispatchers are used */
+    xf_proxy_dispatch_t     event;
+#endif
 };
 
 /*******************************************************************************
@@ -223,6 +254,9 @@ static inline int xf_proxy_response_put(xf_proxy_t *proxy, xf_proxy_msg_t *msg)
 /* ...retrieve asynchronous response message */
 static inline int xf_proxy_response_get(xf_proxy_t *proxy, xf_proxy_msg_t *msg)
 {
+    /* ...commands held in a batch must reach the DSP before blocking on a response */
+    xf_ipc_doorbell(&proxy->ipc);
+
     return __xf_msgq_recv(proxy->ipc.lresp_msgq, msg, sizeof(*msg));
 }
 
@@ -335,6 +369,17 @@ typedef struct {
 
     UWORD32 worker_thread_scratch_size[XAF_MAX_WORKER_THREADS]; /* ...user configurable worker scratch size */
 
+    UWORD32 worker_queue_depth[XAF_MAX_WORKER_THREADS]; /* ...user configurable worker queue depth */
+
+    xaf_worker_queue_stats_t worker_queue_stats[XAF_MAX_WORKER_THREADS];
+
+    UWORD32 resp_coalesce_count;    /* ...responses sent before the application is notified */
+    UWORD32 resp_coalesce_usec;     /* ...age of the oldest response before the application is notified */
+    UWORD32 resp_count;
+    UWORD32 resp_doorbells;
+
+    void *txn_active;               /* ...transaction being executed by DSP proxy */
+
 } xf_dsp_t;
 
 /*******************************************************************************
@@ -362,5 +407,11 @@ static inline int xf_response_put(xf_handle_t *handle, xf_user_msg_t *msg)
 /* ...get asynchronous response from local IPC */
 static inline int xf_response_get(xf_handle_t *handle, xf_user_msg_t *msg)
 {
+    /* ...commands held in a batch must reach the DSP before blocking on a response */
+    xf_ipc_doorbell(&handle->proxy->ipc);
+
+    if (__xf_msgq_empty(handle->ipc.resp_msgq))
+        handle->proxy->ipc.resp_waits++;
+
     return __xf_msgq_recv(handle->ipc.resp_msgq, msg, sizeof(*msg));
 }
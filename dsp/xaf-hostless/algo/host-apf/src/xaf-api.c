@@ -25,6 +25,7 @@
 #include "xaf-structs.h"
 #include "xaf-version.h"
 #include "xaf-threads-priority.h"
+#include "audio/xa-mixer-api.h"
 
 #define MODULE_TAG                      DEVAPI
 
@@ -120,6 +121,9 @@
  * as referred to in ProgrammersGuide */
 #define XA_AUDIO_FRMWK_BUF_SIZE_MIN (16384)
 
+/* ...completion event flag, set by proxy thread on every component response */
+#define XAF_COMP_COMPLETION_EVENT   0x1
+
 xf_ap_t    *xf_g_ap;
 extern xf_dsp_t *xf_g_dsp;
 
@@ -444,8 +448,20 @@ XAF_ERR_CODE xaf_get_verinfo(pUWORD8 ver_info[3])
 
 static void xaf_comp_response(xf_handle_t *h, xf_user_msg_t *msg)
 {
+    xaf_comp_t *p_comp = container_of(h, xaf_comp_t, handle);
+    xaf_adev_t *p_adev = container_of(h->proxy, xaf_adev_t, proxy);
+
     /* ...submit response to asynchronous delivery queue */
     xf_response_put(h, msg);
+
+    /* ...wake up application waiting for any component */
+    __xf_event_set(&p_adev->completion_event, XAF_COMP_COMPLETION_EVENT);
+
+    /* ...notify application; called from proxy thread, so it must not block */
+    if (p_comp->completion_cb)
+    {
+        p_comp->completion_cb((void *)p_comp, p_comp->completion_cb_data);
+    }
 }
 
 static XAF_ERR_CODE xaf_comp_post_init_config(xaf_adev_t *p_adev, xaf_comp_t *p_comp, void *p_msg)
@@ -525,8 +541,14 @@ XAF_ERR_CODE xaf_adev_config_default_init(xaf_adev_config_t *padev_config)
     for(i=0; i<XAF_MAX_WORKER_THREADS; i++)
     {
 	    padev_config->worker_thread_scratch_size[i] = XF_CFG_CODEC_SCRATCHMEM_SIZE;
+	    padev_config->worker_queue_depth[i] = XAF_WORKER_QUEUE_DEPTH;
     }
 
+    padev_config->resp_coalesce_count = XAF_RESP_COALESCE_COUNT;
+    padev_config->resp_coalesce_usec = XAF_RESP_COALESCE_USEC;
+
+    padev_config->proxy_dispatch_threads = XAF_PROXY_DISPATCH_THREADS;
+
     return XAF_NO_ERR;
 }
 
@@ -581,6 +603,18 @@ XAF_ERR_CODE xaf_adev_open(pVOID *pp_adev, xaf_adev_config_t *pconfig)
 #endif
     XAF_CHK_RANGE(dsp_thread_priority, 0, (proxy_thread_priority-1));
 
+    {
+        UWORD32 i;
+
+        /* ...a worker queue must hold at least one message */
+        for(i=0; i<XAF_MAX_WORKER_THREADS; i++)
+        {
+            XAF_CHK_MIN(pconfig->worker_queue_depth[i], 1);
+        }
+    }
+    XAF_CHK_MIN(pconfig->resp_coalesce_count, 1);
+    XAF_CHK_RANGE(pconfig->proxy_dispatch_threads, 0, XAF_MAX_DISPATCH_THREADS);
+
     //Memory allocation for adev struct pointer
     size = (sizeof(xaf_adev_t) +(XAF_4BYTE_ALIGN-1));
     pTmp = mem_malloc(size, XAF_MEM_ID_DEV);
@@ -657,6 +691,20 @@ XAF_ERR_CODE xaf_adev_open(pVOID *pp_adev, xaf_adev_config_t *pconfig)
         }
     }
 
+    xf_g_dsp->dsp_thread_args[XF_DSP_THREAD_ARG_IDX_WORKER_QUEUE_DEPTH] = xf_g_dsp->worker_queue_depth;
+    {
+        UWORD32 i;
+
+        for(i=0; i<XAF_MAX_WORKER_THREADS; i++)
+        {
+            xf_g_dsp->worker_queue_depth[i] = pconfig->worker_queue_depth[i];
+        }
+    }
+
+    xf_g_dsp->resp_coalesce_count = pconfig->resp_coalesce_count;
+    xf_g_dsp->resp_coalesce_usec = pconfig->resp_coalesce_usec;
+    xf_g_dsp->resp_count = xf_g_dsp->resp_doorbells = 0;
+
     p_adev->dsp_thread_priority = dsp_thread_priority;
 #if defined(HAVE_FREERTOS)
     ret = __xf_thread_create(&xf_g_ap->dsp_thread, dsp_thread_entry, (void *)xf_g_dsp->dsp_thread_args, "DSP-thread", NULL, STACK_SIZE, dsp_thread_priority);
@@ -669,6 +717,7 @@ XAF_ERR_CODE xaf_adev_open(pVOID *pp_adev, xaf_adev_config_t *pconfig)
     p_proxy = &p_adev->proxy;
 
     p_proxy->proxy_thread_priority = proxy_thread_priority;
+    p_proxy->n_dispatch = pconfig->proxy_dispatch_threads;
 
     /* ...open DSP proxy - specify "DSP#0" */
     XF_CHK_API(xf_proxy_init(p_proxy, 0));
@@ -686,6 +735,8 @@ XAF_ERR_CODE xaf_adev_open(pVOID *pp_adev, xaf_adev_config_t *pconfig)
 #endif
     xaf_sync_chain_init(&p_adev->comp_chain, (UWORD32)offset_of(xaf_comp_t, next));
 
+    __xf_event_init(&p_adev->completion_event, XAF_COMP_COMPLETION_EVENT);
+
     return XAF_NO_ERR;
 }
 
@@ -799,6 +850,20 @@ XAF_ERR_CODE xaf_adev_open_deprecated(pVOID *pp_adev, WORD32 audio_frmwk_buf_siz
         }
     }
 
+    xf_g_dsp->dsp_thread_args[XF_DSP_THREAD_ARG_IDX_WORKER_QUEUE_DEPTH] = xf_g_dsp->worker_queue_depth;
+    {
+        UWORD32 i;
+
+        for(i=0; i<XAF_MAX_WORKER_THREADS; i++)
+        {
+            xf_g_dsp->worker_queue_depth[i] = XAF_WORKER_QUEUE_DEPTH;
+        }
+    }
+
+    xf_g_dsp->resp_coalesce_count = XAF_RESP_COALESCE_COUNT;
+    xf_g_dsp->resp_coalesce_usec = XAF_RESP_COALESCE_USEC;
+    xf_g_dsp->resp_count = xf_g_dsp->resp_doorbells = 0;
+
     p_adev->dsp_thread_priority = dsp_thread_priority;
 #if defined(HAVE_FREERTOS)
     ret = __xf_thread_create(&xf_g_ap->dsp_thread, dsp_thread_entry, (void *)xf_g_dsp->dsp_thread_args, "DSP-thread", NULL, STACK_SIZE, dsp_thread_priority);
@@ -811,6 +876,7 @@ XAF_ERR_CODE xaf_adev_open_deprecated(pVOID *pp_adev, WORD32 audio_frmwk_buf_siz
     p_proxy = &p_adev->proxy;
 
     p_proxy->proxy_thread_priority = proxy_thread_priority;
+    p_proxy->n_dispatch = XAF_PROXY_DISPATCH_THREADS;
 
     /* ...open DSP proxy - specify "DSP#0" */
     XF_CHK_API(xf_proxy_init(p_proxy, 0));
@@ -828,6 +894,8 @@ XAF_ERR_CODE xaf_adev_open_deprecated(pVOID *pp_adev, WORD32 audio_frmwk_buf_siz
 #endif
     xaf_sync_chain_init(&p_adev->comp_chain, (UWORD32)offset_of(xaf_comp_t, next));
 
+    __xf_event_init(&p_adev->completion_event, XAF_COMP_COMPLETION_EVENT);
+
     return XAF_NO_ERR;
 }
 #endif
@@ -878,6 +946,12 @@ XAF_ERR_CODE xaf_adev_close(pVOID adev_ptr, xaf_adev_close_flag flag)
 #endif
     }
 
+    if(p_adev->txn_pool != NULL)
+    {
+        xf_pool_free(p_adev->txn_pool, XAF_MEM_ID_DEV);
+        p_adev->txn_pool = NULL;
+    }
+
     TRACE(INFO, _b("dsp buffer usage(bytes): component=%d, framework=%d xaf=%d"),\
             xf_g_dsp->dsp_comp_buf_size_peak, xf_g_dsp->dsp_frmwk_buf_size_peak, \
             (xf_g_ap->xaf_memory_used + XAF_DEV_AND_AP_STRUCT_MEM_SIZE -  (xf_g_dsp->xf_dsp_local_buffer_size + xf_g_dsp->xf_ap_shmem_buffer_size)));
@@ -907,6 +981,8 @@ XAF_ERR_CODE xaf_adev_close(pVOID adev_ptr, xaf_adev_close_flag flag)
         xaf_sync_chain_deinit(&p_adev->event_chain);
 #endif
         xaf_sync_chain_deinit(&p_adev->comp_chain);
+
+        __xf_event_destroy(&p_adev->completion_event);
  
         {
           //ferret warning fix; not to use the memory allocated to function pointer xf_mem_free_fxn, after its freed(with free p_apMem).
@@ -935,8 +1011,13 @@ XAF_ERR_CODE xaf_adev_set_priorities(pVOID adev_ptr, WORD32 n_rt_priorities,
     XAF_CHK_RANGE(rt_priority_base, 0, p_adev->dsp_thread_priority);
     XAF_CHK_RANGE((rt_priority_base + n_rt_priorities-1), rt_priority_base, p_adev->dsp_thread_priority);
 
-    return xf_set_priorities(&p_adev->proxy, 0,
-                             n_rt_priorities, rt_priority_base, bg_priority);
+    XF_CHK_API(xf_set_priorities(&p_adev->proxy, 0,
+                             n_rt_priorities, rt_priority_base, bg_priority));
+
+    /* ...worker count used by graph worker assignment */
+    p_adev->n_rt_priorities = n_rt_priorities;
+
+    return XAF_NO_ERR;
 }
 
 XAF_ERR_CODE xaf_comp_config_default_init(xaf_comp_config_t *pcomp_config)
@@ -963,7 +1044,7 @@ XAF_ERR_CODE xaf_comp_config_default_init(xaf_comp_config_t *pcomp_config)
 }
 
 #ifndef XA_DISABLE_EVENT
-static XAF_ERR_CODE xaf_setup_event_channel(xaf_comp_t *src_comp, UWORD32 src_config_param, xaf_comp_t *dest_comp, UWORD32 dst_config_param, UWORD32 nbuf, UWORD32 buf_size)
+static XAF_ERR_CODE xaf_setup_event_channel(xaf_comp_t *src_comp, UWORD32 src_config_param, xaf_comp_t *dest_comp, UWORD32 dst_config_param, UWORD32 nbuf, UWORD32 buf_size, xaf_event_channel_config_t *p_cfg)
 {
     xaf_adev_t  *p_adev;
     xf_app_event_channel_t *p_channel;
@@ -989,7 +1070,7 @@ static XAF_ERR_CODE xaf_setup_event_channel(xaf_comp_t *src_comp, UWORD32 src_co
     if (dest_comp != NULL)
     {
         /* ...channel for event communication between components */
-        XF_CHK_API(xf_create_event_channel(&src_comp->handle, src_config_param, &dest_comp->handle, dst_config_param, nbuf, buf_size, XF_EVENT_BUFFER_ALIGNMENT));
+        XF_CHK_API(xf_create_event_channel(&src_comp->handle, src_config_param, &dest_comp->handle, dst_config_param, nbuf, buf_size, XF_EVENT_BUFFER_ALIGNMENT, p_cfg));
     }
     else
     {
@@ -998,9 +1079,10 @@ static XAF_ERR_CODE xaf_setup_event_channel(xaf_comp_t *src_comp, UWORD32 src_co
         p_channel->event_id_dst = XF_CFG_ID_EVENT_TO_APP;
 
         /* ...create channel at DSP Interface Layer */
-        XF_CHK_API(xf_create_event_channel(&src_comp->handle, src_config_param, NULL, XF_CFG_ID_EVENT_TO_APP, nbuf, buf_size, XF_EVENT_BUFFER_ALIGNMENT));
+        XF_CHK_API(xf_create_event_channel(&src_comp->handle, src_config_param, NULL, XF_CFG_ID_EVENT_TO_APP, nbuf, buf_size, XF_EVENT_BUFFER_ALIGNMENT, p_cfg));
 
-        UWORD32 i, length = buf_size + sizeof(src_config_param);
+        /* ...merged and batched events carry a trailing count */
+        UWORD32 i, length = sizeof(src_config_param) + (p_cfg ? XF_EVENT_CHANNEL_BUF_SIZE(buf_size, p_cfg->coalesce_mode, p_cfg->batch_size) : buf_size);
         xf_buffer_t *event_buf;
         void *p_buf;
 
@@ -1156,6 +1238,7 @@ XAF_ERR_CODE xaf_comp_create(pVOID adev_ptr, pVOID *pp_comp, xaf_comp_config_t *
     {
         p_comp->cmap[i].ptr  = NULL;
         p_comp->cmap[i].port = PORT_NOT_CONNECTED;
+        p_comp->cmap[i].num_buf = 0;
     }
 
     switch (comp_type)
@@ -1167,7 +1250,7 @@ XAF_ERR_CODE xaf_comp_create(pVOID adev_ptr, pVOID *pp_comp, xaf_comp_config_t *
         p_comp->inp_ports = 1; p_comp->out_ports = 1;
         break;
     case XAF_MIXER:
-        p_comp->inp_ports = 4; p_comp->out_ports = 1;
+        p_comp->inp_ports = XA_MIXER_MAX_TRACK_NUMBER; p_comp->out_ports = 1;
         break;
     case XAF_MIMO_PROC_12 ... (XAF_MAX_COMPTYPE-1):
         p_comp->inp_ports  = xf_io_ports[comp_type][0];
@@ -1201,7 +1284,7 @@ XAF_ERR_CODE xaf_comp_create(pVOID adev_ptr, pVOID *pp_comp, xaf_comp_config_t *
         else if(p_comp->error_channel_ctl == XAF_ERR_CHANNEL_ALL)
             error_channel_event_id = XF_CFG_COMP_ERR_ALL;
         
-        XF_CHK_API(xaf_setup_event_channel(p_comp, error_channel_event_id, NULL, 0, pcomp_config->num_err_msg_buf, XF_COMP_ERROR_CHANNEL_BUF_SIZE));
+        XF_CHK_API(xaf_setup_event_channel(p_comp, error_channel_event_id, NULL, 0, pcomp_config->num_err_msg_buf, XF_COMP_ERROR_CHANNEL_BUF_SIZE, NULL));
     }
 #endif
     p_comp->comp_state = XAF_COMP_CREATE;
@@ -1280,6 +1363,7 @@ XAF_ERR_CODE xaf_comp_create_deprecated(pVOID adev_ptr, pVOID *pp_comp, xf_id_t
     {
         p_comp->cmap[i].ptr  = NULL;
         p_comp->cmap[i].port = PORT_NOT_CONNECTED;
+        p_comp->cmap[i].num_buf = 0;
     }
 
     switch (comp_type)
@@ -1291,7 +1375,7 @@ XAF_ERR_CODE xaf_comp_create_deprecated(pVOID adev_ptr, pVOID *pp_comp, xf_id_t
         p_comp->inp_ports = 1; p_comp->out_ports = 1;
         break;
     case XAF_MIXER:
-        p_comp->inp_ports = 4; p_comp->out_ports = 1;
+        p_comp->inp_ports = XA_MIXER_MAX_TRACK_NUMBER; p_comp->out_ports = 1;
         break;
     case XAF_MIMO_PROC_12 ... (XAF_MAX_COMPTYPE-1):
         p_comp->inp_ports  = xf_io_ports[comp_type][0];
@@ -1453,6 +1537,176 @@ XAF_ERR_CODE xaf_comp_set_config_ext(pVOID comp_ptr, WORD32 num_param, WORD32 *p
     return resp_err;
 }
 
+/* ...stream a large extended parameter to the component in fixed-size chunks;
+ * the component keeps processing data between the chunks */
+XAF_ERR_CODE xaf_comp_set_config_stream(pVOID comp_ptr, WORD32 param_id, xaf_ext_buffer_t *p_blob, UWORD32 chunk_size)
+{
+    xaf_comp_t     *p_comp;
+    xaf_adev_t     *p_adev;
+    xf_pool_t      *p_pool;
+    xf_buffer_t    *chunk_buf[XAF_EXT_STREAM_DEPTH];
+    UWORD32         depth, i;
+    WORD32          ret;
+
+    p_comp = (xaf_comp_t *)comp_ptr;
+
+    XAF_CHK_PTR(p_comp);
+    XAF_CHK_PTR(p_blob);
+    XAF_CHK_PTR(p_blob->data);
+    XAF_COMP_STATE_CHK(p_comp);
+    XAF_CHK_RANGE(chunk_size, 1, XAF_MAX_EXT_CFG_BUF_LEN);
+    XAF_CHK_MIN(p_blob->valid_data_size, 1);
+
+    p_adev = (xaf_adev_t *)p_comp->p_adev;
+
+    /* ...chunk size is kept 4-bytes aligned, so are chunk offsets */
+    chunk_size = (chunk_size + 3) & ~3;
+
+    depth = (p_blob->valid_data_size + chunk_size - 1) / chunk_size;
+    depth = (depth < XAF_EXT_STREAM_DEPTH ? depth : XAF_EXT_STREAM_DEPTH);
+
+    /* ...chunk buffers; with zero copy they only carry the descriptors */
+    XF_CHK_API(xf_pool_alloc(&p_adev->proxy, depth, XAF_EXT_STREAM_OVERHEAD + (XAF_CHK_EXT_PARAM_FLAG(p_blob->ext_config_flags, XAF_EXT_PARAM_FLAG_OFFSET_ZERO_COPY) ? 0 : chunk_size), XF_POOL_AUX, &p_pool, XAF_MEM_ID_COMP));
+
+    for (i = 0; i < depth; i++)
+    {
+        chunk_buf[i] = xf_buffer_get(p_pool);
+    }
+
+    ret = xf_set_config_stream(&p_comp->handle, chunk_buf, depth, param_id, p_blob, chunk_size);
+
+    for (i = 0; i < depth; i++)
+    {
+        xf_buffer_put(chunk_buf[i]);
+    }
+
+    xf_pool_free(p_pool, XAF_MEM_ID_COMP);
+
+    return XF_CHK_API(ret);
+}
+
+/* ...re-initialize component with new parameters, keeping its memory and input connections */
+XAF_ERR_CODE xaf_comp_reset(pVOID comp_ptr, WORD32 num_param, pWORD32 p_param)
+{
+    xaf_comp_t          *p_comp;
+    xf_handle_t         *p_handle;
+    WORD32               i;
+    WORD32               resp_err;
+
+    p_comp = (xaf_comp_t *)comp_ptr;
+
+    XAF_CHK_PTR(p_comp);
+    XAF_CHK_RANGE(num_param, 0, XAF_MAX_CONFIG_PARAMS);
+    if (num_param) XAF_CHK_PTR(p_param);
+
+    XAF_COMP_STATE_CHK(p_comp);
+
+    p_handle = &p_comp->handle;
+    XAF_CHK_PTR(p_handle);
+
+    /* ...no runtime initialization or output buffers in flight; queued input buffers are returned as XAF_NEED_INPUT */
+    XF_CHK_ERR(!(p_comp->start_cmd_issued && !p_comp->init_done), XAF_API_ERR);
+    XF_CHK_ERR(!p_comp->exec_cmd_issued || (p_comp->comp_status == XAF_EXEC_DONE), XAF_API_ERR);
+
+    /* ...connected outputs feed the runtime-initialization to the peer; re-create those instead */
+    for (i=p_comp->inp_ports; i<(WORD32)(p_comp->inp_ports + p_comp->out_ports); i++)
+    {
+        if (p_comp->cmap[i].ptr != NULL)
+            return XAF_ROUTING_ERR;
+    }
+
+    /* ...probe can only be enabled before the component is configured */
+    for (i=0; i<num_param; i++)
+    {
+        XF_CHK_ERR((p_param[2*i] != XAF_COMP_CONFIG_PARAM_PROBE_ENABLE), XAF_INVALIDVAL_ERR);
+    }
+
+    /* ...XAF_INVALIDVAL_ERR means the component must be deleted and created again */
+    resp_err = XF_CHK_API(xf_reset(p_handle, xf_buffer_data(p_handle->aux), num_param, p_param));
+
+    /* ...output buffers are sized at the end of the runtime initialization */
+    if (p_comp->outpool)
+    {
+        xf_pool_free(p_comp->outpool, XAF_MEM_ID_COMP);
+        p_comp->outpool = NULL;
+    }
+
+    if (p_comp->probepool)
+    {
+        xf_pool_free(p_comp->probepool, XAF_MEM_ID_COMP);
+        p_comp->probepool = NULL;
+    }
+
+    /* ...component is restarted with XAF_START_FLAG, as after creation */
+    p_comp->init_done        = 0;
+    p_comp->comp_status      = XAF_STARTING;
+    p_comp->start_cmd_issued = 0;
+    p_comp->exec_cmd_issued  = 0;
+    p_comp->expect_out_cmd   = 0;
+    p_comp->input_over       = 0;
+    p_comp->probe_started    = 0;
+
+    return resp_err;
+}
+
+XAF_ERR_CODE xaf_comp_snapshot(pVOID p_comp_ptr, pVOID p_buf, UWORD32 size, UWORD32 *p_length)
+{
+    xaf_comp_t          *p_comp;
+    xf_handle_t         *p_handle;
+    WORD32               resp_err;
+
+    p_comp = (xaf_comp_t *)p_comp_ptr;
+
+    XAF_CHK_PTR(p_comp);
+    XAF_CHK_PTR(p_buf);
+    XAF_CHK_PTR(p_length);
+
+    XAF_COMP_STATE_CHK(p_comp);
+
+    p_handle = &p_comp->handle;
+    XAF_CHK_PTR(p_handle);
+
+    /* ...stream state exists only after runtime initialization */
+    XF_CHK_ERR(p_comp->init_done, XAF_API_ERR);
+
+    /* ...component fills application buffer in place; size is given by XAF_COMP_CONFIG_PARAM_SNAPSHOT_SIZE */
+    *p_length = size;
+    resp_err = XF_CHK_API(xf_snapshot(p_handle, xf_buffer_data(p_handle->aux), XF_SNAPSHOT, p_buf, p_length));
+
+    return resp_err;
+}
+
+XAF_ERR_CODE xaf_comp_restore(pVOID p_comp_ptr, pVOID p_buf, UWORD32 length)
+{
+    xaf_comp_t          *p_comp;
+    xf_handle_t         *p_handle;
+    WORD32               resp_err;
+
+    p_comp = (xaf_comp_t *)p_comp_ptr;
+
+    XAF_CHK_PTR(p_comp);
+    XAF_CHK_PTR(p_buf);
+
+    XAF_COMP_STATE_CHK(p_comp);
+
+    p_handle = &p_comp->handle;
+    XAF_CHK_PTR(p_handle);
+
+    /* ...buffers are bound at runtime initialization; restore into a running component only */
+    XF_CHK_ERR(p_comp->init_done, XAF_API_ERR);
+
+    resp_err = XF_CHK_API(xf_snapshot(p_handle, xf_buffer_data(p_handle->aux), XF_RESTORE, p_buf, &length));
+
+    /* ...stream continues from the restored point; queued input buffers are returned as XAF_NEED_INPUT */
+    p_comp->input_over = 0;
+
+    if (p_comp->comp_status == XAF_EXEC_DONE && p_comp->inpool)
+    {
+        p_comp->comp_status = XAF_NEED_INPUT;
+    }
+
+    return resp_err;
+}
 
 XAF_ERR_CODE xaf_comp_get_config(pVOID comp_ptr, WORD32 num_param, pWORD32 p_param)
 {
@@ -1702,6 +1956,96 @@ XAF_ERR_CODE xaf_comp_get_status(pVOID adev_ptr, pVOID comp_ptr, xaf_comp_status
     return XAF_NO_ERR;
 }
 
+XAF_ERR_CODE xaf_comp_set_completion_cb(pVOID comp_ptr, xaf_comp_completion_fxn_t cb, pVOID cb_data)
+{
+    xaf_comp_t *p_comp;
+
+    p_comp = (xaf_comp_t *)comp_ptr;
+
+    XAF_CHK_PTR(p_comp);
+
+    XAF_COMP_STATE_CHK(p_comp);
+
+    /* ...data is set first, as proxy thread may observe the callback right away */
+    p_comp->completion_cb_data = cb_data;
+    p_comp->completion_cb = cb;
+
+    return XAF_NO_ERR;
+}
+
+XAF_ERR_CODE xaf_comp_wait_any(pVOID adev_ptr, pVOID *pp_comp)
+{
+    xaf_adev_t *p_adev;
+    xaf_comp_t *p_comp, *p_ready;
+    UWORD32 i, ready_idx, pending;
+
+    p_adev = (xaf_adev_t *)adev_ptr;
+
+    XAF_CHK_PTR(p_adev);
+    XAF_CHK_PTR(pp_comp);
+
+    if((p_adev->adev_state < XAF_ADEV_INIT))
+    {
+        return XAF_API_ERR;
+    }
+
+    while (1)
+    {
+        /* ...clear before polling, so that a response delivered meanwhile is not missed */
+        __xf_event_clear(&p_adev->completion_event, XAF_COMP_COMPLETION_EVENT);
+
+        p_ready = NULL;
+        ready_idx = 0;
+        pending = 0;
+
+        /* ...poll components awaiting responses, round-robin from the one returned last */
+        __xf_lock(&p_adev->comp_chain.lock);
+        for (i = 0, p_comp = (xaf_comp_t *)p_adev->comp_chain.head; p_comp != NULL; i++, p_comp = p_comp->next)
+        {
+            if (p_comp->pending_resp == 0)
+                continue;
+
+            pending++;
+
+            if (__xf_msgq_empty(p_comp->handle.ipc.resp_msgq))
+                continue;
+
+            if (p_ready == NULL || i >= p_adev->wait_cursor)
+            {
+                p_ready = p_comp;
+                ready_idx = i;
+            }
+
+            if (i >= p_adev->wait_cursor)
+                break;
+        }
+        __xf_unlock(&p_adev->comp_chain.lock);
+
+        if (p_ready)
+        {
+            p_adev->wait_cursor = ready_idx + 1;
+            *pp_comp = (void *)p_ready;
+
+            return XAF_NO_ERR;
+        }
+
+        /* ...nothing to wait for */
+        if (pending == 0)
+        {
+            *pp_comp = NULL;
+
+            return XAF_API_ERR;
+        }
+
+        /* ...commands held in a batch must reach the DSP before blocking on a response */
+        xf_ipc_doorbell(&p_adev->proxy.ipc);
+
+        p_adev->proxy.ipc.resp_waits++;
+
+        __xf_event_wait_any(&p_adev->completion_event, XAF_COMP_COMPLETION_EVENT);
+    }
+}
+
 XAF_ERR_CODE xaf_comp_process(pVOID adev_ptr, pVOID comp_ptr, pVOID p_buf, UWORD32 length, xaf_comp_flag flag)
 {
     xaf_adev_t *p_adev;
@@ -1887,6 +2231,7 @@ XAF_ERR_CODE xaf_connect(pVOID p_src, WORD32 src_out_port, pVOID p_dest, WORD32
     /* ...update src component map */
     src_comp->cmap[src_out_port].ptr  = dest_comp;
     src_comp->cmap[src_out_port].port = dest_in_port;
+    src_comp->cmap[src_out_port].num_buf = num_buf;
 
     /* ...update dest component map */
     dest_comp->cmap[dest_in_port].ptr  = src_comp;
@@ -1933,6 +2278,7 @@ XAF_ERR_CODE xaf_disconnect(pVOID p_src, WORD32 src_out_port, pVOID p_dest, WORD
     /* ...update src component map */
     src_comp->cmap[src_out_port].ptr  = NULL;
     src_comp->cmap[src_out_port].port = PORT_NOT_CONNECTED;
+    src_comp->cmap[src_out_port].num_buf = 0;
 
     /* ...update dest component map */
     dest_comp->cmap[dest_in_port].ptr  = NULL;
@@ -2000,81 +2346,946 @@ XAF_ERR_CODE xaf_get_mem_stats(pVOID adev_ptr, WORD32 *pmem_info)
     return XAF_NO_ERR;
 }
 
-XAF_ERR_CODE xaf_pause(pVOID comp_ptr, WORD32 port)
+/* ...graph memory planning: all buffers of the graph are laid out in a single arena.
+ * Persistent and input/output memory tables live for the graph lifetime, route
+ * buffers from connect to disconnect, so they are packed back-to-back. Scratch
+ * lifetime is a single process call and components of one worker never execute
+ * concurrently, so their scratch requests overlap and only the largest counts. */
+XAF_ERR_CODE xaf_get_mem_plan(pVOID adev_ptr, xaf_mem_plan_t *p_plan)
 {
-    xaf_comp_t    *p_comp;
-    WORD32         resp_err;
-    
-    p_comp = (xaf_comp_t *)comp_ptr;    
-
-    XAF_CHK_PTR(p_comp);
-    XAF_CHK_RANGE(port, 0, (p_comp->inp_ports + p_comp->out_ports - 1));
- 
-    XAF_COMP_STATE_CHK(p_comp);
-
-    resp_err = XF_CHK_API(xf_pause(&p_comp->handle, port));
-
-    /* ...tbd note paused port */
+    xaf_adev_t *p_adev;
+    xaf_comp_t *p_comp;
+    UWORD32     i;
 
-    return resp_err;
-}
+    XAF_CHK_PTR(p_plan);
+    XAF_CHK_PTR(adev_ptr);
 
-XAF_ERR_CODE xaf_resume(pVOID comp_ptr, WORD32 port)
-{
-    xaf_comp_t    *p_comp;
-    WORD32         resp_err;
-    
-    p_comp = (xaf_comp_t *)comp_ptr;    
+    p_adev = (xaf_adev_t *)adev_ptr;
 
-    XAF_CHK_PTR(p_comp);
-    XAF_CHK_RANGE(port, 0, (p_comp->inp_ports + p_comp->out_ports - 1));
- 
-    XAF_COMP_STATE_CHK(p_comp);
-   
-    /* ...tbd check if the port is paused, else return */ 
+    if((p_adev->adev_state < XAF_ADEV_INIT))
+    {
+        return XAF_API_ERR;
+    }
 
-    resp_err = XF_CHK_API(xf_resume(&p_comp->handle, port));
+    memset(p_plan, 0, sizeof(xaf_mem_plan_t));
 
-    return resp_err;
-}
+    for (p_comp = xaf_sync_chain_get_head(&p_adev->comp_chain); p_comp != NULL; p_comp = p_comp->next)
+    {
+        WORD32  param[] = {
+            XAF_COMP_CONFIG_PARAM_MEMTAB_PERSIST, 0,
+            XAF_COMP_CONFIG_PARAM_MEMTAB_SCRATCH, 0,
+            XAF_COMP_CONFIG_PARAM_MEMTAB_IO,      0,
+            XAF_COMP_CONFIG_PARAM_MEMTAB_WORKER,  0,
+        };
+        UWORD32 worker;
+
+        /* ...memory tables are known once the component is initialized */
+        if (!p_comp->init_done)
+        {
+            TRACE(WARNING, _b("mem-plan: component[%x] skipped, init not done"), p_comp->handle.id);
+            continue;
+        }
 
-XAF_ERR_CODE xaf_probe_start(pVOID comp_ptr)
-{
-    xaf_comp_t    *p_comp;
-    xf_handle_t   *p_handle;
+        XF_CHK_API(xaf_comp_get_config(p_comp, 4, param));
 
-    p_comp = (xaf_comp_t *)comp_ptr;
+        p_plan->persist_size += param[1];
+        p_plan->io_size      += param[5];
 
-    XAF_CHK_PTR(p_comp);
-    if (!p_comp->probe_enabled) return XAF_INVALIDVAL_ERR;
-    if (p_comp->probe_started)  return XAF_API_ERR;
+        worker = (UWORD32)param[7];
+        XF_CHK_ERR(worker < XAF_MAX_WORKER_THREADS, XAF_INVALIDVAL_ERR);
 
-    p_handle = &p_comp->handle;
-    XAF_CHK_PTR(p_handle);
+        if ((UWORD32)param[3] > p_plan->worker_scratch_size[worker])
+        {
+            p_plan->worker_scratch_size[worker] = param[3];
+        }
 
-    XAF_COMP_STATE_CHK(p_comp);
+        /* ...route buffers are owned by the source (output) port */
+        for (i = p_comp->inp_ports; i < p_comp->inp_ports + p_comp->out_ports; i++)
+        {
+            if (p_comp->cmap[i].ptr == NULL)
+                continue;
 
-    XF_CHK_API(xf_resume(p_handle, (p_comp->inp_ports + p_comp->out_ports)));
+            p_plan->route_size += p_comp->cmap[i].num_buf * ((p_comp->out_format.output_length[i - p_comp->inp_ports] + (XAF_8BYTE_ALIGN-1)) & ~(XAF_8BYTE_ALIGN-1));
+        }
+    }
 
-    p_comp->probe_started = 1;
+    for (i = 0; i < XAF_MAX_WORKER_THREADS; i++)
+    {
+        p_plan->scratch_size += p_plan->worker_scratch_size[i];
+    }
 
-    XF_CHK_API(xf_command(p_handle, (p_comp->inp_ports + p_comp->out_ports), XF_FILL_THIS_BUFFER, p_comp->probe_buf, p_comp->probe_length));
+    p_plan->planned_size = p_plan->persist_size + p_plan->io_size + p_plan->route_size + p_plan->scratch_size;
+    p_plan->actual_size  = xf_g_dsp->dsp_comp_buf_size_curr;
 
-    p_comp->pending_resp++;
+    TRACE(INFO, _b("mem-plan: persist=%u io=%u route=%u scratch=%u planned=%u actual=%u"), \
+            p_plan->persist_size, p_plan->io_size, p_plan->route_size, p_plan->scratch_size, p_plan->planned_size, p_plan->actual_size);
 
     return XAF_NO_ERR;
 }
 
-XAF_ERR_CODE xaf_probe_stop(pVOID comp_ptr)
+/* ...current and peak memory charged to the component on DSP, per memory type */
+XAF_ERR_CODE xaf_comp_get_mem_stats(pVOID comp_ptr, xaf_comp_mem_stats_t *p_stats)
 {
-    xaf_comp_t    *p_comp;
-    xf_handle_t   *p_handle;
+    WORD32  param[2 * 2 * XAF_MEM_TYPE_NUM];
+    WORD32  i;
 
-    p_comp = (xaf_comp_t *)comp_ptr;
+    XAF_CHK_PTR(p_stats);
+    XAF_CHK_PTR(comp_ptr);
 
-    XAF_CHK_PTR(p_comp);
-    if (!p_comp->probe_enabled) return XAF_INVALIDVAL_ERR;
-    /* if (!p_comp->probe_started) return XAF_API_ERR; */
+    /* ...fetch all counters with a single get-config */
+    for (i = 0; i < XAF_MEM_TYPE_NUM; i++)
+    {
+        param[2 * i] = XAF_COMP_CONFIG_PARAM_MEM_CURR_PERSIST + i;
+        param[2 * (XAF_MEM_TYPE_NUM + i)] = XAF_COMP_CONFIG_PARAM_MEM_PEAK_PERSIST + i;
+    }
+
+    XF_CHK_API(xaf_comp_get_config(comp_ptr, 2 * XAF_MEM_TYPE_NUM, param));
+
+    for (i = 0; i < XAF_MEM_TYPE_NUM; i++)
+    {
+        p_stats->curr[i] = param[2 * i + 1];
+        p_stats->peak[i] = param[2 * (XAF_MEM_TYPE_NUM + i) + 1];
+    }
+
+    return XAF_NO_ERR;
+}
+
+XAF_ERR_CODE xaf_get_worker_queue_stats(pVOID adev_ptr, UWORD32 worker, xaf_worker_queue_stats_t *p_stats)
+{
+    xaf_adev_t *p_adev;
+
+    XAF_CHK_PTR(p_stats);
+    XAF_CHK_PTR(adev_ptr);
+    XAF_CHK_RANGE(worker, 0, (XAF_MAX_WORKER_THREADS-1));
+
+    p_adev = (xaf_adev_t *)adev_ptr;
+
+    if((p_adev->adev_state < XAF_ADEV_INIT))
+    {
+        return XAF_API_ERR;
+    }
+
+    /* ...statistics are maintained by the DSP worker owning the queue */
+    memcpy(p_stats, &xf_g_dsp->worker_queue_stats[worker], sizeof(xaf_worker_queue_stats_t));
+
+    return XAF_NO_ERR;
+}
+
+XAF_ERR_CODE xaf_get_ipc_stats(pVOID adev_ptr, xaf_ipc_stats_t *p_stats)
+{
+    xaf_adev_t *p_adev;
+
+    XAF_CHK_PTR(p_stats);
+    XAF_CHK_PTR(adev_ptr);
+
+    p_adev = (xaf_adev_t *)adev_ptr;
+
+    if((p_adev->adev_state < XAF_ADEV_INIT))
+    {
+        return XAF_API_ERR;
+    }
+
+    /* ...command side is counted by the App Interface Layer, response side by the DSP */
+    p_stats->cmd_count = p_adev->proxy.ipc.cmd_count;
+    p_stats->cmd_doorbells = p_adev->proxy.ipc.cmd_doorbells;
+    p_stats->resp_count = xf_g_dsp->resp_count;
+    p_stats->resp_doorbells = xf_g_dsp->resp_doorbells;
+    p_stats->resp_waits = p_adev->proxy.ipc.resp_waits;
+
+    return XAF_NO_ERR;
+}
+
+XAF_ERR_CODE xaf_cmd_batch_begin(pVOID adev_ptr)
+{
+    xaf_adev_t *p_adev;
+
+    XAF_CHK_PTR(adev_ptr);
+
+    p_adev = (xaf_adev_t *)adev_ptr;
+
+    if((p_adev->adev_state < XAF_ADEV_INIT))
+    {
+        return XAF_API_ERR;
+    }
+
+    /* ...commands are published without notifying the DSP until the batch is closed */
+    xf_ipc_batch_begin(&p_adev->proxy.ipc);
+
+    return XAF_NO_ERR;
+}
+
+XAF_ERR_CODE xaf_cmd_batch_end(pVOID adev_ptr)
+{
+    xaf_adev_t *p_adev;
+
+    XAF_CHK_PTR(adev_ptr);
+
+    p_adev = (xaf_adev_t *)adev_ptr;
+
+    if((p_adev->adev_state < XAF_ADEV_INIT))
+    {
+        return XAF_API_ERR;
+    }
+
+    xf_ipc_batch_end(&p_adev->proxy.ipc);
+
+    return XAF_NO_ERR;
+}
+
+XAF_ERR_CODE xaf_pause(pVOID comp_ptr, WORD32 port)
+{
+    xaf_comp_t    *p_comp;
+    WORD32         resp_err;
+    
+    p_comp = (xaf_comp_t *)comp_ptr;    
+
+    XAF_CHK_PTR(p_comp);
+    XAF_CHK_RANGE(port, 0, (p_comp->inp_ports + p_comp->out_ports - 1));
+ 
+    XAF_COMP_STATE_CHK(p_comp);
+
+    resp_err = XF_CHK_API(xf_pause(&p_comp->handle, port));
+
+    /* ...tbd note paused port */
+
+    return resp_err;
+}
+
+XAF_ERR_CODE xaf_resume(pVOID comp_ptr, WORD32 port)
+{
+    xaf_comp_t    *p_comp;
+    WORD32         resp_err;
+    
+    p_comp = (xaf_comp_t *)comp_ptr;    
+
+    XAF_CHK_PTR(p_comp);
+    XAF_CHK_RANGE(port, 0, (p_comp->inp_ports + p_comp->out_ports - 1));
+ 
+    XAF_COMP_STATE_CHK(p_comp);
+   
+    /* ...tbd check if the port is paused, else return */ 
+
+    resp_err = XF_CHK_API(xf_resume(&p_comp->handle, port));
+
+    return resp_err;
+}
+
+/* ...reserve next command of a transaction and its payload area */
+static XAF_ERR_CODE xaf_txn_add(xaf_txn_t *p_txn, xaf_comp_t *p_comp, WORD32 port, UWORD32 opcode, UWORD32 length, void **pp_payload)
+{
+    xf_txn_msg_t    *txn = xf_buffer_data(p_txn->buf);
+    xf_txn_cmd_t    *cmd;
+    UWORD32          size = (length + (XAF_4BYTE_ALIGN - 1)) & ~(XAF_4BYTE_ALIGN - 1);
+
+    XF_CHK_ERR((txn->num < XAF_TXN_MAX_CMDS), XAF_MEMORY_ERR);
+    XF_CHK_ERR((p_txn->length + size <= xf_buffer_length(p_txn->buf)), XAF_MEMORY_ERR);
+
+    cmd = &txn->cmd[txn->num];
+    cmd->dst    = __XF_PORT_SPEC2(p_comp->handle.id, port);
+    cmd->opcode = opcode;
+    cmd->offset = p_txn->length;
+    cmd->length = length;
+    cmd->error  = 0;
+
+    memset(&p_txn->cmd[txn->num], 0, sizeof(xaf_txn_cmd_t));
+    p_txn->cmd[txn->num].p_comp = p_comp;
+    p_txn->cmd[txn->num].opcode = opcode;
+
+    if (pp_payload != NULL)
+    {
+        *pp_payload = (void *)((UWORD32)txn + cmd->offset);
+    }
+
+    p_txn->length += size;
+    txn->num++;
+
+    return XAF_NO_ERR;
+}
+
+/* ...release transaction buffer and application record */
+static void xaf_txn_release(xaf_txn_t *p_txn)
+{
+    xf_buffer_put(p_txn->buf);
+    xaf_free(p_txn, XAF_MEM_ID_DEV);
+}
+
+XAF_ERR_CODE xaf_txn_begin(pVOID adev_ptr, pVOID *pp_txn)
+{
+    xaf_adev_t  *p_adev;
+    xaf_txn_t   *p_txn;
+    xf_pool_t   *p_pool = NULL;
+    xf_buffer_t *b;
+    void        *pTmp;
+    WORD32       ret;
+
+    XAF_CHK_PTR(adev_ptr);
+    XAF_CHK_PTR(pp_txn);
+
+    p_adev = (xaf_adev_t *)adev_ptr;
+
+    if((p_adev->adev_state < XAF_ADEV_INIT))
+    {
+        return XAF_API_ERR;
+    }
+
+    /* ...transaction buffers are only paid for by applications using them; the pool is allocated
+     * without holding the component chain lock, as allocation is a round trip to the DSP */
+    if (p_adev->txn_pool == NULL)
+    {
+        ret = xf_pool_alloc(&p_adev->proxy, XAF_TXN_POOL_SIZE, XAF_TXN_BUF_SIZE, XF_POOL_AUX, &p_pool, XAF_MEM_ID_DEV);
+        if (ret != 0)
+        {
+            TRACE(ERROR, _x("Transaction pool allocation failed: %d"), ret);
+            return XAF_MEMORY_ERR;
+        }
+
+        __xf_lock(&p_adev->comp_chain.lock);
+
+        if (p_adev->txn_pool == NULL)
+        {
+            p_adev->txn_pool = p_pool;
+            p_pool = NULL;
+        }
+
+        __xf_unlock(&p_adev->comp_chain.lock);
+
+        /* ...another thread installed its pool first */
+        if (p_pool != NULL)
+        {
+            xf_pool_free(p_pool, XAF_MEM_ID_DEV);
+        }
+    }
+
+    XF_CHK_ERR((b = xf_buffer_get(p_adev->txn_pool)) != NULL, XAF_MEMORY_ERR);
+
+    ret = xaf_malloc(&pTmp, sizeof(xaf_txn_t), XAF_MEM_ID_DEV);
+    if(ret != XAF_NO_ERR)
+    {
+        xf_buffer_put(b);
+        return ret;
+    }
+
+    p_txn = (xaf_txn_t *)pTmp;
+    p_txn->p_adev = p_adev;
+    p_txn->buf = b;
+
+    /* ...payloads follow the full descriptor table */
+    p_txn->length = sizeof(xf_txn_msg_t) + sizeof(xf_txn_cmd_t) * XAF_TXN_MAX_CMDS;
+
+    memset(xf_buffer_data(b), 0, sizeof(xf_txn_msg_t));
+
+    *pp_txn = p_txn;
+
+    return XAF_NO_ERR;
+}
+
+XAF_ERR_CODE xaf_txn_set_config(pVOID txn_ptr, pVOID comp_ptr, WORD32 num_param, pWORD32 p_param)
+{
+    xaf_txn_t           *p_txn;
+    xaf_comp_t          *p_comp;
+    xf_set_param_msg_t  *smsg;
+    WORD32               i, j;
+
+    p_txn  = (xaf_txn_t *)txn_ptr;
+    p_comp = (xaf_comp_t *)comp_ptr;
+
+    XAF_CHK_PTR(p_txn);
+    XAF_CHK_PTR(p_comp);
+    XAF_CHK_PTR(p_param);
+    XAF_CHK_RANGE(num_param, 1, XAF_MAX_CONFIG_PARAMS);
+
+    XAF_COMP_STATE_CHK(p_comp);
+    XF_CHK_ERR((p_comp->p_adev == p_txn->p_adev), XAF_INVALIDPTR_ERR);
+
+    /*...necessary checks required in API */
+    for (i = 0, j = 0; i < num_param; i++, j += 2)
+    {
+        if (p_param[j] == XAF_COMP_CONFIG_PARAM_DEC_INIT_WO_INP)
+            XF_CHK_ERR((p_comp->comp_type == XAF_DECODER), XAF_INVALIDVAL_ERR);
+    }
+
+    XF_CHK_API(xaf_txn_add(p_txn, p_comp, 0, XF_SET_PARAM, sizeof(xf_set_param_item_t) * num_param, (void **)&smsg));
+
+    for (i = 0, j = 0; i < num_param; i++)
+    {
+        smsg->item[i].id    = p_param[j++];
+        smsg->item[i].value = p_param[j++];
+
+        if ((smsg->item[i].id == XAF_COMP_CONFIG_PARAM_PROBE_ENABLE) && (smsg->item[i].value))
+            p_comp->probe_enabled = 1;
+    }
+
+    return XAF_NO_ERR;
+}
+
+XAF_ERR_CODE xaf_txn_get_config(pVOID txn_ptr, pVOID comp_ptr, WORD32 num_param, pWORD32 p_param)
+{
+    xaf_txn_t           *p_txn;
+    xaf_comp_t          *p_comp;
+    xf_get_param_msg_t  *smsg;
+    xaf_txn_cmd_t       *p_cmd;
+    WORD32               i, k;
+
+    p_txn  = (xaf_txn_t *)txn_ptr;
+    p_comp = (xaf_comp_t *)comp_ptr;
+
+    XAF_CHK_PTR(p_txn);
+    XAF_CHK_PTR(p_comp);
+    XAF_CHK_PTR(p_param);
+    XAF_CHK_RANGE(num_param, 1, XAF_MAX_CONFIG_PARAMS);
+
+    XAF_COMP_STATE_CHK(p_comp);
+    XF_CHK_ERR((p_comp->p_adev == p_txn->p_adev), XAF_INVALIDPTR_ERR);
+
+    XF_CHK_API(xaf_txn_add(p_txn, p_comp, 0, XF_GET_PARAM, XF_GET_PARAM_CMD_LEN(num_param), (void **)&smsg));
+
+    for (i = 0, k = 0; i < num_param; i++, k += 2)
+    {
+        smsg->c.id[i] = p_param[k];
+        p_param[k+1] = 0;
+    }
+
+    /* ...values are returned to the application on commit */
+    p_cmd = &p_txn->cmd[((xf_txn_msg_t *)xf_buffer_data(p_txn->buf))->num - 1];
+    p_cmd->p_param   = p_param;
+    p_cmd->num_param = num_param;
+
+    return XAF_NO_ERR;
+}
+
+XAF_ERR_CODE xaf_txn_pause(pVOID txn_ptr, pVOID comp_ptr, WORD32 port)
+{
+    xaf_txn_t     *p_txn;
+    xaf_comp_t    *p_comp;
+
+    p_txn  = (xaf_txn_t *)txn_ptr;
+    p_comp = (xaf_comp_t *)comp_ptr;
+
+    XAF_CHK_PTR(p_txn);
+    XAF_CHK_PTR(p_comp);
+    XAF_CHK_RANGE(port, 0, (p_comp->inp_ports + p_comp->out_ports - 1));
+
+    XAF_COMP_STATE_CHK(p_comp);
+    XF_CHK_ERR((p_comp->p_adev == p_txn->p_adev), XAF_INVALIDPTR_ERR);
+
+    return xaf_txn_add(p_txn, p_comp, port, XF_PAUSE, 0, NULL);
+}
+
+XAF_ERR_CODE xaf_txn_resume(pVOID txn_ptr, pVOID comp_ptr, WORD32 port)
+{
+    xaf_txn_t     *p_txn;
+    xaf_comp_t    *p_comp;
+
+    p_txn  = (xaf_txn_t *)txn_ptr;
+    p_comp = (xaf_comp_t *)comp_ptr;
+
+    XAF_CHK_PTR(p_txn);
+    XAF_CHK_PTR(p_comp);
+    XAF_CHK_RANGE(port, 0, (p_comp->inp_ports + p_comp->out_ports - 1));
+
+    XAF_COMP_STATE_CHK(p_comp);
+    XF_CHK_ERR((p_comp->p_adev == p_txn->p_adev), XAF_INVALIDPTR_ERR);
+
+    return xaf_txn_add(p_txn, p_comp, port, XF_RESUME, 0, NULL);
+}
+
+XAF_ERR_CODE xaf_txn_connect(pVOID txn_ptr, pVOID p_src, WORD32 src_out_port, pVOID p_dest, WORD32 dest_in_port, WORD32 num_buf)
+{
+    xaf_txn_t           *p_txn;
+    xaf_comp_t          *src_comp;
+    xaf_comp_t          *dest_comp;
+    xf_route_port_msg_t *m;
+    xaf_txn_cmd_t       *p_cmd;
+    UWORD32              size;
+    UWORD32              i;
+
+    p_txn     = (xaf_txn_t *) txn_ptr;
+    src_comp  = (xaf_comp_t *) p_src;
+    dest_comp = (xaf_comp_t *) p_dest;
+
+    XAF_CHK_PTR(p_txn);
+    XAF_CHK_PTR(src_comp);
+    XAF_CHK_PTR(dest_comp);
+    XAF_CHK_RANGE(num_buf, 1, 1024);
+
+    XAF_COMP_STATE_CHK(src_comp);
+    XAF_COMP_STATE_CHK(dest_comp);
+    XF_CHK_ERR((src_comp->p_adev == p_txn->p_adev && dest_comp->p_adev == p_txn->p_adev), XAF_INVALIDPTR_ERR);
+
+    if (!src_comp->init_done)
+        return XAF_ROUTING_ERR;
+
+    /* ...src output port number validity check */
+    if (src_out_port < (WORD32)src_comp->inp_ports || src_out_port >= (WORD32)(src_comp->inp_ports + src_comp->out_ports))
+        return XAF_ROUTING_ERR;
+
+    /* ...dest input port number validity check */
+    if (dest_in_port < 0 || dest_in_port >= (WORD32)dest_comp->inp_ports)
+        return XAF_ROUTING_ERR;
+
+    /* ...src component connection validity check */
+    if (src_comp->cmap[src_out_port].ptr != NULL || src_comp->cmap[src_out_port].port != PORT_NOT_CONNECTED)
+        return XAF_ROUTING_ERR;
+
+    /* ...dest component connection validity check */
+    if (dest_comp->cmap[dest_in_port].ptr != NULL || dest_comp->cmap[dest_in_port].port != PORT_NOT_CONNECTED)
+        return XAF_ROUTING_ERR;
+
+    /* ...connection maps are updated on commit; ports must not be connected earlier in this transaction either */
+    for (i = 0; i < ((xf_txn_msg_t *)xf_buffer_data(p_txn->buf))->num; i++)
+    {
+        p_cmd = &p_txn->cmd[i];
+
+        if (p_cmd->opcode != XF_ROUTE) continue;
+
+        if ((p_cmd->p_comp == src_comp && p_cmd->src_port == src_out_port) || (p_cmd->p_dest == dest_comp && p_cmd->dest_port == dest_in_port))
+            return XAF_ROUTING_ERR;
+    }
+
+    size = src_comp->out_format.output_length[src_out_port - src_comp->inp_ports];
+    XF_CHK_ERR((size != 0), XAF_INVALIDVAL_ERR);
+
+    XF_CHK_API(xaf_txn_add(p_txn, src_comp, src_out_port, XF_ROUTE, sizeof(*m), (void **)&m));
+
+    m->dst = __XF_PORT_SPEC2(dest_comp->handle.id, dest_in_port);
+    m->alloc_number = num_buf;
+    m->alloc_size = size;
+    m->alloc_align = 8;
+
+    /* ...connection maps are updated once the route is established */
+    p_cmd = &p_txn->cmd[((xf_txn_msg_t *)xf_buffer_data(p_txn->buf))->num - 1];
+    p_cmd->p_dest    = dest_comp;
+    p_cmd->src_port  = src_out_port;
+    p_cmd->dest_port = dest_in_port;
+    p_cmd->num_buf   = num_buf;
+
+    return XAF_NO_ERR;
+}
+
+XAF_ERR_CODE xaf_txn_commit(pVOID txn_ptr, WORD32 *p_status)
+{
+    xaf_txn_t       *p_txn;
+    xf_txn_msg_t    *txn;
+    xf_txn_cmd_t    *cmd;
+    xaf_txn_cmd_t   *p_cmd;
+    WORD32           status, resp_err;
+    UWORD32          i;
+    WORD32           j;
+
+    p_txn = (xaf_txn_t *)txn_ptr;
+
+    XAF_CHK_PTR(p_txn);
+
+    txn = xf_buffer_data(p_txn->buf);
+
+    if (txn->num == 0)
+    {
+        xaf_txn_release(p_txn);
+        return XAF_NO_ERR;
+    }
+
+    /* ...execute all commands in one round trip */
+    resp_err = xf_transaction(&p_txn->p_adev->proxy, txn, p_txn->length);
+    if (resp_err != 0)
+    {
+        TRACE(ERROR, _x("Transaction failed: %d"), resp_err);
+        xaf_txn_release(p_txn);
+        return XAF_API_ERR;
+    }
+
+    resp_err = XAF_NO_ERR;
+
+    for (i = 0; i < txn->num; i++)
+    {
+        cmd   = &txn->cmd[i];
+        p_cmd = &p_txn->cmd[i];
+
+        /* ...command failed if component replied with a different opcode */
+        status = (cmd->opcode == p_cmd->opcode ? cmd->error : XAF_INVALIDVAL_ERR);
+
+        if (status == XAF_NO_ERR)
+        {
+            if (p_cmd->opcode == XF_GET_PARAM)
+            {
+                xf_get_param_msg_t *smsg = (xf_get_param_msg_t *)((UWORD32)txn + cmd->offset);
+
+                for (j = 0; j < p_cmd->num_param; j++)
+                {
+                    p_cmd->p_param[2 * j + 1] = smsg->r.value[j];
+                }
+            }
+            else if (p_cmd->opcode == XF_ROUTE)
+            {
+                /* ...update src component map */
+                p_cmd->p_comp->cmap[p_cmd->src_port].ptr  = p_cmd->p_dest;
+                p_cmd->p_comp->cmap[p_cmd->src_port].port = p_cmd->dest_port;
+                p_cmd->p_comp->cmap[p_cmd->src_port].num_buf = p_cmd->num_buf;
+
+                /* ...update dest component map */
+                p_cmd->p_dest->cmap[p_cmd->dest_port].ptr  = p_cmd->p_comp;
+                p_cmd->p_dest->cmap[p_cmd->dest_port].port = p_cmd->src_port;
+            }
+        }
+        else if (resp_err == XAF_NO_ERR)
+        {
+            resp_err = status;
+        }
+
+        if (p_status != NULL)
+        {
+            p_status[i] = status;
+        }
+    }
+
+    xaf_txn_release(p_txn);
+
+    return resp_err;
+}
+
+XAF_ERR_CODE xaf_txn_abort(pVOID txn_ptr)
+{
+    XAF_CHK_PTR(txn_ptr);
+
+    xaf_txn_release((xaf_txn_t *)txn_ptr);
+
+    return XAF_NO_ERR;
+}
+
+/* ...check graph description and sort components so that every source precedes its destinations */
+static XAF_ERR_CODE xaf_graph_check(xaf_graph_t *p_graph, WORD32 *order, WORD32 *depth)
+{
+    WORD32  nin[XAF_GRAPH_MAX_COMP];
+    WORD32  i, j, head, tail;
+
+    XAF_CHK_PTR(p_graph);
+    XAF_CHK_PTR(p_graph->comp);
+    XAF_CHK_RANGE(p_graph->num_comp, 1, XAF_GRAPH_MAX_COMP);
+    XAF_CHK_RANGE(p_graph->num_conn, 0, XAF_GRAPH_MAX_CONN);
+    if (p_graph->num_conn) XAF_CHK_PTR(p_graph->conn);
+
+    for (i = 0; i < p_graph->num_comp; i++)
+    {
+        xaf_graph_comp_t *p_gcomp = &p_graph->comp[i];
+
+        XAF_CHK_PTR(p_gcomp->config.comp_id);
+        XAF_CHK_RANGE(p_gcomp->num_param, 0, XAF_MAX_CONFIG_PARAMS - (p_gcomp->priority >= 0 || p_gcomp->priority == XAF_GRAPH_PRIORITY_AUTO));
+        if (p_gcomp->num_param) XAF_CHK_PTR(p_gcomp->p_param);
+        XAF_CHK_MIN(p_gcomp->priority, XAF_GRAPH_PRIORITY_AUTO);
+
+        /* ...initialization of components fed by the application needs input */
+        if (p_gcomp->config.num_input_buffers) XAF_CHK_PTR(p_gcomp->init_input_cb);
+
+        nin[i] = 0;
+        depth[i] = 0;
+    }
+
+    for (i = 0; i < p_graph->num_conn; i++)
+    {
+        xaf_graph_conn_t *p_conn = &p_graph->conn[i];
+
+        XAF_CHK_RANGE(p_conn->src, 0, p_graph->num_comp - 1);
+        XAF_CHK_RANGE(p_conn->dest, 0, p_graph->num_comp - 1);
+        XAF_CHK_RANGE(p_conn->num_buf, 0, 1024);
+        XF_CHK_ERR((p_conn->src != p_conn->dest), XAF_ROUTING_ERR);
+
+        /* ...each port is connected at most once */
+        for (j = 0; j < i; j++)
+        {
+            XF_CHK_ERR(!(p_graph->conn[j].src == p_conn->src && p_graph->conn[j].src_out_port == p_conn->src_out_port), XAF_ROUTING_ERR);
+            XF_CHK_ERR(!(p_graph->conn[j].dest == p_conn->dest && p_graph->conn[j].dest_in_port == p_conn->dest_in_port), XAF_ROUTING_ERR);
+        }
+
+        nin[p_conn->dest]++;
+    }
+
+    /* ...topological sort; components left over are on a cycle */
+    for (i = 0, tail = 0; i < p_graph->num_comp; i++)
+    {
+        if (nin[i] == 0) order[tail++] = i;
+    }
+
+    for (head = 0; head < tail; head++)
+    {
+        for (j = 0; j < p_graph->num_conn; j++)
+        {
+            xaf_graph_conn_t *p_conn = &p_graph->conn[j];
+
+            if (p_conn->src != order[head]) continue;
+
+            if (depth[p_conn->dest] < depth[p_conn->src] + 1)
+                depth[p_conn->dest] = depth[p_conn->src] + 1;
+
+            if (--nin[p_conn->dest] == 0) order[tail++] = p_conn->dest;
+        }
+    }
+
+    XF_CHK_ERR((tail == p_graph->num_comp), XAF_ROUTING_ERR);
+
+    return XAF_NO_ERR;
+}
+
+/* ...set configuration of a graph component, spilling into a new transaction when the current one is full */
+static XAF_ERR_CODE xaf_graph_txn_set_config(xaf_adev_t *p_adev, void **pp_txn, void *p_comp, WORD32 num_param, WORD32 *p_param)
+{
+    WORD32 ret;
+
+    ret = xaf_txn_set_config(*pp_txn, p_comp, num_param, p_param);
+
+    if (ret == XAF_MEMORY_ERR)
+    {
+        ret = xaf_txn_commit(*pp_txn, NULL);
+        *pp_txn = NULL;
+        XF_CHK_API(ret);
+        XF_CHK_API(xaf_txn_begin(p_adev, pp_txn));
+        ret = xaf_txn_set_config(*pp_txn, p_comp, num_param, p_param);
+    }
+
+    return ret;
+}
+
+/* ...start component and supply its initialization input until it is ready to be connected */
+static XAF_ERR_CODE xaf_graph_comp_init(xaf_adev_t *p_adev, xaf_graph_comp_t *p_gcomp, WORD32 idx, xaf_comp_t *p_comp)
+{
+    xaf_comp_status status;
+    WORD32          info[4];
+    WORD32          length;
+    UWORD32         i;
+
+    XF_CHK_API(xaf_comp_process(p_adev, p_comp, NULL, 0, XAF_START_FLAG));
+
+    for (i = 0; i < p_comp->ninbuf; i++)
+    {
+        length = p_gcomp->init_input_cb(p_gcomp->init_input_cb_data, idx, p_comp->p_input[i], XAF_INBUF_SIZE);
+        XF_CHK_ERR((length > 0 && length <= XAF_INBUF_SIZE), XAF_INVALIDVAL_ERR);
+        XF_CHK_API(xaf_comp_process(p_adev, p_comp, p_comp->p_input[i], length, XAF_INPUT_READY_FLAG));
+    }
+
+    while (1)
+    {
+        XF_CHK_API(xaf_comp_get_status(p_adev, p_comp, &status, &info[0]));
+
+        if (status == XAF_INIT_DONE) break;
+
+        XF_CHK_ERR((status == XAF_NEED_INPUT && p_comp->ninbuf), XAF_API_ERR);
+
+        length = p_gcomp->init_input_cb(p_gcomp->init_input_cb_data, idx, (void *)info[0], XAF_INBUF_SIZE);
+        XF_CHK_ERR((length > 0 && length <= XAF_INBUF_SIZE), XAF_INVALIDVAL_ERR);
+        XF_CHK_API(xaf_comp_process(p_adev, p_comp, (void *)info[0], length, XAF_INPUT_READY_FLAG));
+    }
+
+    return XAF_NO_ERR;
+}
+
+static XAF_ERR_CODE xaf_graph_instantiate(xaf_adev_t *p_adev, xaf_graph_t *p_graph, xaf_comp_t **pp_comp, WORD32 *order, WORD32 *depth)
+{
+    WORD32  prio[XAF_GRAPH_MAX_COMP];
+    WORD32  param[XAF_MAX_CONFIG_PARAMS * 2];
+    void   *p_txn = NULL;
+    WORD32  i, j, k, n, ret;
+
+    /* ...create components; each creation is a round trip as the DSP assigns component handles */
+    for (k = 0; k < p_graph->num_comp; k++)
+    {
+        i = order[k];
+        XF_CHK_API(xaf_comp_create(p_adev, (void **)&pp_comp[i], &p_graph->comp[i].config));
+    }
+
+    /* ...port numbers are known once components exist */
+    for (j = 0; j < p_graph->num_conn; j++)
+    {
+        xaf_graph_conn_t *p_conn = &p_graph->conn[j];
+        xaf_comp_t       *src_comp = pp_comp[p_conn->src];
+        xaf_comp_t       *dest_comp = pp_comp[p_conn->dest];
+
+        if (p_conn->src_out_port < (WORD32)src_comp->inp_ports || p_conn->src_out_port >= (WORD32)(src_comp->inp_ports + src_comp->out_ports))
+            return XAF_ROUTING_ERR;
+
+        if (p_conn->dest_in_port < 0 || p_conn->dest_in_port >= (WORD32)dest_comp->inp_ports)
+            return XAF_ROUTING_ERR;
+    }
+
+    /* ...worker assignment; with automatic priority every pipeline stage goes to the next worker, so that
+     * stages run concurrently and downstream stages drain their input ahead of upstream ones */
+    for (i = 0; i < p_graph->num_comp; i++)
+    {
+        prio[i] = p_graph->comp[i].priority;
+
+        if (prio[i] == XAF_GRAPH_PRIORITY_AUTO)
+        {
+            prio[i] = (p_adev->n_rt_priorities > 0 ? (depth[i] < p_adev->n_rt_priorities ? depth[i] : p_adev->n_rt_priorities - 1) : XAF_GRAPH_PRIORITY_DEFAULT);
+        }
+    }
+
+    /* ...configuration of all components; priority goes with the other parameters, as every pre-init
+     * set-config reverts the component to the default worker */
+    XF_CHK_API(xaf_txn_begin(p_adev, &p_txn));
+
+    for (k = 0; k < p_graph->num_comp; k++)
+    {
+        i = order[k];
+        n = p_graph->comp[i].num_param;
+
+        if (n) memcpy(param, p_graph->comp[i].p_param, n * 2 * sizeof(WORD32));
+
+        if (prio[i] >= 0)
+        {
+            param[2 * n] = XAF_COMP_CONFIG_PARAM_PRIORITY;
+            param[2 * n + 1] = prio[i];
+            n++;
+        }
+
+        if (n == 0) continue;
+
+        ret = xaf_graph_txn_set_config(p_adev, &p_txn, pp_comp[i], n, param);
+        if (ret != XAF_NO_ERR)
+        {
+            if (p_txn) xaf_txn_abort(p_txn);
+            return ret;
+        }
+    }
+
+    XF_CHK_API(xaf_txn_commit(p_txn, NULL));
+
+    /* ...start in topological order; outputs are connected as soon as the source is initialized */
+    for (k = 0; k < p_graph->num_comp; k++)
+    {
+        i = order[k];
+
+        XF_CHK_API(xaf_graph_comp_init(p_adev, &p_graph->comp[i], i, pp_comp[i]));
+
+        for (j = 0, p_txn = NULL; j < p_graph->num_conn; j++)
+        {
+            xaf_graph_conn_t *p_conn = &p_graph->conn[j];
+
+            if (p_conn->src != i) continue;
+
+            /* ...buffer sizing; a connection crossing workers gets an extra buffer to absorb scheduling jitter */
+            n = p_conn->num_buf;
+            if (n == 0)
+            {
+                n = XAF_GRAPH_CONN_BUFS + (prio[p_conn->src] != prio[p_conn->dest]);
+            }
+
+            if (p_txn == NULL) XF_CHK_API(xaf_txn_begin(p_adev, &p_txn));
+
+            ret = xaf_txn_connect(p_txn, pp_comp[i], p_conn->src_out_port, pp_comp[p_conn->dest], p_conn->dest_in_port, n);
+            if (ret != XAF_NO_ERR)
+            {
+                xaf_txn_abort(p_txn);
+                return ret;
+            }
+        }
+
+        if (p_txn) XF_CHK_API(xaf_txn_commit(p_txn, NULL));
+    }
+
+    return XAF_NO_ERR;
+}
+
+XAF_ERR_CODE xaf_graph_create(pVOID adev_ptr, xaf_graph_t *p_graph, pVOID p_comp[])
+{
+    xaf_adev_t  *p_adev;
+    WORD32       order[XAF_GRAPH_MAX_COMP];
+    WORD32       depth[XAF_GRAPH_MAX_COMP];
+    WORD32       i, ret;
+
+    XAF_CHK_PTR(adev_ptr);
+    XAF_CHK_PTR(p_comp);
+
+    p_adev = (xaf_adev_t *)adev_ptr;
+
+    if((p_adev->adev_state < XAF_ADEV_INIT))
+    {
+        return XAF_API_ERR;
+    }
+
+    /* ...whole description is checked before anything is sent to the DSP */
+    XF_CHK_API(xaf_graph_check(p_graph, order, depth));
+
+    for (i = 0; i < p_graph->num_comp; i++)
+    {
+        p_comp[i] = NULL;
+    }
+
+    ret = xaf_graph_instantiate(p_adev, p_graph, (xaf_comp_t **)p_comp, order, depth);
+    if (ret != XAF_NO_ERR)
+    {
+        TRACE(ERROR, _x("Graph creation failed: %d"), ret);
+
+        /* ...roll back: links made so far are torn down in reverse order, then the components created so far
+         * are destroyed; disconnect rejects the links that were never made */
+        for (i = p_graph->num_conn - 1; i >= 0; i--)
+        {
+            xaf_graph_conn_t *p_conn = &p_graph->conn[i];
+
+            if (p_comp[p_conn->src] == NULL || p_comp[p_conn->dest] == NULL) continue;
+
+            xaf_disconnect(p_comp[p_conn->src], p_conn->src_out_port, p_comp[p_conn->dest], p_conn->dest_in_port);
+        }
+
+        xaf_graph_delete(p_graph, p_comp);
+    }
+
+    return ret;
+}
+
+XAF_ERR_CODE xaf_graph_delete(xaf_graph_t *p_graph, pVOID p_comp[])
+{
+    WORD32 i;
+
+    XAF_CHK_PTR(p_graph);
+    XAF_CHK_PTR(p_comp);
+    XAF_CHK_RANGE(p_graph->num_comp, 1, XAF_GRAPH_MAX_COMP);
+
+    for (i = p_graph->num_comp - 1; i >= 0; i--)
+    {
+        if (p_comp[i] != NULL)
+        {
+            XF_CHK_API(xaf_comp_delete(p_comp[i]));
+            p_comp[i] = NULL;
+        }
+    }
+
+    return XAF_NO_ERR;
+}
+
+XAF_ERR_CODE xaf_probe_start(pVOID comp_ptr)
+{
+    xaf_comp_t    *p_comp;
+    xf_handle_t   *p_handle;
+
+    p_comp = (xaf_comp_t *)comp_ptr;
+
+    XAF_CHK_PTR(p_comp);
+    if (!p_comp->probe_enabled) return XAF_INVALIDVAL_ERR;
+    if (p_comp->probe_started)  return XAF_API_ERR;
+
+    p_handle = &p_comp->handle;
+    XAF_CHK_PTR(p_handle);
+
+    XAF_COMP_STATE_CHK(p_comp);
+
+    XF_CHK_API(xf_resume(p_handle, (p_comp->inp_ports + p_comp->out_ports)));
+
+    p_comp->probe_started = 1;
+
+    XF_CHK_API(xf_command(p_handle, (p_comp->inp_ports + p_comp->out_ports), XF_FILL_THIS_BUFFER, p_comp->probe_buf, p_comp->probe_length));
+
+    p_comp->pending_resp++;
+
+    return XAF_NO_ERR;
+}
+
+XAF_ERR_CODE xaf_probe_stop(pVOID comp_ptr)
+{
+    xaf_comp_t    *p_comp;
+    xf_handle_t   *p_handle;
+
+    p_comp = (xaf_comp_t *)comp_ptr;
+
+    XAF_CHK_PTR(p_comp);
+    if (!p_comp->probe_enabled) return XAF_INVALIDVAL_ERR;
+    /* if (!p_comp->probe_started) return XAF_API_ERR; */
 
     p_handle = &p_comp->handle;
     XAF_CHK_PTR(p_handle);
@@ -2100,7 +3311,44 @@ XAF_ERR_CODE xaf_create_event_channel(pVOID p_src, UWORD32 src_config_param, pVO
     XAF_COMP_STATE_CHK(src_comp);
     XAF_CHK_RANGE(nbuf, 1, 16);    
 
-    return xaf_setup_event_channel(src_comp, src_config_param, dest_comp, dst_config_param, nbuf, buf_size);
+    return xaf_setup_event_channel(src_comp, src_config_param, dest_comp, dst_config_param, nbuf, buf_size, NULL);
+}
+
+XAF_ERR_CODE xaf_create_event_channel_ext(pVOID p_src, UWORD32 src_config_param, pVOID p_dest, UWORD32 dst_config_param, UWORD32 nbuf, UWORD32 buf_size, xaf_event_channel_config_t *p_cfg)
+{
+    xaf_comp_t  *src_comp, *dest_comp;
+
+    src_comp  = (xaf_comp_t *) p_src;
+    dest_comp = (xaf_comp_t *) p_dest;
+    
+    XAF_CHK_PTR(src_comp);
+    XAF_CHK_PTR(p_cfg);
+    XAF_COMP_STATE_CHK(src_comp);
+    XAF_CHK_RANGE(nbuf, 1, 16);    
+    XAF_CHK_RANGE(p_cfg->coalesce_mode, XAF_EVENT_COALESCE_NONE, XAF_EVENT_COALESCE_BATCH);
+
+    if (p_cfg->coalesce_mode == XAF_EVENT_COALESCE_BATCH)
+    {
+        XAF_CHK_RANGE(p_cfg->batch_size, 1, XAF_EVENT_BATCH_MAX);
+    }
+
+    return xaf_setup_event_channel(src_comp, src_config_param, dest_comp, dst_config_param, nbuf, buf_size, p_cfg);
+}
+
+XAF_ERR_CODE xaf_get_event_channel_stats(pVOID p_src, UWORD32 src_config_param, pVOID p_dest, UWORD32 dst_config_param, xaf_event_channel_stats_t *p_stats)
+{
+    xaf_comp_t *src_comp, *dest_comp;
+
+    src_comp  = (xaf_comp_t *) p_src;
+    dest_comp = (xaf_comp_t *) p_dest;
+    
+    XAF_CHK_PTR(src_comp);
+    XAF_CHK_PTR(p_stats);
+    XAF_COMP_STATE_CHK(src_comp);
+
+    dst_config_param = (dest_comp != NULL) ? dst_config_param : XF_CFG_ID_EVENT_TO_APP;
+
+    return xf_get_event_channel_stats(&src_comp->handle, src_config_param, (dest_comp ? &dest_comp->handle : NULL), dst_config_param, p_stats);
 }
 
 XAF_ERR_CODE xaf_delete_event_channel(pVOID p_src, UWORD32 src_config_param, pVOID p_dest, UWORD32 dst_config_param)
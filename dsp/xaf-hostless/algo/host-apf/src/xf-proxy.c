@@ -42,6 +42,9 @@
 /* ...invalid proxy address */
 #define XF_PROXY_BADADDR        XF_CFG_REMOTE_IPC_POOL_SIZE
 
+/* ...dispatcher barrier completion */
+#define XF_PROXY_DISPATCH_SYNC  (1 << 0)
+
 #define XA_EXT_CFG_ID_OFFSET       0
 #define XA_EXT_CFG_BUF_PTR_OFFSET  1
 
@@ -94,7 +97,10 @@
  ******************************************************************************/
 #ifdef HIFI_ONLY_XAF
 #define PROXY_THREAD_STACK_SIZE          8192
+#define PROXY_DISPATCH_MSGQ_ENTRIES      64
 const char proxy_thread_name[] = "proxyListen";
+const char proxy_dispatch_thread_name[] = "proxyDispatch";
+const char proxy_event_thread_name[] = "proxyEvent";
 extern xf_ap_t *xf_g_ap;
 extern XAF_ERR_CODE xaf_malloc(void **buf_ptr, int size, int id); 
 #endif /* HIFI_ONLY_XAF */
@@ -297,58 +303,195 @@ static inline int xf_proxy_buffer_free(xf_proxy_t *proxy, void *buffer, UWORD32
     return 0;
 }
 
+/*******************************************************************************
+ * Proxy message delivery
+ ******************************************************************************/
+
+#ifndef XA_DISABLE_EVENT
+/* ...submit the event to application via callback */
+static void xf_proxy_event(xf_proxy_t *proxy, xf_proxy_msg_t *m)
+{
+#ifdef XF_MSG_ERR_HANDLING
+    xf_g_ap->cdata->cb(xf_g_ap->cdata, XF_MSG_SRC_ID(XF_MSG_SRC(m->id)), *(UWORD32*)m->address, (void *)m->address, m->length, m->error); 
+#else
+    xf_g_ap->cdata->cb(xf_g_ap->cdata, XF_MSG_SRC_ID(XF_MSG_SRC(m->id)), *(UWORD32*)m->address, (void *)m->address, m->length); 
+#endif //XF_MSG_ERR_HANDLING
+}
+#endif
+
+/* ...pass response to the client it is addressed to */
+static void xf_proxy_deliver(xf_proxy_t *proxy, xf_proxy_msg_t *m)
+{
+    xf_handle_t    *client;
+    xf_user_msg_t   msg;
+
+    /* ...retrieve information fields */
+    msg.id = XF_MSG_SRC(m->id), msg.opcode = m->opcode, msg.length = m->length, msg.error = m->error;
+    msg.buffer = xf_proxy_a2b(proxy, m->address);
+
+    /* ...lookup component basing on destination port specification */
+    if ((client = xf_client_lookup(proxy, XF_AP_CLIENT(m->id))) != NULL)
+    {
+        /* ...client is found; invoke its response callback (must be non-blocking) */
+        client->response(client, &msg);
+    }
+    else
+    {
+        /* ...client has been disconnected already; drop message */
+        TRACE(RSP, _b("Client look-up failed - drop message"));
+    }
+}
+
+/* ...delivery thread; messages are handled in arrival order */
+static void * xf_proxy_dispatch_thread(void *arg)
+{
+    xf_proxy_dispatch_t    *d = arg;
+    xf_proxy_msg_t          m;
+
+    while (__xf_msgq_recv_blocking(d->msgq, &m, sizeof(m)) == XAF_NO_ERR)
+    {
+        /* ...null session-id with flush opcode is a barrier; everything queued before is delivered */
+        if (m.id == 0 && m.opcode == XF_FLUSH)
+        {
+            __xf_event_set(&d->sync_event, XF_PROXY_DISPATCH_SYNC);
+            continue;
+        }
+
+        /* ...null session-id is posted on proxy close */
+        if (m.id == 0)
+            break;
+
+#ifndef XA_DISABLE_EVENT
+        if (m.opcode == XF_EVENT)
+            xf_proxy_event(d->proxy, &m);
+        else
+#endif
+            xf_proxy_deliver(d->proxy, &m);
+    }
+
+    TRACE(INIT, _b("proxy dispatcher[%p] terminated"), d);
+
+    return NULL;
+}
+
+/* ...create delivery thread */
+static int xf_proxy_dispatch_start(xf_proxy_t *proxy, xf_proxy_dispatch_t *d, const char *name, UWORD32 priority)
+{
+    int     r;
+
+    d->proxy = proxy;
+    d->stack = NULL;
+
+    XF_CHK_ERR(d->msgq = __xf_msgq_create(PROXY_DISPATCH_MSGQ_ENTRIES, sizeof(xf_proxy_msg_t)), XAF_MEMORY_ERR);
+
+    __xf_lock_init(&d->sync_lock);
+    __xf_event_init(&d->sync_event, XF_PROXY_DISPATCH_SYNC);
+
+#if !defined(HAVE_FREERTOS)
+    if ((r = xaf_malloc(&d->stack, PROXY_THREAD_STACK_SIZE, XAF_MEM_ID_DEV)) != XAF_NO_ERR)
+    {
+        __xf_event_destroy(&d->sync_event);
+        __xf_lock_destroy(&d->sync_lock);
+        __xf_msgq_destroy(d->msgq), d->msgq = NULL;
+        return r;
+    }
+#endif
+
+    if ((r = __xf_thread_create(&d->thread, xf_proxy_dispatch_thread, d, name, d->stack, PROXY_THREAD_STACK_SIZE, priority)) < 0)
+    {
+        TRACE(ERROR, _x("Failed to create dispatch thread: %d"), r);
+        if (d->stack) xaf_free(d->stack, XAF_MEM_ID_DEV), d->stack = NULL;
+        __xf_event_destroy(&d->sync_event);
+        __xf_lock_destroy(&d->sync_lock);
+        __xf_msgq_destroy(d->msgq), d->msgq = NULL;
+        return r;
+    }
+
+    return 0;
+}
+
+/* ...wait until the delivery thread has handled every message queued so far */
+static void xf_proxy_dispatch_sync(xf_proxy_dispatch_t *d)
+{
+    xf_proxy_msg_t  m;
+
+    memset(&m, 0, sizeof(m));
+    m.opcode = XF_FLUSH;
+
+    /* ...one barrier in flight per dispatcher */
+    __xf_lock(&d->sync_lock);
+
+    __xf_event_clear(&d->sync_event, XF_PROXY_DISPATCH_SYNC);
+    __xf_msgq_send(d->msgq, &m, sizeof(m));
+    __xf_event_wait_any(&d->sync_event, XF_PROXY_DISPATCH_SYNC);
+
+    __xf_unlock(&d->sync_lock);
+}
+
+/* ...terminate delivery thread once it has handled all queued messages */
+static void xf_proxy_dispatch_stop(xf_proxy_dispatch_t *d)
+{
+    xf_proxy_msg_t  m;
+
+    memset(&m, 0, sizeof(m));
+    __xf_msgq_send(d->msgq, &m, sizeof(m));
+
+    __xf_thread_join(&d->thread, NULL);
+    __xf_thread_destroy(&d->thread);
+
+    __xf_msgq_destroy(d->msgq), d->msgq = NULL;
+
+    __xf_event_destroy(&d->sync_event);
+    __xf_lock_destroy(&d->sync_lock);
+
+    if (d->stack) xaf_free(d->stack, XAF_MEM_ID_DEV), d->stack = NULL;
+}
+
 /*******************************************************************************
  * Proxy interface asynchronous receiving thread
  ******************************************************************************/
 static void * xf_proxy_thread(void *arg)
 {
     xf_proxy_t     *proxy = arg;
-    xf_handle_t    *client;
     int             r;
     xf_proxy_msg_t  m;
-    xf_user_msg_t   msg;
+    void           *b;
 
     /* ...retrieve all responses received */
     while (xf_ipc_wait(&proxy->ipc, 0) == 0) {
-        while ((r = xf_ipc_recv(&proxy->ipc, &m, &msg.buffer)) == sizeof(m)) {
+        while ((r = xf_ipc_recv(&proxy->ipc, &m, &b)) == sizeof(m)) {
             /* ...make sure we have proper core identifier of SHMEM interface */
             BUG(XF_MSG_DST_CORE(m.id) != proxy->core, _x("Invalid session-id: %X (core=%u)"), m.id, proxy->core);
 
             /* ...make sure translation is successful */
-            BUG(msg.buffer == (void *)-1, _x("Invalid buffer address: %08x"), m.address);        
+            BUG(b == (void *)-1, _x("Invalid buffer address: %08x"), m.address);        
 
-            /* ...retrieve information fields */
-            msg.id = XF_MSG_SRC(m.id), msg.opcode = m.opcode, msg.length = m.length, msg.error = m.error ;           
-        
             TRACE(RSP, _b("R[%08x]:(%08x,%u,%08x,%d)"), m.id, m.opcode, m.length, m.address, m.error);
 
 #ifndef XA_DISABLE_EVENT
             if (m.opcode == XF_EVENT)  
             {
-                /* ...submit the event to application via callback. */
-#ifdef XF_MSG_ERR_HANDLING
-                xf_g_ap->cdata->cb(xf_g_ap->cdata, XF_MSG_SRC_ID(msg.id), *(UWORD32*)m.address, (void *)m.address, m.length, m.error); 
-#else
-                xf_g_ap->cdata->cb(xf_g_ap->cdata, XF_MSG_SRC_ID(msg.id), *(UWORD32*)m.address, (void *)m.address, m.length); 
-#endif //XF_MSG_ERR_HANDLING
+                /* ...slow event consumers mustn't hold back responses */
+                if (proxy->n_dispatch)
+                    __xf_msgq_send(proxy->event.msgq, &m, sizeof(m));
+                else
+                    xf_proxy_event(proxy, &m);
             }
             else 
 #endif
-            /* ...lookup component basing on destination port specification */
             if (XF_AP_CLIENT(m.id) == 0)
             {
                 /* ...put proxy response to local IPC queue */
                 xf_proxy_response_put(proxy, &m);
             }
-            else if ((client = xf_client_lookup(proxy, XF_AP_CLIENT(m.id))) != NULL)
+            else if (proxy->n_dispatch)
             {
-                /* ...client is found; invoke its response callback (must be non-blocking) */
-                client->response(client, &msg);
+                /* ...shard by client, so that responses of a client stay in order */
+                __xf_msgq_send(proxy->dispatch[XF_AP_CLIENT(m.id) % proxy->n_dispatch].msgq, &m, sizeof(m));
             }
             else
             {
-                /* ...client has been disconnected already; drop message */
-                TRACE(RSP, _b("Client look-up failed - drop message"));
+                xf_proxy_deliver(proxy, &m);
             }
         }
     }
@@ -361,6 +504,24 @@ static void * xf_proxy_thread(void *arg)
  * HiFi proxy API
  ******************************************************************************/
 
+/* ...stop all delivery threads */
+static void xf_proxy_dispatch_close(xf_proxy_t *proxy)
+{
+    UWORD32     i;
+
+#ifndef XA_DISABLE_EVENT
+    if (proxy->event.msgq)
+    {
+        xf_proxy_dispatch_stop(&proxy->event);
+    }
+#endif
+
+    for (i = 0; i < proxy->n_dispatch; i++)
+    {
+        xf_proxy_dispatch_stop(&proxy->dispatch[i]);
+    }
+}
+
 /* ...open HiFi proxy */
 int xf_proxy_init(xf_proxy_t *proxy, UWORD32 core)
 {
@@ -384,6 +545,29 @@ int xf_proxy_init(xf_proxy_t *proxy, UWORD32 core)
     
     /* ...tail of the list points back to head (list terminator) */
     proxy->cmap[i].next = 0;
+
+    /* ...start delivery threads before any response can arrive */
+    for (i = 0; i < proxy->n_dispatch; i++)
+    {
+        if ((r = xf_proxy_dispatch_start(proxy, &proxy->dispatch[i], proxy_dispatch_thread_name, proxy->proxy_thread_priority)) < 0)
+        {
+            proxy->n_dispatch = i;
+            xf_proxy_dispatch_close(proxy);
+            xf_ipc_close(&proxy->ipc, core);
+            return r;
+        }
+    }
+
+#ifndef XA_DISABLE_EVENT
+    /* ...events are delivered below response priority */
+    if (proxy->n_dispatch && (r = xf_proxy_dispatch_start(proxy, &proxy->event, proxy_event_thread_name, proxy->proxy_thread_priority - 1)) < 0)
+    {
+        xf_proxy_dispatch_close(proxy);
+        xf_ipc_close(&proxy->ipc, core);
+        return r;
+    }
+#endif
+
     /* ...initialize thread attributes (joinable, with minimal stack) */
 #if defined(HAVE_FREERTOS)
     if ((r = __xf_thread_create(&proxy->thread, xf_proxy_thread, proxy, proxy_thread_name, NULL, PROXY_THREAD_STACK_SIZE, proxy->proxy_thread_priority)) < 0)
@@ -392,6 +576,7 @@ int xf_proxy_init(xf_proxy_t *proxy, UWORD32 core)
 #endif
     {
         TRACE(ERROR, _x("Failed to create polling thread: %d"), r);
+        xf_proxy_dispatch_close(proxy);
         xf_ipc_close(&proxy->ipc, core);
         return r;
     }
@@ -412,6 +597,9 @@ void xf_proxy_close(xf_proxy_t *proxy)
     /* TENA-2117*/
     __xf_thread_join(&proxy->thread, NULL); //wait for the proxy to complete
 
+    /* ...deliver what proxy thread has queued and stop delivery threads */
+    xf_proxy_dispatch_close(proxy);
+
     /* ...close proxy IPC interface */
     xf_ipc_close(&proxy->ipc, core); //close after proxy thread stops waiting in loop with ipc_wait()
 
@@ -488,11 +676,22 @@ void xf_close(xf_handle_t *handle)
     
     /* ...unregister component from DSP Interface Layer proxy (ignore result code) */
     (void) xf_client_unregister(proxy, handle);
-    
+
+    /* ...release global proxy lock; delivery callbacks may need it */
+    xf_proxy_unlock(proxy);
+
+    /* ...responses and events queued for the client still reference it; deliver them first */
+    if (proxy->n_dispatch)
+    {
+        xf_proxy_dispatch_sync(&proxy->dispatch[handle->client % proxy->n_dispatch]);
+#ifndef XA_DISABLE_EVENT
+        xf_proxy_dispatch_sync(&proxy->event);
+#endif
+    }
+
     /* ...recycle client-id afterwards */
+    xf_proxy_lock(proxy);
     xf_client_free(proxy, handle);
-
-    /* ...release global proxy lock */
     xf_proxy_unlock(proxy);
 
     /* ...destroy IPC data */
@@ -602,7 +801,7 @@ int xf_unroute(xf_handle_t *src, UWORD32 src_port)
 }
 
 #ifndef XA_DISABLE_EVENT
-int xf_create_event_channel(xf_handle_t *src, UWORD32 src_config_param, xf_handle_t *dst, UWORD32 dst_config_param, UWORD32 num, UWORD32 size, UWORD32 align)
+int xf_create_event_channel(xf_handle_t *src, UWORD32 src_config_param, xf_handle_t *dst, UWORD32 dst_config_param, UWORD32 num, UWORD32 size, UWORD32 align, xaf_event_channel_config_t *cfg)
 {
     xf_proxy_t             *proxy = src->proxy;
     xf_buffer_t            *b;
@@ -637,6 +836,11 @@ int xf_create_event_channel(xf_handle_t *src, UWORD32 src_config_param, xf_handl
     m->alloc_size       = size;
     m->alloc_align      = align;
 
+    /* ...delivery policy; default is a message per event */
+    m->coalesce_mode    = (cfg ? cfg->coalesce_mode : XAF_EVENT_COALESCE_NONE);
+    m->batch_size       = (cfg ? cfg->batch_size : 1);
+    m->min_interval     = (cfg ? cfg->min_interval_usec : 0);
+
     /* ...set command parameters */
     msg.id = __XF_MSG_ID(__XF_AP_PROXY(proxy->core), __XF_PORT_SPEC2(src->id, 0));
     msg.opcode = XF_EVENT_CHANNEL_CREATE;
@@ -698,6 +902,62 @@ int xf_delete_event_channel(xf_handle_t *src, UWORD32 src_config_param, xf_handl
     
     return XAF_NO_ERR;
 }
+
+int xf_get_event_channel_stats(xf_handle_t *src, UWORD32 src_config_param, xf_handle_t *dst, UWORD32 dst_config_param, xaf_event_channel_stats_t *stats)
+{
+    xf_proxy_t                      *proxy = src->proxy;
+    xf_buffer_t                     *b;
+    xf_event_channel_stats_msg_t    *m;
+    xf_user_msg_t                   msg;
+    int                             r; 
+
+    /* ...get control buffer */
+    XF_CHK_ERR(b = xf_buffer_get(proxy->aux), XAF_MEMORY_ERR);
+
+    /* ...get message buffer */
+    m = xf_buffer_data(b);
+    
+    /* ...fill-in message parameters */
+    m->src              = __XF_PORT_SPEC2(src->id, 0);
+    m->src_cfg_param    = src_config_param; 
+    if (dst == NULL)
+    {
+        m->dst          = __XF_AP_PROXY(proxy->core);
+    }
+    else
+    {
+        m->dst          = __XF_PORT_SPEC2(dst->id, 0);
+    }
+    m->dst_cfg_param    = dst_config_param;
+
+    /* ...set command parameters */
+    msg.id      = __XF_MSG_ID(__XF_AP_PROXY(proxy->core), __XF_PORT_SPEC2(src->id, 0));
+    msg.opcode  = XF_EVENT_CHANNEL_STATS;
+    msg.length  = sizeof(*m);
+    msg.buffer  = m;
+
+    /* ...synchronously execute command on DSP Interface Layer */    
+    r = xf_proxy_cmd_exec_with_lock(proxy, &msg);
+
+    /* ...copy the counters out before the buffer is returned */
+    if (r == 0 && msg.opcode == XF_EVENT_CHANNEL_STATS)
+    {
+        stats->delivered    = m->delivered;
+        stats->merged       = m->merged;
+        stats->dropped      = m->dropped;
+    }
+
+    /* ...return buffer to proxy */
+    xf_buffer_put(b);
+    
+    /* ...check command execution is successful */
+    XF_CHK_API(r);
+
+    /* ...check result is successfull */
+    XF_CHK_ERR(msg.opcode == XF_EVENT_CHANNEL_STATS, XAF_INVALIDVAL_ERR);
+    
+    return XAF_NO_ERR;
+}
 #endif /* XA_DISABLE_EVENT */
 
 /* ...send a command message to component */
@@ -874,6 +1134,178 @@ int xf_set_config_with_lock(xf_handle_t *comp, void *buffer, UWORD32 length, WOR
 	return msg.error;
 }
 
+/* ...in-place component reset with new parameters */
+int xf_reset(xf_handle_t *comp, void *buffer, WORD32 num_param, WORD32 *p_param)
+{
+    xf_proxy_t             *proxy = comp->proxy;
+    xf_set_param_msg_t     *smsg = (xf_set_param_msg_t *)buffer;
+    xf_user_msg_t           msg;
+    WORD32                  i, k;
+    int                     r;
+
+    xf_proxy_lock(proxy);
+
+    for (i = 0, k = 0; i < num_param; i++)
+    {
+        smsg->item[i].id    = p_param[k++];
+        smsg->item[i].value = p_param[k++];
+    }
+
+    /* ...set command parameters */
+    msg.id = __XF_MSG_ID(__XF_AP_PROXY(proxy->core), __XF_PORT_SPEC2(comp->id, 0));
+    msg.opcode = XF_RESET;
+    msg.length = XF_RESET_CMD_LEN(num_param);
+    msg.buffer = buffer;
+
+    /* ...synchronously execute command on DSP Interface Layer */
+    if ((r = xf_proxy_cmd_exec(proxy, &msg)) != 0)
+    {
+        TRACE(ERROR, _x("Command failed: %d"), r);
+    }
+
+    /* ...check result is successful; component cannot be reset in place otherwise */
+    XF_CHK_ERR_UNLOCK(proxy, (msg.opcode == XF_RESET), XAF_INVALIDVAL_ERR);
+
+    xf_proxy_unlock(proxy);
+
+    return msg.error;
+}
+
+/* ...save (XF_SNAPSHOT) or load (XF_RESTORE) component state using application buffer */
+int xf_snapshot(xf_handle_t *comp, void *buffer, UWORD32 opcode, void *data, UWORD32 *length)
+{
+    xf_proxy_t             *proxy = comp->proxy;
+    xf_snapshot_msg_t      *smsg = (xf_snapshot_msg_t *)buffer;
+    xf_user_msg_t           msg;
+    int                     r;
+
+    xf_proxy_lock(proxy);
+
+    /* ...state is accessed by DSP in place */
+    smsg->buffer = (UWORD32)data;
+    smsg->length = *length;
+
+    /* ...set command parameters */
+    msg.id = __XF_MSG_ID(__XF_AP_PROXY(proxy->core), __XF_PORT_SPEC2(comp->id, 0));
+    msg.opcode = opcode;
+    msg.length = sizeof(*smsg);
+    msg.buffer = buffer;
+
+    /* ...synchronously execute command on DSP Interface Layer */
+    if ((r = xf_proxy_cmd_exec(proxy, &msg)) != 0)
+    {
+        TRACE(ERROR, _x("Command failed: %d"), r);
+    }
+
+    /* ...check result is successful */
+    XF_CHK_ERR_UNLOCK(proxy, (msg.opcode == opcode), XAF_INVALIDVAL_ERR);
+
+    /* ...pass actual snapshot length to caller */
+    *length = smsg->length;
+
+    xf_proxy_unlock(proxy);
+
+    return msg.error;
+}
+
+/* ...prepare SET-PARAM-EXT message carrying a single chunk of the blob */
+static inline UWORD32 xf_prepare_ext_chunk(void *buffer, WORD32 id, xaf_ext_buffer_t *blob, UWORD32 offset, UWORD32 size)
+{
+    xf_ext_param_msg_t     *smsg = (xf_ext_param_msg_t *)buffer;
+    xaf_ext_chunk_t        *chunk = (xaf_ext_chunk_t *)((UWORD32)smsg + sizeof(xf_ext_param_msg_t) + sizeof(UWORD32));
+    UWORD32                 desc_len = sizeof(UWORD32) + sizeof(xaf_ext_chunk_t);
+
+    chunk->buf.max_data_size    = size;
+    chunk->buf.valid_data_size  = size;
+    chunk->buf.ext_config_flags = blob->ext_config_flags | (1 << XAF_EXT_PARAM_FLAG_OFFSET_CHUNK);
+    chunk->offset               = offset;
+    chunk->total_size           = blob->valid_data_size;
+
+    if (XAF_CHK_EXT_PARAM_FLAG(blob->ext_config_flags, XAF_EXT_PARAM_FLAG_OFFSET_ZERO_COPY))
+    {
+        /* ...zero copy - component reads the application blob in place */
+        chunk->buf.data = blob->data + offset;
+    }
+    else
+    {
+        chunk->buf.data = (UWORD8 *)((UWORD32)chunk + sizeof(xaf_ext_chunk_t));
+
+        memcpy(chunk->buf.data, blob->data + offset, size);
+
+        desc_len += (size + (XAF_4BYTE_ALIGN-1)) & ~(XAF_4BYTE_ALIGN-1);
+    }
+
+    smsg->desc.id       = id;
+    smsg->desc.length   = desc_len;
+    *(UWORD32 *)smsg->data = (UWORD32) chunk;
+
+    return sizeof(xf_ext_param_msg_t) + desc_len;
+}
+
+/* ...stream a large extended parameter in chunks; up to 'depth' chunks are in flight,
+ * the lock is released between the windows so other commands are not held off */
+int xf_set_config_stream(xf_handle_t *comp, xf_buffer_t **chunk_buf, UWORD32 depth, WORD32 id, xaf_ext_buffer_t *blob, UWORD32 chunk_size)
+{
+    xf_proxy_t             *proxy = comp->proxy;
+    xf_proxy_msg_t          m;
+    UWORD32                 offset = 0;
+    UWORD32                 i, n;
+    int                     error = 0;
+
+    while (offset < blob->valid_data_size && !error)
+    {
+        xf_proxy_lock(proxy);
+
+        /* ...fill the window */
+        for (n = 0; (n < depth) && (offset < blob->valid_data_size); n++)
+        {
+            UWORD32     size = blob->valid_data_size - offset;
+            void       *buffer = xf_buffer_data(chunk_buf[n]);
+
+            size = (size < chunk_size ? size : chunk_size);
+
+            m.id        = __XF_MSG_ID(__XF_AP_PROXY(proxy->core), __XF_PORT_SPEC2(comp->id, 0));
+            m.opcode    = XF_SET_PARAM_EXT;
+            m.length    = xf_prepare_ext_chunk(buffer, id, blob, offset, size);
+            m.error     = 0;
+            m.address   = xf_proxy_b2a(proxy, buffer);
+
+            if (xf_ipc_send(&proxy->ipc, &m, buffer) != 0)
+            {
+                error = XAF_API_ERR;
+                break;
+            }
+
+            offset += size;
+        }
+
+        /* ...collect responses of the window; they come in order of submission */
+        for (i = 0; i < n; i++)
+        {
+            if (xf_proxy_response_get(proxy, &m) != 0)
+            {
+                error = XAF_API_ERR;
+                continue;
+            }
+
+            if (m.opcode != XF_SET_PARAM_EXT)
+            {
+                TRACE(ERROR, _x("stream[%x]: chunk %u failed"), comp->id, i);
+                error = (error ? error : XAF_INVALIDVAL_ERR);
+            }
+            else if (m.error)
+            {
+                /* ...first error reported by the component is kept */
+                error = (error ? error : m.error);
+            }
+        }
+
+        xf_proxy_unlock(proxy);
+    }
+
+    return error;
+}
+
 int xf_get_config_with_lock(xf_handle_t *comp, void *buffer, UWORD32 length, WORD32 num_param, WORD32 *p_param, UWORD32 cfg_ext_flag)
 {
     xf_proxy_t             *proxy = comp->proxy;
@@ -1006,6 +1438,26 @@ int xf_set_priorities(xf_proxy_t *proxy, UWORD32 core, UWORD32 n_rt_priorities,
     return 0;
 }
 
+/* ...execute batch of component commands on DSP Interface Layer in one round trip */
+int xf_transaction(xf_proxy_t *proxy, void *buffer, UWORD32 length)
+{
+    xf_user_msg_t   msg;
+
+    /* ...set session-id: source is proxy at App Interface Layer, destination is proxy at DSP Interface Layer */
+    msg.id = __XF_MSG_ID(__XF_AP_PROXY(proxy->core), __XF_DSP_PROXY(proxy->core));
+    msg.opcode = XF_TRANSACTION;
+    msg.buffer = buffer;
+    msg.length = length;
+
+    /* ...execute command synchronously; per-command results are returned in the buffer */
+    XF_CHK_API(xf_proxy_cmd_exec_with_lock(proxy, &msg));
+
+    /* ...check operation is successfull */
+    XF_CHK_ERR(msg.opcode == XF_TRANSACTION, XAF_INVALIDVAL_ERR);
+
+    return 0;
+}
+
 /*******************************************************************************
  * Buffer pool API
  ******************************************************************************/
@@ -1049,6 +1501,7 @@ int xf_pool_alloc(xf_proxy_t *proxy, UWORD32 number, UWORD32 length, xf_pool_typ
         /* ...set pool parameters */
         p->number = number, p->length = length;
         p->proxy = proxy;
+        __xf_lock_init(&p->lock);
     }
  
     /* ...create individual buffers and link them into free list */
@@ -1090,6 +1543,8 @@ void xf_pool_free(xf_pool_t *pool, WORD32 id)
 
     /* ...release global proxy lock */
     xf_proxy_unlock(proxy);
+
+    __xf_lock_destroy(&pool->lock);
     
     /* ...deallocate pool structure itself */
     xf_g_ap->xf_mem_free_fxn(pool, id);
@@ -1102,8 +1557,8 @@ xf_buffer_t * xf_buffer_get(xf_pool_t *pool)
 {
     xf_buffer_t    *b;
 
-    /* ...use global proxy lock for pool operations protection */
-    xf_proxy_lock(pool->proxy);
+    /* ...use pool lock for free list protection */
+    __xf_lock(&pool->lock);
     
     /* ...take buffer from a head of the free list */
     if ((b = pool->free) != NULL)
@@ -1114,7 +1569,7 @@ xf_buffer_t * xf_buffer_get(xf_pool_t *pool)
         TRACE(BUFFER, _b("pool[%p]::get[%p]"), pool, b);
     }
 
-    xf_proxy_unlock(pool->proxy);
+    __xf_unlock(&pool->lock);
     
     return b;
 }
@@ -1124,13 +1579,13 @@ void xf_buffer_put(xf_buffer_t *buffer)
 {
     xf_pool_t  *pool = buffer->link.pool;
     
-    /* ...use global proxy lock for pool operations protection */
-    xf_proxy_lock(pool->proxy);
+    /* ...use pool lock for free list protection */
+    __xf_lock(&pool->lock);
     
     /* ...put buffer back to a pool */
     buffer->link.next = pool->free, pool->free = buffer;
     
     TRACE(BUFFER, _b("pool[%p]::put[%p]"), pool, buffer);
 
-    xf_proxy_unlock(pool->proxy);
+    __xf_unlock(&pool->lock);
 }
@@ -46,10 +46,10 @@
  ******************************************************************************/
 
 /* ...maximum in ports for mimo class */
-#define XF_CFG_MAX_IN_PORTS             4
+#define XF_CFG_MAX_IN_PORTS             16
 
 /* ...maximum out ports for mimo class */
-#define XF_CFG_MAX_OUT_PORTS            4
+#define XF_CFG_MAX_OUT_PORTS            8
 
 /* ...maximal size of scratch memory is 56 KB */
 #define XF_CFG_CODEC_SCRATCHMEM_SIZE    (56 << 10)
@@ -75,4 +75,5 @@
 
 typedef enum dsp_arg_idx_s{
     XF_DSP_THREAD_ARG_IDX_WORKER_SCRATCH = 0,
+    XF_DSP_THREAD_ARG_IDX_WORKER_QUEUE_DEPTH = 1,
 }dsp_arg_idx_t;
@@ -48,7 +48,9 @@ enum xa_config_param_capturer {
     XA_CAPTURER_CONFIG_PARAM_BYTES_PRODUCED  = 6,
     XA_CAPTURER_CONFIG_PARAM_SAMPLE_END      = 7,
     XA_CAPTURER_CONFIG_PARAM_FRAME_SIZE_IN_SAMPLES = 8,    /* frame size per channel in samples */
-    XA_CAPTURER_CONFIG_PARAM_NUM            = 9
+    XA_CAPTURER_CONFIG_PARAM_INSTANCE_ID    = 9,    /* instance index; N > 0 reads capturer_in_N.pcm */
+    XA_CAPTURER_CONFIG_PARAM_SOURCE_STALLS  = 10,   /* read-only: number of frames that waited for the file source */
+    XA_CAPTURER_CONFIG_PARAM_NUM            = 11
 };
 
 /* ...XA_CAPTURER_CONFIG_PARAM_CB: compound parameters data structure */
@@ -58,22 +58,31 @@ enum xa_config_param_mixer {
     XA_MIXER_CONFIG_PARAM_BUFFER_SIZE       = 6,
     XA_MIXER_CONFIG_PARAM_VOLUME            = 7,
     XA_MIXER_CONFIG_PARAM_FRAME_SIZE_IN_SAMPLES = 8,    /* frame size per channel in samples */
-    XA_MIXER_CONFIG_PARAM_NUM               = 9
+    XA_MIXER_CONFIG_PARAM_RAMP_LENGTH       = 9,    /* volume change ramp length per channel in samples; 0 - instant */
+    XA_MIXER_CONFIG_PARAM_NUM               = 10
 };
 
 /* ...component identifier (informative) */
 #define XA_CODEC_MIXER                  2
 
-/* ...global limitation - maximal mixer track number */
-#define XA_MIXER_MAX_TRACK_NUMBER       4
+/* ...global limitation - maximal mixer track number; output port follows the tracks (build option) */
+#ifndef XA_MIXER_MAX_TRACK_NUMBER
+#define XA_MIXER_MAX_TRACK_NUMBER       16
+#endif
+
+/* ...maximal number of channels per track */
+#define XA_MIXER_MAX_CHANNELS           8
 
 /* ...volume representation */
 #define __XA_MIXER_VOLUME(v)            \
     ({ UWORD32  __v = (UWORD32)((v) * (1 << 12)); (__v > 0xFFFF ? __v = 0xFFFF : 0); (UWORD16)__v; })
 
-/* ...mixer volume setting command encoding */
+/* ...mixer volume setting command encoding; track XA_MIXER_MAX_TRACK_NUMBER is a master volume */
 #define XA_MIXER_VOLUME(track, channel, volume) \
-    (__XA_MIXER_VOLUME(volume) | ((track) << 16) | ((channel) << 20))
+    (__XA_MIXER_VOLUME(volume) | ((track) << 16) | ((channel) << 24))
+
+/* ...channel index setting volume of all channels of a track */
+#define XA_MIXER_VOLUME_ALL_CHANNELS    0xF
 
 /*******************************************************************************
  * Class 0: API Errors
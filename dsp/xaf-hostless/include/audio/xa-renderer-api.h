@@ -47,7 +47,10 @@ enum xa_config_param_renderer {
     XA_RENDERER_CONFIG_PARAM_FRAME_SIZE     = 5,    /* frame size per channel in bytes. Deprecated, use XA_RENDERER_CONFIG_PARAM_FRAME_SIZE_IN_SAMPLES instead. */
 	XA_RENDERER_CONFIG_PARAM_BYTES_PRODUCED = 6,
     XA_RENDERER_CONFIG_PARAM_FRAME_SIZE_IN_SAMPLES = 7,    /* frame size per channel in samples */
-    XA_RENDERER_CONFIG_PARAM_NUM            = 8
+    XA_RENDERER_CONFIG_PARAM_INSTANCE_ID    = 8,    /* instance index; N > 0 writes renderer_out_N.pcm */
+    XA_RENDERER_CONFIG_PARAM_UNDERRUNS      = 9,    /* read-only: number of FIFO underruns/overruns */
+    XA_RENDERER_CONFIG_PARAM_SINK_STALLS    = 10,   /* read-only: number of frames that waited for the file sink to drain */
+    XA_RENDERER_CONFIG_PARAM_NUM            = 11
 };
 
 /* ...XA_RENDERER_CONFIG_PARAM_CB: compound parameters data structure */
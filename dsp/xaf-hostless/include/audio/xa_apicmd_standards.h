@@ -65,7 +65,12 @@ enum xa_api_cmd_generic {
   XA_API_CMD_SET_TABLE_PTR            = 0x001C,
   XA_API_CMD_GET_TABLE_PTR            = 0x001D,
 
-  XA_API_CMD_DEINIT                   = 0x001E
+  XA_API_CMD_DEINIT                   = 0x001E,
+
+  /* optional; plugins supporting component snapshot/restore */
+  XA_API_CMD_GET_STATE_SIZE           = 0x001F,
+  XA_API_CMD_SAVE_STATE               = 0x0020,
+  XA_API_CMD_RESTORE_STATE            = 0x0021
 };
 
 /*****************************************************************************/
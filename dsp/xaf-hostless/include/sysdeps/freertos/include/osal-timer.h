@@ -87,6 +87,12 @@ static inline int __xf_timer_destroy(xf_timer_t *timer)
     return xTimerDelete(timer->timer, portMAX_DELAY) == pdPASS ? 0 : -1;
 }
 
+/* ...free-running wall-clock time in microseconds (tick resolution) */
+static inline unsigned long __xf_time_usec(void)
+{
+    return (unsigned long)xTaskGetTickCount() * portTICK_PERIOD_MS * 1000;
+}
+
 #if 0
 static inline void __xf_sleep(unsigned long period)
 {
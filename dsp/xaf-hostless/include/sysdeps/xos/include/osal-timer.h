@@ -79,6 +79,12 @@ static inline int __xf_timer_destroy(xf_timer_t *timer)
     return 0;
 }
 
+/* ...free-running wall-clock time in microseconds (wraps around) */
+static inline unsigned long __xf_time_usec(void)
+{
+    return (unsigned long)(xos_get_system_cycles() / (xos_get_clock_freq() / 1000000));
+}
+
 #if 0
 static inline void __xf_sleep(unsigned long period)
 {
@@ -44,6 +44,28 @@
 
 #define XAF_MAX_WORKER_THREADS              16
 
+/* ...default number of messages a worker thread queue holds before deferring */
+#define XAF_WORKER_QUEUE_DEPTH              100
+
+/* ...default response doorbell coalescing: notify the application for every batch of responses */
+#define XAF_RESP_COALESCE_COUNT             1
+#define XAF_RESP_COALESCE_USEC              0
+
+/* ...application-side response dispatcher threads; 0 delivers responses and events on the proxy thread */
+#define XAF_MAX_DISPATCH_THREADS            8
+#define XAF_PROXY_DISPATCH_THREADS          0
+
+/* ...maximum number of components and connections in a graph description */
+#define XAF_GRAPH_MAX_COMP                  32
+#define XAF_GRAPH_MAX_CONN                  64
+
+/* ...graph component priority: keep the default worker, or pick one from the graph topology */
+#define XAF_GRAPH_PRIORITY_DEFAULT          (-1)
+#define XAF_GRAPH_PRIORITY_AUTO             (-2)
+
+/* ...number of connection buffers used when a graph connection leaves num_buf at 0 */
+#define XAF_GRAPH_CONN_BUFS                 2
+
 /* ...num thread arguments to DSP */
 #define XAF_NUM_THREAD_ARGS                 16
 
@@ -51,6 +73,7 @@
 
 enum {
     XAF_EXT_PARAM_FLAG_OFFSET_ZERO_COPY = 0,
+    XAF_EXT_PARAM_FLAG_OFFSET_CHUNK     = 1,
 };
 
 typedef enum {
@@ -67,6 +90,8 @@ typedef enum {
     XAF_MIMO_PROC_23    = 10,
     XAF_MIMO_PROC_10    = 11,
     XAF_MIMO_PROC_11    = 12,
+    XAF_MIMO_PROC_14    = 13,
+    XAF_MIMO_PROC_18    = 14,
     XAF_MAX_COMPTYPE
 } xaf_comp_type;
 
@@ -118,6 +143,16 @@ typedef enum {
     XAF_ERR_CHANNEL_FATAL    =1,     //Error channel for only Fatal error reporting
     XAF_ERR_CHANNEL_ALL      =2,     //Error channel for Fatal and Non-Fatal error reporting
 } xaf_error_channel_ctl;
+
+typedef enum {
+    XAF_EVENT_COALESCE_NONE   = 0,  //Every event is delivered in its own message
+    XAF_EVENT_COALESCE_LATEST = 1,  //Pending event carries the value at delivery time, older values are lost
+    XAF_EVENT_COALESCE_COUNT  = 2,  //As LATEST, followed by the UWORD32 number of events merged into the message
+    XAF_EVENT_COALESCE_BATCH  = 3,  //Up to batch_size event values, followed by the UWORD32 number of values
+} xaf_event_coalesce_mode;
+
+/* ...maximal number of events batched into one message */
+#define XAF_EVENT_BATCH_MAX                 32
 #endif
 
 enum xaf_comp_config_param {
@@ -126,9 +161,35 @@ enum xaf_comp_config_param {
     XAF_COMP_CONFIG_PARAM_PRIORITY     = 0x20000 + 0x2,
     XAF_COMP_CONFIG_PARAM_SELF_SCHED   = 0x20000 + 0x3, 
     XAF_COMP_CONFIG_PARAM_DEC_INIT_WO_INP   = 0x20000 + 0x4, 
+    XAF_COMP_CONFIG_PARAM_MEMTAB_PERSIST    = 0x20000 + 0x5,
+    XAF_COMP_CONFIG_PARAM_MEMTAB_SCRATCH    = 0x20000 + 0x6,
+    XAF_COMP_CONFIG_PARAM_MEMTAB_IO         = 0x20000 + 0x7,
+    XAF_COMP_CONFIG_PARAM_MEMTAB_WORKER     = 0x20000 + 0x8,
+    XAF_COMP_CONFIG_PARAM_LATENCY_P50       = 0x20000 + 0x9,
+    XAF_COMP_CONFIG_PARAM_LATENCY_P90       = 0x20000 + 0xA,
+    XAF_COMP_CONFIG_PARAM_LATENCY_P99       = 0x20000 + 0xB,
+    XAF_COMP_CONFIG_PARAM_LATENCY_MAX       = 0x20000 + 0xC,
     XAF_COMP_CONFIG_PARAM_EVENT_CB     = 0x20000 + 0xE, 
+    XAF_COMP_CONFIG_PARAM_MEM_CURR_PERSIST  = 0x20000 + 0x10,
+    XAF_COMP_CONFIG_PARAM_MEM_CURR_SCRATCH  = 0x20000 + 0x11,
+    XAF_COMP_CONFIG_PARAM_MEM_CURR_IO       = 0x20000 + 0x12,
+    XAF_COMP_CONFIG_PARAM_MEM_CURR_EVENT    = 0x20000 + 0x13,
+    XAF_COMP_CONFIG_PARAM_MEM_PEAK_PERSIST  = 0x20000 + 0x14,
+    XAF_COMP_CONFIG_PARAM_MEM_PEAK_SCRATCH  = 0x20000 + 0x15,
+    XAF_COMP_CONFIG_PARAM_MEM_PEAK_IO       = 0x20000 + 0x16,
+    XAF_COMP_CONFIG_PARAM_MEM_PEAK_EVENT    = 0x20000 + 0x17,
+    XAF_COMP_CONFIG_PARAM_SNAPSHOT_SIZE     = 0x20000 + 0x18,
 };
 
+/* ...component memory accounting types */
+typedef enum {
+    XAF_MEM_TYPE_PERSIST = 0,       //API, memory tables, persistent memory and component object
+    XAF_MEM_TYPE_SCRATCH = 1,       //share of the worker thread scratch memory
+    XAF_MEM_TYPE_IO      = 2,       //input/output port buffers and connection buffers
+    XAF_MEM_TYPE_EVENT   = 3,       //event channels and event buffers
+    XAF_MEM_TYPE_NUM     = 4,
+} xaf_mem_type;
+
 /* Component string identifier */
 typedef const char *xf_id_t; 
 
@@ -136,6 +197,8 @@ typedef const char *xf_id_t;
 typedef pVOID xaf_mem_malloc_fxn_t(WORD32 size, WORD32 id);
 typedef VOID  xaf_mem_free_fxn_t(pVOID ptr, WORD32 id);
 typedef WORD32 (*xaf_app_event_handler_fxn_t)(pVOID comp_ptr, UWORD32 config_param_id, pVOID config_buf_ptr, UWORD32 buf_size, UWORD32 comp_error_flag);
+typedef VOID (*xaf_comp_completion_fxn_t)(pVOID comp_ptr, pVOID cb_data);
+typedef WORD32 (*xaf_graph_input_fxn_t)(pVOID cb_data, WORD32 comp_idx, pVOID p_buf, UWORD32 buf_size);
 
 #ifndef XA_DISABLE_EVENT
 /* ...event callback structure */
@@ -157,6 +220,10 @@ typedef struct xaf_adev_config_s{
 	UWORD32 proxy_thread_priority;
 	UWORD32 dsp_thread_priority;
 	UWORD32	worker_thread_scratch_size[XAF_MAX_WORKER_THREADS];
+	UWORD32	worker_queue_depth[XAF_MAX_WORKER_THREADS];
+	UWORD32	resp_coalesce_count;
+	UWORD32	resp_coalesce_usec;
+	UWORD32	proxy_dispatch_threads;
 }xaf_adev_config_t;
 
 typedef struct xaf_comp_config_s{
@@ -173,6 +240,138 @@ typedef struct xaf_comp_config_s{
 }xaf_comp_config_t;
 
 
+#ifndef XA_DISABLE_EVENT
+/* ...event channel delivery policy */
+typedef struct xaf_event_channel_config_s {
+    /* ...xaf_event_coalesce_mode */
+    UWORD32 coalesce_mode;
+
+    /* ...events per message in batch mode */
+    UWORD32 batch_size;
+
+    /* ...minimal interval between two messages of the channel in usec (0 - no limit) */
+    UWORD32 min_interval_usec;
+
+} xaf_event_channel_config_t;
+
+/* ...event channel delivery counters */
+typedef struct xaf_event_channel_stats_s {
+    /* ...messages sent over the channel */
+    UWORD32 delivered;
+
+    /* ...events folded into a message carrying another event */
+    UWORD32 merged;
+
+    /* ...events lost for lack of a free buffer or due to rate limiting */
+    UWORD32 dropped;
+
+} xaf_event_channel_stats_t;
+#endif
+
+/* ...graph memory plan, all sizes in bytes */
+typedef struct xaf_mem_plan_s {
+    /* ...persistent memory tables, live for the graph lifetime */
+    UWORD32 persist_size;
+
+    /* ...input/output memory tables, live for the graph lifetime */
+    UWORD32 io_size;
+
+    /* ...connection buffers, live from connect to disconnect */
+    UWORD32 route_size;
+
+    /* ...scratch memory, overlapped among components of the same worker */
+    UWORD32 scratch_size;
+
+    /* ...scratch required per worker thread (candidate worker_thread_scratch_size[]) */
+    UWORD32 worker_scratch_size[XAF_MAX_WORKER_THREADS];
+
+    /* ...single-arena footprint of the whole graph */
+    UWORD32 planned_size;
+
+    /* ...current usage of the component memory pool (per-call allocation) */
+    UWORD32 actual_size;
+
+} xaf_mem_plan_t;
+
+/* ...worker thread message queue statistics */
+typedef struct xaf_worker_queue_stats_s {
+    /* ...configured depth of the queue, in messages */
+    UWORD32 depth;
+
+    /* ...high-water mark of messages in the queue */
+    UWORD32 used_hwm;
+
+    /* ...messages deferred as the queue was full, and their high-water mark */
+    UWORD32 deferred;
+    UWORD32 deferred_hwm;
+
+    /* ...schedule requests merged into an already queued one */
+    UWORD32 coalesced;
+
+} xaf_worker_queue_stats_t;
+
+/* ...per-component memory usage, in bytes per xaf_mem_type */
+typedef struct xaf_comp_mem_stats_s {
+    UWORD32 curr[XAF_MEM_TYPE_NUM];
+    UWORD32 peak[XAF_MEM_TYPE_NUM];
+
+} xaf_comp_mem_stats_t;
+
+/* ...application/DSP message interface statistics */
+typedef struct xaf_ipc_stats_s {
+    /* ...commands sent to the DSP, and notifications of the DSP about them */
+    UWORD32 cmd_count;
+    UWORD32 cmd_doorbells;
+
+    /* ...responses sent to the application, and notifications of the application about them */
+    UWORD32 resp_count;
+    UWORD32 resp_doorbells;
+
+    /* ...times the application blocked waiting for a response */
+    UWORD32 resp_waits;
+
+} xaf_ipc_stats_t;
+
+/* ...graph component description */
+typedef struct xaf_graph_comp_s {
+    /* ...creation parameters, as for xaf_comp_create() */
+    xaf_comp_config_t config;
+
+    /* ...configuration applied before start, as for xaf_comp_set_config() */
+    WORD32 num_param;
+    pWORD32 p_param;
+
+    /* ...worker priority index, XAF_GRAPH_PRIORITY_DEFAULT or XAF_GRAPH_PRIORITY_AUTO */
+    WORD32 priority;
+
+    /* ...supplies input until initialization completes; required if the component has input buffers.
+     * Returns number of bytes written to p_buf; graph creation fails if it returns 0 or less */
+    xaf_graph_input_fxn_t init_input_cb;
+    pVOID init_input_cb_data;
+
+} xaf_graph_comp_t;
+
+/* ...graph connection description, components are referred to by index */
+typedef struct xaf_graph_conn_s {
+    WORD32 src;
+    WORD32 src_out_port;
+    WORD32 dest;
+    WORD32 dest_in_port;
+
+    /* ...number of connection buffers, 0 to let the graph choose */
+    WORD32 num_buf;
+
+} xaf_graph_conn_t;
+
+typedef struct xaf_graph_s {
+    WORD32 num_comp;
+    xaf_graph_comp_t *comp;
+
+    WORD32 num_conn;
+    xaf_graph_conn_t *conn;
+
+} xaf_graph_t;
+
 typedef struct xaf_ext_buffer
 {
     /* ...max data size */
@@ -189,6 +388,21 @@ typedef struct xaf_ext_buffer
 
 } __attribute__ ((__packed__, __aligned__(4))) xaf_ext_buffer_t;
 
+/* ...chunk of a streamed extended parameter; the component receives the
+ * xaf_ext_buffer_t with XAF_EXT_PARAM_FLAG_OFFSET_CHUNK set, chunks arrive in order */
+typedef struct xaf_ext_chunk
+{
+    /* ...chunk data, valid_data_size bytes */
+    xaf_ext_buffer_t buf;
+
+    /* ...position of the chunk in the parameter blob */
+    UWORD32 offset;
+
+    /* ...size of the whole parameter blob */
+    UWORD32 total_size;
+
+} __attribute__ ((__packed__, __aligned__(4))) xaf_ext_chunk_t;
+
 
 /* Function prototypes */
 XAF_ERR_CODE xaf_adev_config_default_init(xaf_adev_config_t *pconfig);
@@ -203,23 +417,53 @@ XAF_ERR_CODE xaf_comp_set_config(pVOID p_comp, WORD32 num_param, pWORD32 p_param
 XAF_ERR_CODE xaf_comp_set_config_ext(pVOID comp_ptr, WORD32 num_param, WORD32 *p_param);
 XAF_ERR_CODE xaf_comp_get_config(pVOID p_comp, WORD32 num_param, pWORD32 p_param);
 XAF_ERR_CODE xaf_comp_get_config_ext(pVOID comp_ptr, WORD32 num_param, WORD32 *p_param);
+XAF_ERR_CODE xaf_comp_set_config_stream(pVOID p_comp, WORD32 param_id, xaf_ext_buffer_t *p_blob, UWORD32 chunk_size);
+/* ...in-place re-initialization with new parameters; restart with XAF_START_FLAG, delete and create again on XAF_INVALIDVAL_ERR */
+XAF_ERR_CODE xaf_comp_reset(pVOID p_comp, WORD32 num_param, pWORD32 p_param);
+/* ...state transfer between components of the same type and configuration; size by XAF_COMP_CONFIG_PARAM_SNAPSHOT_SIZE */
+XAF_ERR_CODE xaf_comp_snapshot(pVOID p_comp, pVOID p_buf, UWORD32 size, UWORD32 *p_length);
+XAF_ERR_CODE xaf_comp_restore(pVOID p_comp, pVOID p_buf, UWORD32 length);
 XAF_ERR_CODE xaf_comp_process(pVOID p_adev, pVOID p_comp, pVOID p_buf, UWORD32 length, xaf_comp_flag flag);
 XAF_ERR_CODE xaf_connect(pVOID p_src, WORD32 src_out_port, pVOID p_dest, WORD32 dest_in_port, WORD32 num_buf);
 XAF_ERR_CODE xaf_disconnect(pVOID p_src, WORD32 src_out_port, pVOID p_dest, WORD32 dest_in_port);
 XAF_ERR_CODE xaf_get_mem_stats(pVOID p_dev, WORD32 *pmem_info);
+XAF_ERR_CODE xaf_get_mem_plan(pVOID p_dev, xaf_mem_plan_t *p_plan);
+XAF_ERR_CODE xaf_comp_get_mem_stats(pVOID p_comp, xaf_comp_mem_stats_t *p_stats);
+XAF_ERR_CODE xaf_get_worker_queue_stats(pVOID p_dev, UWORD32 worker, xaf_worker_queue_stats_t *p_stats);
+XAF_ERR_CODE xaf_get_ipc_stats(pVOID p_dev, xaf_ipc_stats_t *p_stats);
+XAF_ERR_CODE xaf_cmd_batch_begin(pVOID p_dev);
+XAF_ERR_CODE xaf_cmd_batch_end(pVOID p_dev);
 
 XAF_ERR_CODE xaf_comp_get_status(pVOID p_adev, pVOID p_comp, xaf_comp_status *p_status, pVOID p_info);
+XAF_ERR_CODE xaf_comp_set_completion_cb(pVOID p_comp, xaf_comp_completion_fxn_t cb, pVOID cb_data);
+XAF_ERR_CODE xaf_comp_wait_any(pVOID p_adev, pVOID *pp_comp);
 XAF_ERR_CODE xaf_get_verinfo(pUWORD8 ver_info[3]);
 
 XAF_ERR_CODE xaf_pause(pVOID p_comp, WORD32 port);
 XAF_ERR_CODE xaf_resume(pVOID p_comp, WORD32 port);
 
+/* ...commands recorded in a transaction are executed in order in one round trip */
+XAF_ERR_CODE xaf_txn_begin(pVOID p_adev, pVOID *pp_txn);
+XAF_ERR_CODE xaf_txn_set_config(pVOID p_txn, pVOID p_comp, WORD32 num_param, pWORD32 p_param);
+XAF_ERR_CODE xaf_txn_get_config(pVOID p_txn, pVOID p_comp, WORD32 num_param, pWORD32 p_param);
+XAF_ERR_CODE xaf_txn_pause(pVOID p_txn, pVOID p_comp, WORD32 port);
+XAF_ERR_CODE xaf_txn_resume(pVOID p_txn, pVOID p_comp, WORD32 port);
+XAF_ERR_CODE xaf_txn_connect(pVOID p_txn, pVOID p_src, WORD32 src_out_port, pVOID p_dest, WORD32 dest_in_port, WORD32 num_buf);
+XAF_ERR_CODE xaf_txn_commit(pVOID p_txn, WORD32 *p_status);
+XAF_ERR_CODE xaf_txn_abort(pVOID p_txn);
+
+/* ...create, configure, start and connect a whole graph; component handles are returned in p_comp[] */
+XAF_ERR_CODE xaf_graph_create(pVOID p_adev, xaf_graph_t *p_graph, pVOID p_comp[]);
+XAF_ERR_CODE xaf_graph_delete(xaf_graph_t *p_graph, pVOID p_comp[]);
+
 XAF_ERR_CODE xaf_probe_start(pVOID p_comp);
 XAF_ERR_CODE xaf_probe_stop(pVOID p_comp);
 
 #ifndef XA_DISABLE_EVENT
 XAF_ERR_CODE xaf_create_event_channel(pVOID p_src, UWORD32 src_config_param, pVOID p_dest, UWORD32 dst_config_param, UWORD32 nbuf, UWORD32 buf_size);
 XAF_ERR_CODE xaf_delete_event_channel(pVOID p_src, UWORD32 src_config_param, pVOID p_dest, UWORD32 dst_config_param);
+XAF_ERR_CODE xaf_create_event_channel_ext(pVOID p_src, UWORD32 src_config_param, pVOID p_dest, UWORD32 dst_config_param, UWORD32 nbuf, UWORD32 buf_size, xaf_event_channel_config_t *p_cfg);
+XAF_ERR_CODE xaf_get_event_channel_stats(pVOID p_src, UWORD32 src_config_param, pVOID p_dest, UWORD32 dst_config_param, xaf_event_channel_stats_t *p_stats);
 #endif
 
 #ifndef XA_DISABLE_DEPRECATED_API
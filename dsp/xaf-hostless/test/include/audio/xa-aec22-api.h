@@ -58,6 +58,7 @@ enum xa_config_param_aec22 {
     XA_AEC22_CONFIG_PARAM_PORT_RESUME       = 5,
     XA_AEC22_CONFIG_PARAM_PORT_CONNECT      = 6,
     XA_AEC22_CONFIG_PARAM_PORT_DISCONNECT   = 7,
+    XA_AEC22_CONFIG_PARAM_FRAME_SIZE        = 8,
 };
 
 /* ...component identifier (informative) */
@@ -87,4 +88,24 @@ enum xa_error_fatal_execute_aec22 {
     XA_AEC22_EXEC_FATAL_STATE       = XA_ERROR_CODE(xa_severity_fatal, xa_class_execute, XA_MIMO_PROC_AEC22, 0),
 };
 
+/*******************************************************************************
+ * API function definition
+ ******************************************************************************/
+
+#if defined(USE_DLL) && defined(_WIN32)
+#define DLL_SHARED __declspec(dllimport)
+#elif defined (_WINDLL)
+#define DLL_SHARED __declspec(dllexport)
+#else
+#define DLL_SHARED
+#endif
+
+#if defined(__cplusplus)
+extern "C" {
+#endif  /* __cplusplus */
+DLL_SHARED xa_codec_func_t xa_dummy_aec22;
+#if defined(__cplusplus)
+}
+#endif  /* __cplusplus */
+
 #endif /* __XA_AEC22_API_H__ */
@@ -58,6 +58,7 @@ enum xa_config_param_aec23 {
     XA_AEC23_CONFIG_PARAM_PORT_RESUME       = 5,
     XA_AEC23_CONFIG_PARAM_PORT_CONNECT      = 6,
     XA_AEC23_CONFIG_PARAM_PORT_DISCONNECT   = 7,
+    XA_AEC23_CONFIG_PARAM_FRAME_SIZE        = 8,
 };
 
 /* ...component identifier (informative) */
@@ -58,7 +58,9 @@ enum xa_config_param_microspeech {
     XA_MICROSPEECH_INFERENCE_CONFIG_PARAM_SAMPLE_RATE       = XA_INFERENCE_CONFIG_PARAM_SAMPLE_RATE,
     XA_MICROSPEECH_INFERENCE_CONFIG_PARAM_PCM_WIDTH         = XA_INFERENCE_CONFIG_PARAM_PCM_WIDTH,
     XA_MICROSPEECH_INFERENCE_CONFIG_PARAM_PRODUCED          = XA_INFERENCE_CONFIG_PARAM_PRODUCED,
-    XA_MICROSPEECH_INFERENCE_CONFIG_PARAM_FRAME_SIZE        = XA_INFERENCE_CONFIG_PARAM_FRAME_SIZE
+    XA_MICROSPEECH_INFERENCE_CONFIG_PARAM_FRAME_SIZE        = XA_INFERENCE_CONFIG_PARAM_FRAME_SIZE,
+    XA_MICROSPEECH_INFERENCE_CONFIG_PARAM_BYTES_COPIED      = XA_INFERENCE_CONFIG_PARAM_BYTES_COPIED,
+    XA_MICROSPEECH_INFERENCE_CONFIG_PARAM_SHARED_ARENA      = XA_INFERENCE_CONFIG_PARAM_SHARED_ARENA
 };
 
 /* ...microspeech component identifier (informative) */
@@ -61,8 +61,11 @@ enum xa_config_param_pcm_gain {
     XA_PCM_GAIN_BURN_ADDITIONAL_CYCLES         = 0x6,  /* Parameter to simulate desired MHz load in PCM-GAIN for experimental purpose */
     XA_PCM_GAIN_CONFIG_PARAM_FRAME_SIZE_IN_SAMPLES = 0x7,
 #ifndef XA_DISABLE_EVENT
-    XA_PCM_GAIN_CONFIG_PARAM_EVENT_GAIN_FACTOR = 0x8
+    XA_PCM_GAIN_CONFIG_PARAM_EVENT_GAIN_FACTOR = 0x8,
 #endif
+    XA_PCM_GAIN_CONFIG_PARAM_GAIN_LINEAR       = 0x9,  /* linear gain, Q12 */
+    XA_PCM_GAIN_CONFIG_PARAM_GAIN_DB           = 0xA,  /* gain in 1/10 dB, set only */
+    XA_PCM_GAIN_CONFIG_PARAM_RAMP_LENGTH       = 0xB   /* gain change ramp length per channel in samples; 0 - instant */
 
 };
 
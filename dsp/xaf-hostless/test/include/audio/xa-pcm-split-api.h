@@ -58,8 +58,14 @@ enum xa_config_param_pcm_split {
     XA_PCM_SPLIT_CONFIG_PARAM_PORT_RESUME       = 5,
     XA_PCM_SPLIT_CONFIG_PARAM_PORT_CONNECT      = 6,
     XA_PCM_SPLIT_CONFIG_PARAM_PORT_DISCONNECT   = 7,
+    XA_PCM_SPLIT_CONFIG_PARAM_FRAME_SIZE        = 8,    /* samples per channel per buffer; 0 - default 4 KB buffers */
+    XA_PCM_SPLIT_CONFIG_PARAM_NUM_OUTPUTS       = 9,    /* up to and by default the ports of the component: 2 (mimo-proc12), 4 (mimo-proc14), 8 (mimo-proc18) */
+    XA_PCM_SPLIT_CONFIG_PARAM_INPORT_BYPASS     = 10,   /* 1 - read input in place from upstream buffers */
 };
 
+/* ...maximal number of output ports */
+#define XA_PCM_SPLIT_MAX_OUTPUTS                8
+
 /* ...component identifier (informative) */
 #define XA_MIMO_PROC_PCM_SPLIT                  0x23
 
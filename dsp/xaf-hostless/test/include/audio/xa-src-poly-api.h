@@ -0,0 +1,179 @@
+/*
+* Copyright (c) 2015-2022 Cadence Design Systems Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to deal in the Software without restriction, including
+* without limitation the rights to use, copy, modify, merge, publish,
+* distribute, sublicense, and/or sell copies of the Software, and to
+* permit persons to whom the Software is furnished to do so, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/*******************************************************************************
+ * xa-src-poly-api.h
+ *
+ * Polyphase sample-rate converter component API
+ ******************************************************************************/
+
+#ifndef __XA_SRC_POLY_API_H__
+#define __XA_SRC_POLY_API_H__
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+/* ...generic commands */
+#include "xa_apicmd_standards.h"
+
+/* ...generic error codes */
+#include "xa_error_standards.h"
+
+/* ...common types */
+#include "xa_type_def.h"
+
+#include "xa_memory_standards.h"
+
+#include "xa-audio-decoder-api.h"
+
+/*******************************************************************************
+ * Constants definitions
+ ******************************************************************************/
+
+/* ...configuration parameters; ids 0x0..0x5 match the SRC-PP library parameters */
+enum xa_config_param_src_poly {
+    XA_SRC_POLY_CONFIG_PARAM_INPUT_SAMPLE_RATE   = 0x0,
+    XA_SRC_POLY_CONFIG_PARAM_OUTPUT_SAMPLE_RATE  = 0x1,
+    XA_SRC_POLY_CONFIG_PARAM_INPUT_CHUNK_SIZE    = 0x2,  /* input frame size per channel in samples */
+    XA_SRC_POLY_CONFIG_PARAM_OUTPUT_CHUNK_SIZE   = 0x3,  /* samples per channel produced by last execution, get only */
+    XA_SRC_POLY_CONFIG_PARAM_INPUT_CHANNELS      = 0x4,
+    XA_SRC_POLY_CONFIG_PARAM_BYTES_PER_SAMPLE    = 0x5,  /* 2, 3 (MSB-aligned in 4 bytes) or 4 */
+    XA_SRC_POLY_CONFIG_PARAM_QUALITY            = 0x6,  /* XA_SRC_POLY_QUALITY_* */
+    XA_SRC_POLY_CONFIG_PARAM_COEF               = 0x7   /* Q15 polyphase table, set only; see below */
+};
+
+/* ...maximal filter length */
+#define XA_SRC_POLY_TAPS_MAX            192
+
+/* ...filter length used for a quality level's base length; down-conversion stretches the filter by the rate ratio
+ * so that it keeps its length in output samples and the anti-aliasing of the level; rounded up to a multiple of 4
+ * and limited to XA_SRC_POLY_TAPS_MAX, which still leaves the low quality length for the largest supported ratio */
+#define XA_SRC_POLY_TAPS(taps, in_fs, out_fs)                                       \
+    ((in_fs) <= (out_fs) ? (taps) :                                                 \
+     ((taps) * (in_fs) > XA_SRC_POLY_TAPS_MAX * (out_fs) ? XA_SRC_POLY_TAPS_MAX :   \
+      ((((taps) * (in_fs) + (out_fs) - 1) / (out_fs)) + 3) & ~3))
+
+/* ...custom coefficient table replacing the designed one: (phases + 1) rows of taps WORD16 values,
+ * row p holding the filter of fractional delay p / phases, tap 0 applied to the newest sample; streamed with xaf_comp_set_config_stream after initialization is done,
+ * the table is switched at the last chunk and re-initialization restores the designed table */
+#define XA_SRC_POLY_COEF_SIZE(taps, phases)    (((phases) + 1) * (taps) * sizeof(WORD16))
+
+/* ...quality levels; filter length and phase resolution trade quality for cycles; lengths are base ones, see XA_SRC_POLY_TAPS */
+enum xa_src_poly_quality {
+    XA_SRC_POLY_QUALITY_LOW     = 0,    /* 8 taps, 32 phases, nearest phase */
+    XA_SRC_POLY_QUALITY_MEDIUM  = 1,    /* 16 taps, 64 phases, interpolated phase */
+    XA_SRC_POLY_QUALITY_HIGH    = 2,    /* 32 taps, 64 phases, interpolated phase */
+    XA_SRC_POLY_QUALITY_NUM     = 3
+};
+
+/* ...supported sample rate range */
+#define XA_SRC_POLY_MIN_SAMPLE_RATE     8000
+#define XA_SRC_POLY_MAX_SAMPLE_RATE     192000
+
+/* ...maximal number of channels */
+#define XA_SRC_POLY_MAX_CHANNELS        8
+
+/* ...component identifier (informative) */
+#define XA_CODEC_SRC_POLY               0x13
+
+/*******************************************************************************
+ * Class 0: API Errors
+ ******************************************************************************/
+
+#define XA_SRC_POLY_API_NONFATAL(e)        \
+    XA_ERROR_CODE(xa_severity_nonfatal, xa_class_api, XA_CODEC_SRC_POLY, (e))
+
+#define XA_SRC_POLY_API_FATAL(e)           \
+    XA_ERROR_CODE(xa_severity_fatal, xa_class_api, XA_CODEC_SRC_POLY, (e))
+
+enum xa_error_nonfatal_api_src_poly {
+    XA_SRC_POLY_API_NONFATAL_MAX = XA_SRC_POLY_API_NONFATAL(0)
+};
+
+enum xa_error_fatal_api_src_poly {
+    XA_SRC_POLY_API_FATAL_MAX = XA_SRC_POLY_API_FATAL(0)
+};
+
+/*******************************************************************************
+ * Class 1: Configuration Errors
+ ******************************************************************************/
+
+#define XA_SRC_POLY_CONFIG_NONFATAL(e)     \
+    XA_ERROR_CODE(xa_severity_nonfatal, xa_class_config, XA_CODEC_SRC_POLY, (e))
+
+#define XA_SRC_POLY_CONFIG_FATAL(e)        \
+    XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_CODEC_SRC_POLY, (e))
+
+enum xa_error_nonfatal_config_src_poly {
+    XA_SRC_POLY_CONFIG_NONFATAL_RANGE  = XA_SRC_POLY_CONFIG_NONFATAL(0),
+    XA_SRC_POLY_CONFIG_NONFATAL_STATE  = XA_SRC_POLY_CONFIG_NONFATAL(1),
+    XA_SRC_POLY_CONFIG_NONFATAL_MAX    = XA_SRC_POLY_CONFIG_NONFATAL(2)
+};
+
+enum xa_error_fatal_config_src_poly {
+    XA_SRC_POLY_CONFIG_FATAL_RANGE     = XA_SRC_POLY_CONFIG_FATAL(0),
+    XA_SRC_POLY_CONFIG_FATAL_STATE     = XA_SRC_POLY_CONFIG_FATAL(1),
+    XA_SRC_POLY_CONFIG_FATAL_MAX       = XA_SRC_POLY_CONFIG_FATAL(2)
+};
+
+/*******************************************************************************
+ * Class 2: Execution Class Errors
+ ******************************************************************************/
+
+#define XA_SRC_POLY_EXEC_NONFATAL(e)       \
+    XA_ERROR_CODE(xa_severity_nonfatal, xa_class_execute, XA_CODEC_SRC_POLY, (e))
+
+#define XA_SRC_POLY_EXEC_FATAL(e)          \
+    XA_ERROR_CODE(xa_severity_fatal, xa_class_execute, XA_CODEC_SRC_POLY, (e))
+
+enum xa_error_nonfatal_execute_src_poly {
+    XA_SRC_POLY_EXEC_NONFATAL_STATE    = XA_SRC_POLY_EXEC_NONFATAL(0),
+    XA_SRC_POLY_EXEC_NONFATAL_INPUT    = XA_SRC_POLY_EXEC_NONFATAL(1),
+    XA_SRC_POLY_EXEC_NONFATAL_OUTPUT   = XA_SRC_POLY_EXEC_NONFATAL(2),
+    XA_SRC_POLY_EXEC_NONFATAL_MAX      = XA_SRC_POLY_EXEC_NONFATAL(3)
+};
+
+enum xa_error_fatal_execute_src_poly {
+    XA_SRC_POLY_EXEC_FATAL_STATE       = XA_SRC_POLY_EXEC_FATAL(0),
+    XA_SRC_POLY_EXEC_FATAL_INPUT       = XA_SRC_POLY_EXEC_FATAL(1),
+    XA_SRC_POLY_EXEC_FATAL_OUTPUT      = XA_SRC_POLY_EXEC_FATAL(2),
+    XA_SRC_POLY_EXEC_FATAL_MAX         = XA_SRC_POLY_EXEC_FATAL(3)
+};
+
+#if defined(USE_DLL) && defined(_WIN32)
+#define DLL_SHARED __declspec(dllimport)
+#elif defined (_WINDLL)
+#define DLL_SHARED __declspec(dllexport)
+#else
+#define DLL_SHARED
+#endif
+
+#if defined(__cplusplus)
+extern "C" {
+#endif  /* __cplusplus */
+DLL_SHARED xa_codec_func_t xa_src_poly;
+#if defined(__cplusplus)
+}
+#endif  /* __cplusplus */
+
+#endif /* __XA_SRC_POLY_API_H__ */
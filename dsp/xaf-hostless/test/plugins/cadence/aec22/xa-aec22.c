@@ -52,6 +52,8 @@ extern clk_t aec22_cycles;
 #define XA_MIMO_CFG_DEFAULT_PCM_WIDTH	16
 #define XA_MIMO_CFG_DEFAULT_CHANNELS	2
 #define XA_MIMO_CFG_FRAME_SIZE_BYTES	1024
+#define XA_MIMO_CFG_MAX_FRAME_SIZE	4096
+#define XA_MIMO_CFG_MAX_CHANNELS	8
 
 #define XA_MIMO_CFG_PERSIST_SIZE	4	
 #define XA_MIMO_CFG_SCRATCH_SIZE	4
@@ -112,6 +114,9 @@ typedef struct XAPcmAec
     UWORD32                 pcm_width;
     UWORD32                 channels;
 
+    /* ...frame length in samples per channel; 0 - default frame of XA_MIMO_CFG_FRAME_SIZE_BYTES */
+    UWORD32                 frame_size;
+
     WORD16		    port_state[XA_MIMO_IN_PORTS + XA_MIMO_OUT_PORTS];
 
 }   XAPcmAec;
@@ -149,6 +154,8 @@ static const WORD16 pcm_gains_aec[7]    = {4096, 2053, 1029, 516, 8173, 16306, 3
 
 #define MAX_16BIT (32767)
 #define MIN_16BIT (-32768)
+#define MAX_32BIT ((WORD64)(WORD32)0x7FFFFFFF)
+#define MIN_32BIT ((WORD64)(WORD32)0x80000000)
 
 /*******************************************************************************
  * DSP functions
@@ -174,19 +181,54 @@ static inline void xa_aec_preinit(XAPcmAec *d)
     d->scratch_size 	= XA_MIMO_CFG_SCRATCH_SIZE;
 }
 
-/* ...do pcm-gain scaling of stereo PCM-16 streams */
-static XA_ERRORCODE xa_aec_do_execute_stereo_16bit(XAPcmAec *d)
+/* ...scale input by Q12 gain and zero-pad output to a full frame; 24-bit samples are MSB-aligned in 32-bit containers */
+static void xa_aec_apply_gain(void *out, void *in, UWORD32 in_bytes, UWORD32 frame_bytes, WORD16 gain, UWORD32 pcm_width)
 {
-    WORD32     i, nSize, ilen;
-    WORD32     product0, product1;
+    UWORD32     i, n;
+
+    in_bytes = _MIN(in_bytes, frame_bytes);
+
+    if (pcm_width == 16)
+    {
+        WORD16  *pIn = (WORD16 *) in;
+        WORD16  *pOut = (WORD16 *) out;
+        WORD32  product;
+
+        for (i = 0, n = in_bytes >> 1; i < n; i++)
+        {
+            product = ((WORD32)pIn[i] * gain) >> 12;
+            pOut[i] = (WORD16)_MIN(MAX_16BIT, _MAX(product, MIN_16BIT));
+        }
+    }
+    else
+    {
+        WORD32  *pIn = (WORD32 *) in;
+        WORD32  *pOut = (WORD32 *) out;
+        WORD32  mask = (pcm_width == 24 ? (WORD32)0xFFFFFF00 : (WORD32)0xFFFFFFFF);
+        WORD64  product;
+
+        for (i = 0, n = in_bytes >> 2; i < n; i++)
+        {
+            product = ((WORD64)pIn[i] * gain) >> 12;
+            pOut[i] = (WORD32)_MIN(MAX_32BIT, _MAX(product, MIN_32BIT)) & mask;
+        }
+    }
+
+    memset((WORD8 *)out + in_bytes, 0, frame_bytes - in_bytes);
+}
+
+/* ...do pcm-gain scaling of the input streams, one frame per call */
+static XA_ERRORCODE xa_aec_do_execute(XAPcmAec *d)
+{
+    WORD32     i, ilen;
 
     if((d->num_in_ports == 2) && (d->num_out_ports == 2))
     {
       /* 2 in, 2 out */
-      WORD16    *pIn0 = (WORD16 *) d->input[0];
-      WORD16    *pIn1 = (WORD16 *) d->input[1];
-      WORD16    *pOut0 = (WORD16 *) d->output[0];
-      WORD16    *pOut1 = (WORD16 *) d->output[1];
+      void      *pIn0 = d->input[0];
+      void      *pIn1 = d->input[1];
+      void      *pOut0 = d->output[0];
+      void      *pOut1 = d->output[1];
       WORD16    gain0 = pcm_gains_aec[0], gain1 = pcm_gains_aec[1];
 
       /* reset consumed/produced counters */
@@ -215,8 +257,8 @@ static XA_ERRORCODE xa_aec_do_execute_stereo_16bit(XAPcmAec *d)
       }
 
       /* consider port-0 as the master, consume at-least frame_size bytes from the same */
-      if( ((d->input_length[0] < XA_MIMO_CFG_FRAME_SIZE_BYTES) && !(d->port_state[0] & XA_AEC_FLAG_COMPLETE))
-        || ((d->input_length[1] < XA_MIMO_CFG_FRAME_SIZE_BYTES) && !(d->port_state[1] & XA_AEC_FLAG_COMPLETE))
+      if( ((d->input_length[0] < d->in_buffer_size) && !(d->port_state[0] & XA_AEC_FLAG_COMPLETE))
+        || ((d->input_length[1] < d->in_buffer_size) && !(d->port_state[1] & XA_AEC_FLAG_COMPLETE))
       )
       {
           if(!(d->port_state[1] & XA_AEC_FLAG_PORT_PAUSED)) /* return only if input port-1 is not paused */
@@ -233,52 +275,22 @@ static XA_ERRORCODE xa_aec_do_execute_stereo_16bit(XAPcmAec *d)
         return XA_NO_ERROR;
       }
 
-      nSize = XA_MIMO_CFG_FRAME_SIZE_BYTES >> 1;    //size of each sample is 2 bytes    
-
-      for (i=0;(i < d->input_length[0]>>1); i++)
-      {
-          WORD16   input0;
-          input0 = *pIn0++;
-          product0 = (WORD32)input0*gain0;
-          product0 = product0 >> 12;
-          
-          product0 = _MIN(MAX_16BIT, _MAX(product0, MIN_16BIT));
-          
-          *pOut0++ = (WORD16)product0;
-      }
-      for (;i < nSize; i++)
-      {
-          *pOut0++ = 0;
-      }
+      xa_aec_apply_gain(pOut0, pIn0, d->input_length[0], d->out_buffer_size, gain0, d->pcm_width);
 
-      ilen = (d->port_state[1] & XA_AEC_FLAG_PORT_PAUSED)? 0 :(d->input_length[1]>>1); /* zero feed if FEEDBACK input port is paused */
-      for (i=0;(i < ilen); i++)
-      {
-          WORD16   input1;
-          input1 = *pIn1++;
-          product1 = (WORD32)input1 * gain1;
-          product1 = product1 >> 12;
-          
-          product1 = _MIN(MAX_16BIT, _MAX(product1, MIN_16BIT));
-          
-          *pOut1++ = (WORD16)product1;
-      }
-      for (;i < nSize; i++)
-      {
-          *pOut1++ = 0;
-      }
+      ilen = (d->port_state[1] & XA_AEC_FLAG_PORT_PAUSED)? 0 : d->input_length[1]; /* zero feed if FEEDBACK input port is paused */
+      xa_aec_apply_gain(pOut1, pIn1, ilen, d->out_buffer_size, gain1, d->pcm_width);
 
       /* ...save total number of consumed bytes */
       d->consumed[0] = d->input_length[0];
       d->input_length[0] = 0;
-      d->produced[0] = XA_MIMO_CFG_FRAME_SIZE_BYTES;
+      d->produced[0] = d->out_buffer_size;
 
       if(ilen)
       {
         d->consumed[1] = d->input_length[1];
         d->input_length[1] = 0;
       }
-      d->produced[1] = XA_MIMO_CFG_FRAME_SIZE_BYTES;
+      d->produced[1] = d->out_buffer_size;
       
       /* ...put flag saying we have output buffer */
       d->state |= XA_AEC_FLAG_OUTPUT;
@@ -291,7 +303,7 @@ static XA_ERRORCODE xa_aec_do_execute_stereo_16bit(XAPcmAec *d)
 	      d->state |= XA_AEC_FLAG_EXEC_DONE;
       }
 
-      TRACE(PROCESS, _b("consumed: (%u, %u) bytes, produced: (%u, %u) bytes (%u samples)"), d->consumed[0], d->consumed[1], d->produced[0], d->produced[1], nSize);
+      TRACE(PROCESS, _b("consumed: (%u, %u) bytes, produced: (%u, %u) bytes (frame %u bytes)"), d->consumed[0], d->consumed[1], d->produced[0], d->produced[1], d->out_buffer_size);
     }
     else
     {
@@ -349,8 +361,12 @@ static XA_ERRORCODE xa_aec_init(XAPcmAec *d, WORD32 i_idx, pVOID pv_value)
         /* ...post-configuration initialization (all parameters are set) */
         XF_CHK_ERR(d->state & XA_AEC_FLAG_PREINIT_DONE, XA_API_FATAL_INVALID_CMD_TYPE);
     
-        /* ...calculate input/output buffer size in bytes */
-        //d->in_buffer_size = d->channels * d->frame_size * (d->pcm_width == 16 ? sizeof(WORD16) : sizeof(WORD32));
+        /* ...calculate input/output buffer size in bytes; 24-bit samples use 32-bit containers */
+        if (d->frame_size)
+        {
+            d->in_buffer_size = d->channels * d->frame_size * (d->pcm_width == 16 ? sizeof(WORD16) : sizeof(WORD32));
+            d->out_buffer_size = d->in_buffer_size;
+        }
         
         /* ...mark post-initialization is complete */
         d->state |= XA_AEC_FLAG_POSTINIT_DONE;
@@ -434,17 +450,26 @@ static XA_ERRORCODE xa_aec_set_config_param(XAPcmAec *d, WORD32 i_idx, pVOID pv_
         }
 
     case XA_AEC22_CONFIG_PARAM_PCM_WIDTH:
-        /* ...check value is permitted (16 bits only) */
-        XF_CHK_ERR(i_value == 16, XA_AEC22_CONFIG_FATAL_RANGE);
+        /* ...check value is permitted (16, 24 or 32 bits); buffer sizes are fixed after post-initialization */
+        XF_CHK_ERR(!(d->state & XA_AEC_FLAG_POSTINIT_DONE), XA_AEC22_CONFIG_FATAL_RANGE);
+        XF_CHK_ERR((i_value == 16) || (i_value == 24) || (i_value == 32), XA_AEC22_CONFIG_FATAL_RANGE);
         d->pcm_width = (UWORD32)i_value;
 	break;
 
     case XA_AEC22_CONFIG_PARAM_CHANNELS:
-        /* ...allow stereo only */
-        XF_CHK_ERR((i_value <= 2) && (i_value > 0), XA_AEC22_CONFIG_FATAL_RANGE);
+        /* ...allow upto XA_MIMO_CFG_MAX_CHANNELS channels */
+        XF_CHK_ERR(!(d->state & XA_AEC_FLAG_POSTINIT_DONE), XA_AEC22_CONFIG_FATAL_RANGE);
+        XF_CHK_ERR((i_value <= XA_MIMO_CFG_MAX_CHANNELS) && (i_value > 0), XA_AEC22_CONFIG_FATAL_RANGE);
         d->channels = (UWORD32)i_value;
 	break;
 
+    case XA_AEC22_CONFIG_PARAM_FRAME_SIZE:
+        /* ...frame length in samples per channel; 0 restores the default frame */
+        XF_CHK_ERR(!(d->state & XA_AEC_FLAG_POSTINIT_DONE), XA_AEC22_CONFIG_FATAL_RANGE);
+        XF_CHK_ERR(i_value <= XA_MIMO_CFG_MAX_FRAME_SIZE, XA_AEC22_CONFIG_FATAL_RANGE);
+        d->frame_size = (UWORD32)i_value;
+	break;
+
     case XA_AEC22_CONFIG_PARAM_PORT_PAUSE:
         {
           XF_CHK_ERR((i_value < (d->num_in_ports + d->num_out_ports)), XA_AEC22_CONFIG_FATAL_RANGE);
@@ -512,6 +537,11 @@ static XA_ERRORCODE xa_aec_get_config_param(XAPcmAec *d, WORD32 i_idx, pVOID pv_
         *(WORD32 *)pv_value = d->channels;
         return XA_NO_ERROR;
 
+    case XA_AEC22_CONFIG_PARAM_FRAME_SIZE:
+        /* ...return frame length in samples per channel */
+        *(WORD32 *)pv_value = (d->frame_size ? d->frame_size : d->in_buffer_size / (d->channels * (d->pcm_width == 16 ? sizeof(WORD16) : sizeof(WORD32))));
+        return XA_NO_ERROR;
+
     default:
         TRACE(ERROR, _x("Invalid parameter: %X"), i_idx);
         return XA_API_FATAL_INVALID_CMD_TYPE;
@@ -540,7 +570,7 @@ static XA_ERRORCODE xa_aec_execute(XAPcmAec *d, WORD32 i_idx, pVOID pv_value)
 #ifdef XAF_PROFILE
         aec22_start = clk_read_start(CLK_SELN_THREAD);
 #endif
-        ret = xa_aec_do_execute_stereo_16bit(d);
+        ret = xa_aec_do_execute(d);
 #ifdef XAF_PROFILE
         aec22_stop = clk_read_stop(CLK_SELN_THREAD);
         aec22_cycles += clk_diff(aec22_stop, aec22_start);
@@ -52,6 +52,8 @@ extern clk_t aec23_cycles;
 #define XA_MIMO_CFG_DEFAULT_PCM_WIDTH	16
 #define XA_MIMO_CFG_DEFAULT_CHANNELS	2
 #define XA_MIMO_CFG_FRAME_SIZE_BYTES	1024
+#define XA_MIMO_CFG_MAX_FRAME_SIZE	4096
+#define XA_MIMO_CFG_MAX_CHANNELS	8
 
 #define XA_MIMO_CFG_PERSIST_SIZE	4	
 #define XA_MIMO_CFG_SCRATCH_SIZE	4
@@ -112,6 +114,9 @@ typedef struct XAPcmAec
     UWORD32                 pcm_width;
     UWORD32                 channels;
 
+    /* ...frame length in samples per channel; 0 - default frame of XA_MIMO_CFG_FRAME_SIZE_BYTES */
+    UWORD32                 frame_size;
+
     WORD16		    port_state[XA_MIMO_IN_PORTS + XA_MIMO_OUT_PORTS];
 
 }   XAPcmAec;
@@ -150,6 +155,8 @@ static const WORD16 pcm_gains_aec[7]    = {4096, 2053, 1029, 516, 8173, 16306, 3
 
 #define MAX_16BIT (32767)
 #define MIN_16BIT (-32768)
+#define MAX_32BIT ((WORD64)(WORD32)0x7FFFFFFF)
+#define MIN_32BIT ((WORD64)(WORD32)0x80000000)
 
 /*******************************************************************************
  * DSP functions
@@ -176,20 +183,55 @@ static inline void xa_aec_preinit(XAPcmAec *d)
     //d->port_state[4]    = XA_AEC_FLAG_PORT_PAUSED;
 }
 
-/* ...do pcm-gain scaling of stereo PCM-16 streams */
-static XA_ERRORCODE xa_aec_do_execute_stereo_16bit(XAPcmAec *d)
+/* ...scale input by Q12 gain and zero-pad output to a full frame; 24-bit samples are MSB-aligned in 32-bit containers */
+static void xa_aec_apply_gain(void *out, void *in, UWORD32 in_bytes, UWORD32 frame_bytes, WORD16 gain, UWORD32 pcm_width)
 {
-    WORD32     i, nSize, in_length;
-    WORD32     product0, product1;
+    UWORD32     i, n;
+
+    in_bytes = _MIN(in_bytes, frame_bytes);
+
+    if (pcm_width == 16)
+    {
+        WORD16  *pIn = (WORD16 *) in;
+        WORD16  *pOut = (WORD16 *) out;
+        WORD32  product;
+
+        for (i = 0, n = in_bytes >> 1; i < n; i++)
+        {
+            product = ((WORD32)pIn[i] * gain) >> 12;
+            pOut[i] = (WORD16)_MIN(MAX_16BIT, _MAX(product, MIN_16BIT));
+        }
+    }
+    else
+    {
+        WORD32  *pIn = (WORD32 *) in;
+        WORD32  *pOut = (WORD32 *) out;
+        WORD32  mask = (pcm_width == 24 ? (WORD32)0xFFFFFF00 : (WORD32)0xFFFFFFFF);
+        WORD64  product;
+
+        for (i = 0, n = in_bytes >> 2; i < n; i++)
+        {
+            product = ((WORD64)pIn[i] * gain) >> 12;
+            pOut[i] = (WORD32)_MIN(MAX_32BIT, _MAX(product, MIN_32BIT)) & mask;
+        }
+    }
+
+    memset((WORD8 *)out + in_bytes, 0, frame_bytes - in_bytes);
+}
+
+/* ...do pcm-gain scaling of the input streams, one frame per call */
+static XA_ERRORCODE xa_aec_do_execute(XAPcmAec *d)
+{
+    WORD32     i, in_length;
 
     if((d->num_in_ports == 2) && (d->num_out_ports == 3))
     {
       /* 2 in, 2 out */
-      WORD16    *pIn0 = (WORD16 *) d->input[0];
-      WORD16    *pIn1 = (WORD16 *) d->input[1];
-      WORD16    *pOut0 = (WORD16 *) d->output[0];
-      WORD16    *pOut1 = (WORD16 *) d->output[1];
-      WORD16    *pOut2 = (WORD16 *) d->output[2];
+      void      *pIn0 = d->input[0];
+      void      *pIn1 = d->input[1];
+      void      *pOut0 = d->output[0];
+      void      *pOut1 = d->output[1];
+      void      *pOut2 = d->output[2];
       WORD16    gain0 = pcm_gains_aec[0], gain1 = pcm_gains_aec[0];
 
       /* reset consumed/produced counters */
@@ -249,8 +291,8 @@ static XA_ERRORCODE xa_aec_do_execute_stereo_16bit(XAPcmAec *d)
           return XA_AEC23_EXEC_NONFATAL_NO_DATA;
       }
 
-      if(  ((d->input_length[0] < XA_MIMO_CFG_FRAME_SIZE_BYTES) && !(d->port_state[0] & XA_AEC_FLAG_INPUT_OVER) && !(d->port_state[0] & XA_AEC_FLAG_COMPLETE))
-        || ((d->input_length[1] < XA_MIMO_CFG_FRAME_SIZE_BYTES) && !(d->port_state[1] & XA_AEC_FLAG_INPUT_OVER) && !(d->port_state[1] & XA_AEC_FLAG_COMPLETE))
+      if(  ((d->input_length[0] < d->in_buffer_size) && !(d->port_state[0] & XA_AEC_FLAG_INPUT_OVER) && !(d->port_state[0] & XA_AEC_FLAG_COMPLETE))
+        || ((d->input_length[1] < d->in_buffer_size) && !(d->port_state[1] & XA_AEC_FLAG_INPUT_OVER) && !(d->port_state[1] & XA_AEC_FLAG_COMPLETE))
       )
       {
     	  /* return only if input port-1 is not paused AND is connected */
@@ -295,72 +337,27 @@ static XA_ERRORCODE xa_aec_do_execute_stereo_16bit(XAPcmAec *d)
             }
       }
 
-      nSize = XA_MIMO_CFG_FRAME_SIZE_BYTES >> 1;    //size of each sample is 2 bytes    
-
-      for (i=0;(i < d->input_length[0]>>1); i++)
-      {
-          WORD16   input0;
-          input0 = *pIn0++;
-          product0 = (WORD32)input0*gain0;
-          product0 = product0 >> 12;
-          
-          product0 = _MIN(MAX_16BIT, _MAX(product0, MIN_16BIT));
-          
-          *pOut0++ = (WORD16)product0;
-      }
-      for (;i < nSize; i++)
-      {
-          *pOut0++ = 0;
-      }
+      xa_aec_apply_gain(pOut0, pIn0, d->input_length[0], d->out_buffer_size, gain0, d->pcm_width);
       /* ...save total number of consumed bytes */
       d->consumed[0] = d->input_length[0];
       d->input_length[0] = 0;
-      d->produced[0] = XA_MIMO_CFG_FRAME_SIZE_BYTES;
+      d->produced[0] = d->out_buffer_size;
 
       /* zero feed if FEEDBACK input port is paused OR not connected */
-      in_length = ((d->port_state[1] & XA_AEC_FLAG_PORT_PAUSED) || !(d->port_state[1] & XA_AEC_FLAG_PORT_CONNECTED))? 0 :(d->input_length[1]>>1);
-      for (i=0;(i < in_length); i++)
-      {
-          WORD16   input1;
-          input1 = *pIn1++;
-          product1 = (WORD32)input1 * gain1;
-          product1 = product1 >> 12;
-          
-          product1 = _MIN(MAX_16BIT, _MAX(product1, MIN_16BIT));
-          
-          *pOut1++ = (WORD16)product1;
-      }
-      for (;i < nSize; i++)
-      {
-          *pOut1++ = 0;
-      }
+      in_length = ((d->port_state[1] & XA_AEC_FLAG_PORT_PAUSED) || !(d->port_state[1] & XA_AEC_FLAG_PORT_CONNECTED))? 0 : d->input_length[1];
+      xa_aec_apply_gain(pOut1, pIn1, in_length, d->out_buffer_size, gain1, d->pcm_width);
       /* ...save total number of consumed bytes */
       if(in_length)
       {
         d->consumed[1] = d->input_length[1];
         d->input_length[1] = 0;
       }
-      d->produced[1] = XA_MIMO_CFG_FRAME_SIZE_BYTES;
+      d->produced[1] = d->out_buffer_size;
       
       if(!(d->port_state[4] & XA_AEC_FLAG_PORT_PAUSED) && (d->port_state[4] & XA_AEC_FLAG_PORT_CONNECTED))
       {
-        WORD16    *pIn1 = (WORD16 *) d->input[1];
-        for (i=0;(i < in_length); i++)
-        {
-            WORD16   input1;
-            input1 = *pIn1++;
-            product1 = (WORD32)input1 * gain1;
-            product1 = product1 >> 12;
-            
-            product1 = _MIN(MAX_16BIT, _MAX(product1, MIN_16BIT));
-            
-            *pOut2++ = (WORD16)product1;
-        }
-        for (;i < nSize; i++)
-        {
-            *pOut2++ = 0;
-        }
-        d->produced[2] = XA_MIMO_CFG_FRAME_SIZE_BYTES;
+        xa_aec_apply_gain(pOut2, pIn1, in_length, d->out_buffer_size, gain1, d->pcm_width);
+        d->produced[2] = d->out_buffer_size;
       }
       
       /* ...put flag saying we have output buffer */
@@ -390,7 +387,7 @@ static XA_ERRORCODE xa_aec_do_execute_stereo_16bit(XAPcmAec *d)
 	      d->state |= XA_AEC_FLAG_EXEC_DONE;
       }
 
-      TRACE(PROCESS, _b("consumed: (%u, %u) bytes, produced: (%u, %u, %u) bytes (%u samples)"), d->consumed[0], d->consumed[1], d->produced[0], d->produced[1], d->produced[2], nSize);
+      TRACE(PROCESS, _b("consumed: (%u, %u) bytes, produced: (%u, %u, %u) bytes (frame %u bytes)"), d->consumed[0], d->consumed[1], d->produced[0], d->produced[1], d->produced[2], d->out_buffer_size);
     }
     else
     {
@@ -448,8 +445,12 @@ static XA_ERRORCODE xa_aec_init(XAPcmAec *d, WORD32 i_idx, pVOID pv_value)
         /* ...post-configuration initialization (all parameters are set) */
         XF_CHK_ERR(d->state & XA_AEC_FLAG_PREINIT_DONE, XA_API_FATAL_INVALID_CMD_TYPE);
     
-        /* ...calculate input/output buffer size in bytes */
-        //d->in_buffer_size = d->channels * d->frame_size * (d->pcm_width == 16 ? sizeof(WORD16) : sizeof(WORD32));
+        /* ...calculate input/output buffer size in bytes; 24-bit samples use 32-bit containers */
+        if (d->frame_size)
+        {
+            d->in_buffer_size = d->channels * d->frame_size * (d->pcm_width == 16 ? sizeof(WORD16) : sizeof(WORD32));
+            d->out_buffer_size = d->in_buffer_size;
+        }
         
         /* ...mark post-initialization is complete */
         d->state |= XA_AEC_FLAG_POSTINIT_DONE;
@@ -533,17 +534,26 @@ static XA_ERRORCODE xa_aec_set_config_param(XAPcmAec *d, WORD32 i_idx, pVOID pv_
         }
 
     case XA_AEC23_CONFIG_PARAM_PCM_WIDTH:
-        /* ...check value is permitted (16 bits only) */
-        XF_CHK_ERR(i_value == 16, XA_AEC23_CONFIG_FATAL_RANGE);
+        /* ...check value is permitted (16, 24 or 32 bits); buffer sizes are fixed after post-initialization */
+        XF_CHK_ERR(!(d->state & XA_AEC_FLAG_POSTINIT_DONE), XA_AEC23_CONFIG_FATAL_RANGE);
+        XF_CHK_ERR((i_value == 16) || (i_value == 24) || (i_value == 32), XA_AEC23_CONFIG_FATAL_RANGE);
         d->pcm_width = (UWORD32)i_value;
 	break;
 
     case XA_AEC23_CONFIG_PARAM_CHANNELS:
-        /* ...allow stereo only */
-        XF_CHK_ERR((i_value <= 2) && (i_value > 0), XA_AEC23_CONFIG_FATAL_RANGE);
+        /* ...allow upto XA_MIMO_CFG_MAX_CHANNELS channels */
+        XF_CHK_ERR(!(d->state & XA_AEC_FLAG_POSTINIT_DONE), XA_AEC23_CONFIG_FATAL_RANGE);
+        XF_CHK_ERR((i_value <= XA_MIMO_CFG_MAX_CHANNELS) && (i_value > 0), XA_AEC23_CONFIG_FATAL_RANGE);
         d->channels = (UWORD32)i_value;
 	break;
 
+    case XA_AEC23_CONFIG_PARAM_FRAME_SIZE:
+        /* ...frame length in samples per channel; 0 restores the default frame */
+        XF_CHK_ERR(!(d->state & XA_AEC_FLAG_POSTINIT_DONE), XA_AEC23_CONFIG_FATAL_RANGE);
+        XF_CHK_ERR(i_value <= XA_MIMO_CFG_MAX_FRAME_SIZE, XA_AEC23_CONFIG_FATAL_RANGE);
+        d->frame_size = (UWORD32)i_value;
+	break;
+
     case XA_AEC23_CONFIG_PARAM_PORT_PAUSE:
         {
           XF_CHK_ERR((i_value < (d->num_in_ports + d->num_out_ports)), XA_AEC23_CONFIG_FATAL_RANGE);
@@ -611,6 +621,11 @@ static XA_ERRORCODE xa_aec_get_config_param(XAPcmAec *d, WORD32 i_idx, pVOID pv_
         *(WORD32 *)pv_value = d->channels;
         return XA_NO_ERROR;
 
+    case XA_AEC23_CONFIG_PARAM_FRAME_SIZE:
+        /* ...return frame length in samples per channel */
+        *(WORD32 *)pv_value = (d->frame_size ? d->frame_size : d->in_buffer_size / (d->channels * (d->pcm_width == 16 ? sizeof(WORD16) : sizeof(WORD32))));
+        return XA_NO_ERROR;
+
     default:
         TRACE(ERROR, _x("Invalid parameter: %X"), i_idx);
         return XA_API_FATAL_INVALID_CMD_TYPE;
@@ -639,7 +654,7 @@ static XA_ERRORCODE xa_aec_execute(XAPcmAec *d, WORD32 i_idx, pVOID pv_value)
 #ifdef XAF_PROFILE
         aec23_start = clk_read_start(CLK_SELN_THREAD);
 #endif
-        ret = xa_aec_do_execute_stereo_16bit(d);
+        ret = xa_aec_do_execute(d);
 #ifdef XAF_PROFILE
         aec23_stop = clk_read_stop(CLK_SELN_THREAD);
         aec23_cycles += clk_diff(aec23_stop, aec23_start);
@@ -52,6 +52,7 @@
  * Includes
  ******************************************************************************/
 #include "osal-timer.h"
+#include "osal-thread.h"
 #include <stdio.h>
 #include "audio/xa-capturer-api.h"
 #include "xf-debug.h"
@@ -73,9 +74,25 @@ extern clk_t capturer_cycles;
 /* maximum allowed framesize in bytes per channel. Default framesize: 8ms frame at 48 kHz with 2 bytes per sample */
 #define MAX_FRAME_SIZE_IN_BYTES_DEFAULT    (48 * 8 * 2)
 
-/* minimum allowed framesize in bytes per channel */
-#define MIN_FRAME_SIZE_IN_BYTES    ( 128 )
+/* minimum allowed framesize in bytes per channel: 1ms frame at 16 kHz with 2 bytes per sample (low-latency mode) */
+#define MIN_FRAME_SIZE_IN_BYTES    ( 16 * 1 * 2 )
 
+/* ...input file name; instance N > 0 reads capturer_in_N.pcm */
+#define CAPTURER_IN_FILE                "capturer_in"
+#define CAPTURER_IN_FILE_NAME_LEN       32
+
+/* ...read-ahead buffer of the file source, in bytes (power of 2) */
+#define CAPTURER_SOURCE_LENGTH          (2 * HW_FIFO_LENGTH)
+
+/* ...file source thread; runs below the DSP worker threads */
+#define CAPTURER_SOURCE_STACK_SIZE      4096
+#define CAPTURER_SOURCE_THREAD_PRIORITY 1
+
+/* ...file source events */
+#define CAPTURER_SOURCE_EVENT_DATA      (1 << 0)
+#define CAPTURER_SOURCE_EVENT_SPACE     (1 << 1)
+#define CAPTURER_SOURCE_EVENT_EXIT      (1 << 2)
+#define CAPTURER_SOURCE_EVENT_ALL       (CAPTURER_SOURCE_EVENT_DATA | CAPTURER_SOURCE_EVENT_SPACE | CAPTURER_SOURCE_EVENT_EXIT)
 
 /*******************************************************************************
  * Local data definition
@@ -141,6 +158,40 @@ typedef struct XACapturer
     /* ...framesize in samples per channel */
     UWORD32     frame_size;
 
+    /* ...number of executed frames */
+    UWORD32     frame_cnt;
+
+    /* ...instance index, selects the input file */
+    UWORD32     instance_id;
+
+    /* ...FIFO timer, one per instance */
+    xf_timer_t  timer;
+
+    /* ...number of frames that waited for the file source */
+    UWORD32     source_stalls;
+
+    /* ...file source write/read positions (free-running byte counters) */
+    volatile UWORD32    source_w;
+    volatile UWORD32    source_r;
+
+    /* ...file source reached end of file */
+    volatile UWORD32    source_eof;
+
+    /* ...file source thread is running */
+    UWORD32     source_active;
+
+    /* ...file source thread and its events */
+    xf_thread_t source_thread;
+    xf_event_t  source_event;
+
+    /* ...file source read-ahead buffer */
+    UWORD8      source[CAPTURER_SOURCE_LENGTH];
+
+#if !defined(HAVE_FREERTOS)
+    /* ...file source thread stack */
+    UWORD8      source_stack[CAPTURER_SOURCE_STACK_SIZE];
+#endif
+
 }   XACapturer;
 
 #define MAX_UWORD32 ((UWORD64)0xFFFFFFFF)
@@ -153,14 +204,6 @@ typedef struct XACapturer
 #define XA_CAPTURER_FLAG_IDLE           (1 << 2)
 #define XA_CAPTURER_FLAG_RUNNING        (1 << 3)
 #define XA_CAPTURER_FLAG_PAUSED         (1 << 4)
-/*******************************************************************************
- * global variables
- ******************************************************************************/
-
-static xf_timer_t cap_timer;
-const char capturer_in_file[] = "capturer_in.pcm";
-void xa_capturer_callback(xa_capturer_cb_t *cdata, WORD32 i_idx);
-
 static void xa_fw_handler(void *arg)
 {
     XACapturer *d = arg;
@@ -183,15 +226,143 @@ static void xa_fw_handler(void *arg)
 }
 
 
+/*******************************************************************************
+ * xa_fw_capturer_source_thread
+ *
+ * Keep the read-ahead buffer filled from the input file, so that a captured
+ * frame is a copy from memory rather than a file read on the timer path
+ ******************************************************************************/
+
+static void *xa_fw_capturer_source_thread(void *arg)
+{
+    XACapturer *d = arg;
+    UWORD32     w, n, k;
+
+    while (1)
+    {
+        __xf_event_wait_any(&d->source_event, CAPTURER_SOURCE_EVENT_SPACE | CAPTURER_SOURCE_EVENT_EXIT);
+        __xf_event_clear(&d->source_event, CAPTURER_SOURCE_EVENT_SPACE);
+
+        if (__xf_event_get(&d->source_event) & CAPTURER_SOURCE_EVENT_EXIT)
+        {
+            break;
+        }
+
+        while ((n = CAPTURER_SOURCE_LENGTH - (d->source_w - d->source_r)) != 0)
+        {
+            /* ...read up to the end of the buffer; wrapped head goes next iteration */
+            w = d->source_w & (CAPTURER_SOURCE_LENGTH - 1);
+            n = (n < CAPTURER_SOURCE_LENGTH - w ? n : CAPTURER_SOURCE_LENGTH - w);
+
+            k = fread(&d->source[w], 1, n, d->fw);
+
+            d->source_w += k;
+
+            if (k < n)
+            {
+                /* ...end of file; position is final before the flag is raised */
+                d->source_eof = 1;
+                __xf_event_set(&d->source_event, CAPTURER_SOURCE_EVENT_DATA);
+                return NULL;
+            }
+
+            __xf_event_set(&d->source_event, CAPTURER_SOURCE_EVENT_DATA);
+        }
+    }
+
+    return NULL;
+}
+
+/* ...take data from the file source (NULL buffer skips); waits only if the read-ahead is behind */
+static UWORD32 xa_fw_capturer_source_read(XACapturer *d, void *b, UWORD32 bytes)
+{
+    UWORD32 r, n, k, eof;
+
+    /* ...sample end-of-file flag before the write position */
+    eof = d->source_eof;
+
+    if ((d->source_w - d->source_r) < bytes && !eof)
+    {
+        d->source_stalls++;
+
+        TRACE(OUTPUT, _b("file source stall, pending:%u"), d->source_w - d->source_r);
+
+        while (1)
+        {
+            __xf_event_clear(&d->source_event, CAPTURER_SOURCE_EVENT_DATA);
+
+            eof = d->source_eof;
+
+            if ((d->source_w - d->source_r) >= bytes || eof)
+            {
+                break;
+            }
+
+            __xf_event_wait_any(&d->source_event, CAPTURER_SOURCE_EVENT_DATA);
+        }
+    }
+
+    n = d->source_w - d->source_r;
+    n = (bytes < n ? bytes : n);
+
+    if (b)
+    {
+        r = d->source_r & (CAPTURER_SOURCE_LENGTH - 1);
+        k = (n < CAPTURER_SOURCE_LENGTH - r ? n : CAPTURER_SOURCE_LENGTH - r);
+
+        memcpy(b, &d->source[r], k);
+        memcpy((UWORD8 *)b + k, &d->source[0], n - k);
+    }
+
+    d->source_r += n;
+
+    /* ...wake up the reader once half of the buffer is free, so it reads in large chunks */
+    if (d->source_active && CAPTURER_SOURCE_LENGTH - (d->source_w - d->source_r) >= (CAPTURER_SOURCE_LENGTH >> 1))
+    {
+        __xf_event_set(&d->source_event, CAPTURER_SOURCE_EVENT_SPACE);
+    }
+
+    return n;
+}
+
+/* ...join the file source thread; whatever is left in the read-ahead buffer stays readable */
+static void xa_fw_capturer_source_stop(XACapturer *d)
+{
+    if (!d->source_active)
+    {
+        return;
+    }
+
+    __xf_event_set(&d->source_event, CAPTURER_SOURCE_EVENT_EXIT);
+    __xf_thread_join(&d->source_thread, NULL);
+    __xf_thread_destroy(&d->source_thread);
+    __xf_event_destroy(&d->source_event);
+
+    /* ...nothing more arrives; readers must not wait for it */
+    d->source_active = 0;
+    d->source_eof = 1;
+}
+
 /*******************************************************************************
  * Codec access functions
  ******************************************************************************/
 
 static inline void xa_fw_capturer_close(XACapturer *d)
 {
+    /* ...nothing to do if the source is already closed */
+    if (d->fw == NULL)
+    {
+        return;
+    }
+
+    __xf_timer_stop(&d->timer);
+    __xf_timer_destroy(&d->timer);
+
+    /* ...stop the file source before closing the file */
+    xa_fw_capturer_source_stop(d);
+
     fclose(d->fw);
-    __xf_timer_stop(&cap_timer);
-    __xf_timer_destroy(&cap_timer);
+    d->fw = NULL;
 }
 
 /* ...submit data (in samples) into internal capturer ring-buffer */
@@ -214,11 +385,19 @@ static XA_ERRORCODE xa_capturer_get_api_size(XACapturer *d, WORD32 i_idx, pVOID
 
 static XA_ERRORCODE xa_fw_capturer_init (XACapturer *d)
 {
+   char file_name[CAPTURER_IN_FILE_NAME_LEN];
+
    d->produced = 0;
    d->fw = NULL;
    d->tot_bytes_produced = 0;
+   d->frame_cnt = 0;
    /*opening the output file*/
-   d->fw = fopen(capturer_in_file,"rb");
+   if (d->instance_id)
+       snprintf(file_name, sizeof(file_name), CAPTURER_IN_FILE "_%u.pcm", (unsigned)d->instance_id);
+   else
+       snprintf(file_name, sizeof(file_name), CAPTURER_IN_FILE ".pcm");
+
+   d->fw = fopen(file_name,"rb");
    if ( d->fw == NULL )
    {
      /*file open failed*/
@@ -228,8 +407,29 @@ static XA_ERRORCODE xa_fw_capturer_init (XACapturer *d)
    /*initialy FIFO will be empty so fifo_avail = HW_FIFO_LENGTH_SAMPLES*/
    d->fifo_avail = 0;
 
+   /* ...start the file source with an empty read-ahead buffer */
+   d->source_w = d->source_r = 0;
+   d->source_eof = 0;
+   __xf_event_init(&d->source_event, CAPTURER_SOURCE_EVENT_ALL);
+   __xf_event_set(&d->source_event, CAPTURER_SOURCE_EVENT_SPACE);
+   __xf_thread_init(&d->source_thread);
+
+#if defined(HAVE_FREERTOS)
+   if (__xf_thread_create(&d->source_thread, xa_fw_capturer_source_thread, d, "capturer-source", NULL, CAPTURER_SOURCE_STACK_SIZE, CAPTURER_SOURCE_THREAD_PRIORITY) != 0)
+#else
+   if (__xf_thread_create(&d->source_thread, xa_fw_capturer_source_thread, d, "capturer-source", d->source_stack, CAPTURER_SOURCE_STACK_SIZE, CAPTURER_SOURCE_THREAD_PRIORITY) != 0)
+#endif
+   {
+     __xf_event_destroy(&d->source_event);
+     fclose(d->fw);
+     d->fw = NULL;
+     return XA_FATAL_ERROR;
+   }
+
+   d->source_active = 1;
+
    /*initialises the timer */
-   __xf_timer_init(&cap_timer, xa_fw_handler, d, 1);
+   __xf_timer_init(&d->timer, xa_fw_handler, d, 1);
 
    return XA_NO_ERROR;
 }
@@ -312,7 +512,7 @@ static inline XA_ERRORCODE xa_hw_capturer_control(XACapturer *d, UWORD32 state)
         /* ...capturer must be in idle state */
         XF_CHK_ERR(d->state & XA_CAPTURER_FLAG_IDLE, XA_CAPTURER_EXEC_NONFATAL_STATE);
 
-        __xf_timer_start(&cap_timer,
+        __xf_timer_start(&d->timer,
                          __xf_timer_ratio_to_period((d->frame_size_bytes / d->sample_size ), d->rate));  
 
         /* ...mark capturer is runnning */
@@ -498,6 +698,16 @@ static XA_ERRORCODE xa_capturer_set_config_param(XACapturer *d, WORD32 i_idx, pV
             
             return XA_NO_ERROR;
         }
+
+    case XA_CAPTURER_CONFIG_PARAM_INSTANCE_ID:
+        /* ...command is valid only in configuration state */
+        XF_CHK_ERR((d->state & XA_CAPTURER_FLAG_POSTINIT_DONE) == 0, XA_CAPTURER_CONFIG_FATAL_STATE);
+
+        /* ...instance index selects the input file */
+        d->instance_id = (UWORD32) *(WORD32 *)pv_value;
+
+        return XA_NO_ERROR;
+
     default:
         /* ...unrecognized parameter */
         return XF_CHK_ERR(0, XA_API_FATAL_INVALID_CMD_TYPE);
@@ -574,6 +784,16 @@ static XA_ERRORCODE xa_capturer_get_config_param(XACapturer *d, WORD32 i_idx, pV
         *(WORD32 *)pv_value = d->frame_size;
         return XA_NO_ERROR;
 
+    case XA_CAPTURER_CONFIG_PARAM_INSTANCE_ID:
+        /* ...return instance index */
+        *(WORD32 *)pv_value = d->instance_id;
+        return XA_NO_ERROR;
+
+    case XA_CAPTURER_CONFIG_PARAM_SOURCE_STALLS:
+        /* ...return number of file source stalls */
+        *(WORD32 *)pv_value = d->source_stalls;
+        return XA_NO_ERROR;
+
     default:
         /* ...unrecognized parameter */
         return XF_CHK_ERR(0, XA_API_FATAL_INVALID_CMD_TYPE);
@@ -583,9 +803,8 @@ static XA_ERRORCODE xa_capturer_get_config_param(XACapturer *d, WORD32 i_idx, pV
 static XA_ERRORCODE xa_capturer_do_exec(XACapturer *d)
 {
     WORD32 bytes_read = 0;
-    static UWORD32 frame_cnt = 0;
 
-    FIO_PRINTF(stdout,"%d\n",++frame_cnt);
+    FIO_PRINTF(stdout,"%d\n",++d->frame_cnt);
     if(d->fifo_avail >= (d->frame_size_bytes * d->channels))
     {
         d->fifo_avail = d->fifo_avail - (d->frame_size_bytes * d->channels);
@@ -593,12 +812,12 @@ static XA_ERRORCODE xa_capturer_do_exec(XACapturer *d)
         if(d->output)
         {
             /* ... read bytes when output buffer is available. */
-            bytes_read = fread(d->output,1,(d->frame_size_bytes * d->channels ), d->fw );
+            bytes_read = xa_fw_capturer_source_read(d, d->output, (d->frame_size_bytes * d->channels));
         }
         else
         {
             /* ... skip bytes when output buffer is unavailable. TENA-2528 */
-            fseek(d->fw, (d->frame_size_bytes * d->channels), SEEK_CUR);
+            xa_fw_capturer_source_read(d, NULL, (d->frame_size_bytes * d->channels));
 
             TRACE(OUTPUT, _b("output buffer is NULL, dropped %u bytes"), (d->frame_size_bytes * d->channels));
 
@@ -660,7 +879,10 @@ static XA_ERRORCODE xa_capturer_execute(XACapturer *d, WORD32 i_idx, pVOID pv_va
             && (d->output) /* TENA-2528 */
         )
         {
-            __xf_timer_stop(&cap_timer);
+            __xf_timer_stop(&d->timer);
+
+            /* ...sample end or end of file reached; release the file source thread */
+            xa_fw_capturer_source_stop(d);
 
             *(WORD32 *)pv_value = 1;
         }
@@ -845,7 +1067,17 @@ static XA_ERRORCODE xa_capturer_set_mem_ptr(XACapturer *d, WORD32 i_idx, pVOID p
     }
 }
 
+/* ...component teardown; the file source thread lives in the API structure */
+static XA_ERRORCODE xa_capturer_deinit(XACapturer *d, WORD32 i_idx, pVOID pv_value)
+{
+    /* ...basic sanity check */
+    XF_CHK_ERR(d, XA_API_FATAL_INVALID_CMD_TYPE);
 
+    /* ...stop the timer and the file source before the API memory is released */
+    xa_fw_capturer_close(d);
+
+    return XA_NO_ERROR;
+}
 
 /*******************************************************************************
  * API command hooks
@@ -865,6 +1097,7 @@ static XA_ERRORCODE (* const xa_capturer_api[])(XACapturer *, WORD32, pVOID) =
     [XA_API_CMD_GET_MEM_INFO_ALIGNMENT] = xa_capturer_get_mem_info_alignment,
     [XA_API_CMD_GET_MEM_INFO_TYPE]      = xa_capturer_get_mem_info_type,
     [XA_API_CMD_SET_MEM_PTR]            = xa_capturer_set_mem_ptr,
+    [XA_API_CMD_DEINIT]                 = xa_capturer_deinit,
 
 };
 
@@ -71,8 +71,18 @@ typedef struct XAPcmMixer
     /* ...number of bytes in input/output buffer */
     UWORD32                 buffer_size;
     
-    /* ...master volume and individual track volumes*/
-    UWORD32                 volume[XA_MIXER_MAX_TRACK_NUMBER + 1];
+    /* ...master volume and individual track volumes (Q12), per channel */
+    UWORD16                 volume[XA_MIXER_MAX_TRACK_NUMBER + 1][XA_MIXER_MAX_CHANNELS];
+
+    /* ...current gains (Q12 with 15 extra fraction bits) and per-sample ramp step */
+    WORD32                  gain[XA_MIXER_MAX_TRACK_NUMBER + 1][XA_MIXER_MAX_CHANNELS];
+    WORD32                  gain_step[XA_MIXER_MAX_TRACK_NUMBER + 1][XA_MIXER_MAX_CHANNELS];
+
+    /* ...remaining ramp length in samples per channel */
+    UWORD32                 ramp_left[XA_MIXER_MAX_TRACK_NUMBER + 1];
+
+    /* ...volume change ramp length in samples per channel */
+    UWORD32                 ramp_length;
     
     /* ...input buffers */
     void               *input[XA_MIXER_MAX_TRACK_NUMBER];
@@ -117,6 +127,12 @@ typedef struct XAPcmMixer
 #define MIXER_FRAME_SIZE_MAX    4096
 #define MIXER_FRAME_SIZE_MIN      32
 
+/* volume ramp length limit in samples/channel */
+#define MIXER_RAMP_LENGTH_MAX   (1 << 16)
+
+/* extra fraction bits of the current gain */
+#define MIXER_GAIN_FRAC         15
+
 /*******************************************************************************
  * DSP functions
  ******************************************************************************/
@@ -124,10 +140,17 @@ typedef struct XAPcmMixer
 #define DSP_SATURATE_S16(WORD32)   \
     (WORD16)((WORD32) > 0x7fff ? 0x7fff : ((WORD32) < -0x8000 ? -0x8000 : (WORD32)))
 
+#define MAX_32BIT   ((WORD64)(WORD32)0x7FFFFFFF)
+#define MIN_32BIT   ((WORD64)(WORD32)0x80000000)
+
+/* ...24-bit samples are MSB-aligned in 32-bit containers */
+#define MAX_24BIT   ((WORD64)(WORD32)0x7FFFFF00)
+#define MIN_24BIT   ((WORD64)(WORD32)0x80000000)
+
 /* ...mixer preinitialization (default parameters) */
 static inline void xa_mixer_preinit(XAPcmMixer *d)
 {
-    UWORD32     i;
+    UWORD32     i, c;
     
     /* ...pre-configuration initialization; reset internal data */
     memset(d, 0, sizeof(*d));
@@ -138,7 +161,11 @@ static inline void xa_mixer_preinit(XAPcmMixer *d)
     /* ...set default volumes (last index is a master volume)*/
     for (i = 0; i <= XA_MIXER_MAX_TRACK_NUMBER; i++)
     {
-        d->volume[i] = ((1 << 12) << 16) | (1 << 12);
+        for (c = 0; c < XA_MIXER_MAX_CHANNELS; c++)
+        {
+            d->volume[i][c] = (1 << 12);
+            d->gain[i][c] = (1 << 12) << MIXER_GAIN_FRAC;
+        }
     }
 #ifdef XA_INPORT_BYPASS_TEST
     /* ...enabled at init for testing. To be enabled by set-config to the plugin. */
@@ -147,23 +174,258 @@ static inline void xa_mixer_preinit(XAPcmMixer *d)
 
 }
 
-/* ...do mixing of stereo PCM-16 streams */
-static XA_ERRORCODE xa_mixer_do_execute_stereo_16bit(XAPcmMixer *d)
+/* ...set volume of one or all channels of a track (or master); starts a ramp if configured */
+static void xa_mixer_set_volume(XAPcmMixer *d, UWORD32 t, UWORD32 ch, UWORD16 v)
 {
-    WORD16  *output = d->output;
-    WORD16  *b[XA_MIXER_MAX_TRACK_NUMBER]; 
-    UWORD16 v_l[XA_MIXER_MAX_TRACK_NUMBER];
-    UWORD16 v_r[XA_MIXER_MAX_TRACK_NUMBER];
-    UWORD16 w_l, w_r;    
-    UWORD32 t32;
-    UWORD32 i, j;
+    UWORD32     c;
+
+    for (c = 0; c < XA_MIXER_MAX_CHANNELS; c++)
+    {
+        if (ch == XA_MIXER_VOLUME_ALL_CHANNELS || ch == c)
+        {
+            d->volume[t][c] = v;
+        }
+    }
+
+    for (c = 0; c < XA_MIXER_MAX_CHANNELS; c++)
+    {
+        WORD32  target = (WORD32)d->volume[t][c] << MIXER_GAIN_FRAC;
+
+        if (d->ramp_length == 0)
+        {
+            d->gain[t][c] = target, d->gain_step[t][c] = 0;
+        }
+        else
+        {
+            /* ...ramp from current gain; restarted if previous ramp is still running */
+            d->gain_step[t][c] = (target - d->gain[t][c]) / (WORD32)d->ramp_length;
+        }
+    }
+
+    d->ramp_left[t] = d->ramp_length;
+}
+
+/* ...advance ramp by a number of samples per channel; land exactly on target */
+static inline void xa_mixer_ramp_advance(XAPcmMixer *d, UWORD32 t, UWORD32 n)
+{
+    UWORD32     c;
+
+    if (d->ramp_left[t] && (d->ramp_left[t] -= n) == 0)
+    {
+        for (c = 0; c < XA_MIXER_MAX_CHANNELS; c++)
+        {
+            d->gain[t][c] = (WORD32)d->volume[t][c] << MIXER_GAIN_FRAC, d->gain_step[t][c] = 0;
+        }
+    }
+}
+
+/* ...check if all channels of a track have the same gain */
+static inline UWORD32 xa_mixer_gain_flat(XAPcmMixer *d, UWORD32 t)
+{
+    UWORD32     c;
+
+    for (c = 1; c < d->channels; c++)
+    {
+        if (d->gain[t][c] != d->gain[t][0])
+            return 0;
+    }
+
+    return 1;
+}
+
+/* ...number of ramp samples per channel within a block */
+static inline UWORD32 xa_mixer_ramp_frames(XAPcmMixer *d, UWORD32 t, UWORD32 frames)
+{
+    return (d->ramp_left[t] < frames ? d->ramp_left[t] : frames);
+}
+
+/* ...accumulate 16-bit track into 32-bit accumulator (Q0) */
+static void xa_mixer_track_16bit(XAPcmMixer *d, UWORD32 t, WORD32 *acc, WORD16 *x, UWORD32 frames)
+{
+    UWORD32     ch = d->channels;
+    WORD32     *g = d->gain[t];
+    WORD32     *dg = d->gain_step[t];
+    UWORD32     i, c, n;
+
+    /* ...ramp section; gain advances every sample */
+    for (i = 0, n = xa_mixer_ramp_frames(d, t, frames); i < n; i++)
+    {
+        for (c = 0; c < ch; c++)
+        {
+            g[c] += dg[c];
+            *acc++ += (*x++ * (g[c] >> MIXER_GAIN_FRAC)) >> 12;
+        }
+    }
+
+    xa_mixer_ramp_advance(d, t, n);
+
+    /* ...constant-gain section; flat loop over the whole block if channels share the gain */
+    if (xa_mixer_gain_flat(d, t))
+    {
+        WORD32  g0 = g[0] >> MIXER_GAIN_FRAC;
+
+        for (i = 0, n = (frames - n) * ch; i < n; i++)
+        {
+            acc[i] += (x[i] * g0) >> 12;
+        }
+    }
+    else
+    {
+        for (i = n; i < frames; i++)
+        {
+            for (c = 0; c < ch; c++)
+            {
+                *acc++ += (*x++ * (g[c] >> MIXER_GAIN_FRAC)) >> 12;
+            }
+        }
+    }
+}
+
+/* ...accumulate 24/32-bit track into 64-bit accumulator (Q0) */
+static void xa_mixer_track_32bit(XAPcmMixer *d, UWORD32 t, WORD64 *acc, WORD32 *x, UWORD32 frames)
+{
+    UWORD32     ch = d->channels;
+    WORD32     *g = d->gain[t];
+    WORD32     *dg = d->gain_step[t];
+    UWORD32     i, c, n;
+
+    /* ...ramp section; gain advances every sample */
+    for (i = 0, n = xa_mixer_ramp_frames(d, t, frames); i < n; i++)
+    {
+        for (c = 0; c < ch; c++)
+        {
+            g[c] += dg[c];
+            *acc++ += ((WORD64)*x++ * (g[c] >> MIXER_GAIN_FRAC)) >> 12;
+        }
+    }
+
+    xa_mixer_ramp_advance(d, t, n);
+
+    /* ...constant-gain section; flat loop over the whole block if channels share the gain */
+    if (xa_mixer_gain_flat(d, t))
+    {
+        WORD32  g0 = g[0] >> MIXER_GAIN_FRAC;
+
+        for (i = 0, n = (frames - n) * ch; i < n; i++)
+        {
+            acc[i] += ((WORD64)x[i] * g0) >> 12;
+        }
+    }
+    else
+    {
+        for (i = n; i < frames; i++)
+        {
+            for (c = 0; c < ch; c++)
+            {
+                *acc++ += ((WORD64)*x++ * (g[c] >> MIXER_GAIN_FRAC)) >> 12;
+            }
+        }
+    }
+}
+
+/* ...apply master volume, saturate and store 16-bit output */
+static void xa_mixer_output_16bit(XAPcmMixer *d, WORD32 *acc, WORD16 *y, UWORD32 frames)
+{
+    UWORD32     t = XA_MIXER_MAX_TRACK_NUMBER;
+    UWORD32     ch = d->channels;
+    WORD32     *g = d->gain[t];
+    WORD32     *dg = d->gain_step[t];
+    UWORD32     i, c, n;
+    WORD32      v;
+
+    for (i = 0, n = xa_mixer_ramp_frames(d, t, frames); i < n; i++)
+    {
+        for (c = 0; c < ch; c++)
+        {
+            g[c] += dg[c];
+            v = (WORD32)(((WORD64)*acc++ * (g[c] >> MIXER_GAIN_FRAC)) >> 12);
+            *y++ = DSP_SATURATE_S16(v);
+        }
+    }
+
+    xa_mixer_ramp_advance(d, t, n);
+
+    if (xa_mixer_gain_flat(d, t))
+    {
+        WORD32  g0 = g[0] >> MIXER_GAIN_FRAC;
+
+        for (i = 0, n = (frames - n) * ch; i < n; i++)
+        {
+            v = (WORD32)(((WORD64)acc[i] * g0) >> 12);
+            y[i] = DSP_SATURATE_S16(v);
+        }
+    }
+    else
+    {
+        for (i = n; i < frames; i++)
+        {
+            for (c = 0; c < ch; c++)
+            {
+                v = (WORD32)(((WORD64)*acc++ * (g[c] >> MIXER_GAIN_FRAC)) >> 12);
+                *y++ = DSP_SATURATE_S16(v);
+            }
+        }
+    }
+}
+
+/* ...apply master volume, saturate and store 24/32-bit output */
+static void xa_mixer_output_32bit(XAPcmMixer *d, WORD64 *acc, WORD32 *y, UWORD32 frames)
+{
+    UWORD32     t = XA_MIXER_MAX_TRACK_NUMBER;
+    UWORD32     ch = d->channels;
+    WORD32     *g = d->gain[t];
+    WORD32     *dg = d->gain_step[t];
+    WORD64      max = (d->pcm_width == 24 ? MAX_24BIT : MAX_32BIT);
+    WORD64      min = (d->pcm_width == 24 ? MIN_24BIT : MIN_32BIT);
+    WORD32      mask = (d->pcm_width == 24 ? (WORD32)0xFFFFFF00 : (WORD32)0xFFFFFFFF);
+    UWORD32     i, c, n;
+    WORD64      v;
+
+    for (i = 0, n = xa_mixer_ramp_frames(d, t, frames); i < n; i++)
+    {
+        for (c = 0; c < ch; c++)
+        {
+            g[c] += dg[c];
+            v = (*acc++ * (g[c] >> MIXER_GAIN_FRAC)) >> 12;
+            *y++ = (WORD32)(v > max ? max : (v < min ? min : v)) & mask;
+        }
+    }
+
+    xa_mixer_ramp_advance(d, t, n);
+
+    if (xa_mixer_gain_flat(d, t))
+    {
+        WORD32  g0 = g[0] >> MIXER_GAIN_FRAC;
+
+        for (i = 0, n = (frames - n) * ch; i < n; i++)
+        {
+            v = (acc[i] * g0) >> 12;
+            y[i] = (WORD32)(v > max ? max : (v < min ? min : v)) & mask;
+        }
+    }
+    else
+    {
+        for (i = n; i < frames; i++)
+        {
+            for (c = 0; c < ch; c++)
+            {
+                v = (*acc++ * (g[c] >> MIXER_GAIN_FRAC)) >> 12;
+                *y++ = (WORD32)(v > max ? max : (v < min ? min : v)) & mask;
+            }
+        }
+    }
+}
+
+/* ...do mixing of PCM streams; block-wise processing of all active tracks */
+static XA_ERRORCODE xa_mixer_do_execute(XAPcmMixer *d)
+{
+    UWORD8  *output = d->output;
+    UWORD8  *b[XA_MIXER_MAX_TRACK_NUMBER];
+    UWORD32 j;
     UWORD32 ports_inactive;
     UWORD32 ports_completed;
     UWORD32 frame_size, inlen, sample_size, nout_remaining;
-
-    /* ...retrieve master volume - assume up to 24dB amplifying (4 bits) */
-    t32 = d->volume[XA_MIXER_MAX_TRACK_NUMBER];
-    w_l = (UWORD16)(t32 & 0xFFFF), w_r = (UWORD16)(t32 >> 16);
+    UWORD32 wide = (d->pcm_width != 16);
 
     /* ...reset produced bytes */
     d->produced = 0;
@@ -194,7 +456,10 @@ static XA_ERRORCODE xa_mixer_do_execute_stereo_16bit(XAPcmMixer *d)
     /* ...copy of input-bytes, decremented on consumption over iterations */
     memset(d->consumed, 0, sizeof(d->consumed));
     nout_remaining = (d->buffer_size - d->produced);
-    sample_size = ((d->pcm_width == 16) ? sizeof(WORD16) : sizeof(WORD32)) * d->channels;
+    sample_size = (wide ? sizeof(WORD32) : sizeof(WORD16)) * d->channels;
+
+    /* ...accumulator lives in scratch memory */
+    XF_CHK_ERR(d->scratch, XA_MIXER_EXEC_FATAL_STATE);
 
     do
     {
@@ -211,9 +476,8 @@ static XA_ERRORCODE xa_mixer_do_execute_stereo_16bit(XAPcmMixer *d)
             /* ...check if we have input buffer available */
             if (n == 0)
             {
-                /* ...output silence (multiply garbage in the scratch buffer by 0) */
-                b[j] = d->scratch;
-                v_l[j] = v_r[j] = 0;
+                /* ...track does not contribute to the mix */
+                b[j] = NULL;
                 inports_active--;
             }
             else
@@ -221,12 +485,8 @@ static XA_ERRORCODE xa_mixer_do_execute_stereo_16bit(XAPcmMixer *d)
                 /* ...assign input buffer pointer. */
                 XF_CHK_ERR(b[j] = d->input[j], XA_MIXER_EXEC_FATAL_INPUT);
 
-                /* ...set individual track volume/balance */
-                t32 = d->volume[j];
-                v_l[j] = (UWORD16)(t32 & 0xFFFF), v_r[j] = (UWORD16)(t32 >> 16);
-
-                /* ...advance the input pointer by sample-offset, required for unequal length input */
-                b[j] += (d->consumed[j] / ((d->pcm_width == 16) ? sizeof(WORD16) : sizeof(WORD32)));
+                /* ...advance the input pointer by byte-offset, required for unequal length input */
+                b[j] += d->consumed[j];
 
                 /* ...input_size: bytes to process is the minimum of of all input port bytes */
                 inlen = (inlen < n) ? inlen : n;
@@ -234,38 +494,36 @@ static XA_ERRORCODE xa_mixer_do_execute_stereo_16bit(XAPcmMixer *d)
                 inlen = (inlen < nout_remaining) ? inlen : nout_remaining;
             }
         
-            TRACE(PROCESS, _b("b[%u] = %p%s"), j, b[j], (n == 0 ? " - scratch" : ""));
+            TRACE(PROCESS, _b("b[%u] = %p%s"), j, b[j], (n == 0 ? " - inactive" : ""));
         }
 
         inlen = (inports_active)?inlen:0;
-        
-        if(inlen)
+        frame_size = inlen / sample_size;
+
+        if(frame_size)
         {
-            frame_size = inlen / sample_size;
+            /* ...clear the accumulator and add up active tracks */
+            memset(d->scratch, 0, frame_size * d->channels * (wide ? sizeof(WORD64) : sizeof(WORD32)));
 
-            for (i=0; i < frame_size; i++)
+            for (j = 0; j < XA_MIXER_MAX_TRACK_NUMBER; j++)
             {
-                WORD32     l32 = 0, r32 = 0;
-            
-                /* ...fill-in every channel in our map (unrolls loop here) */
-                for (j = 0; j < XA_MIXER_MAX_TRACK_NUMBER; j++)
-                {
-                    /* ...left channel processing (no saturation here yet) */
-                    l32 += *b[j]++ * v_l[j];
-            
-                    /* ...right channel processing */
-                    r32 += *b[j]++ * v_r[j];
-                }
-            
-                /* ...normalize (truncate towards -inf) and multiply by master volume */
-                l32 = ((l32 >> 12) * w_l) >> 12;
-                r32 = ((r32 >> 12) * w_r) >> 12;
-            
-                /* ...saturate and store in buffer */
-                *output++ = DSP_SATURATE_S16(l32);
-                *output++ = DSP_SATURATE_S16(r32);
+                if (b[j] == NULL)
+                    continue;
+
+                if (wide)
+                    xa_mixer_track_32bit(d, j, d->scratch, (WORD32 *)b[j], frame_size);
+                else
+                    xa_mixer_track_16bit(d, j, d->scratch, (WORD16 *)b[j], frame_size);
             }
 
+            /* ...apply master volume and saturate into output buffer */
+            if (wide)
+                xa_mixer_output_32bit(d, d->scratch, (WORD32 *)output, frame_size);
+            else
+                xa_mixer_output_16bit(d, d->scratch, (WORD16 *)output, frame_size);
+
+            output += frame_size * sample_size;
+
             for (j = 0; j < XA_MIXER_MAX_TRACK_NUMBER; j++)
             {
                 if(d->input_length[j])
@@ -284,8 +542,8 @@ static XA_ERRORCODE xa_mixer_do_execute_stereo_16bit(XAPcmMixer *d)
             }
             d->produced += frame_size * sample_size;
             nout_remaining = (d->buffer_size - d->produced);
-        }//if(inlen)
-    } while(inlen && nout_remaining);
+        }//if(frame_size)
+    } while(frame_size && nout_remaining);
 
     /* ...memset rest of the output buffer */
     memset(output, 0, d->buffer_size - d->produced);
@@ -415,17 +673,35 @@ static XA_ERRORCODE xa_mixer_set_config_param(XAPcmMixer *d, WORD32 i_idx, pVOID
     switch (i_idx)
     {
     case XA_MIXER_CONFIG_PARAM_PCM_WIDTH:
-        /* ...check value is permitted (16 bits only) */
-        XF_CHK_ERR(i_value == 16, XA_MIXER_CONFIG_NONFATAL_RANGE);
+        /* ...check value is permitted (16, 24 and 32 bits) */
+        XF_CHK_ERR(i_value == 16 || i_value == 24 || i_value == 32, XA_MIXER_CONFIG_NONFATAL_RANGE);
         d->pcm_width = (UWORD32)i_value;
         return XA_NO_ERROR;
 
     case XA_MIXER_CONFIG_PARAM_CHANNELS:
-        /* ...allow stereo only */
-        XF_CHK_ERR(i_value == 2, XA_MIXER_CONFIG_NONFATAL_RANGE);
+        /* ...allow mono to 8 channels */
+        XF_CHK_ERR(i_value >= 1 && i_value <= XA_MIXER_MAX_CHANNELS, XA_MIXER_CONFIG_NONFATAL_RANGE);
         d->channels = (UWORD32)i_value;
         return XA_NO_ERROR;
 
+    case XA_MIXER_CONFIG_PARAM_VOLUME:
+    {
+        UWORD32     track = (i_value >> 16) & 0xFF;
+        UWORD32     channel = (i_value >> 24) & 0xF;
+
+        /* ...track volume (or master volume) of a single channel or all channels */
+        XF_CHK_ERR(track <= XA_MIXER_MAX_TRACK_NUMBER, XA_MIXER_CONFIG_NONFATAL_RANGE);
+        XF_CHK_ERR(channel < XA_MIXER_MAX_CHANNELS || channel == XA_MIXER_VOLUME_ALL_CHANNELS, XA_MIXER_CONFIG_NONFATAL_RANGE);
+        xa_mixer_set_volume(d, track, channel, (UWORD16)(i_value & 0xFFFF));
+        return XA_NO_ERROR;
+    }
+
+    case XA_MIXER_CONFIG_PARAM_RAMP_LENGTH:
+        /* ...applies to subsequent volume changes */
+        XF_CHK_ERR(i_value <= MIXER_RAMP_LENGTH_MAX, XA_MIXER_CONFIG_NONFATAL_RANGE);
+        d->ramp_length = (UWORD32)i_value;
+        return XA_NO_ERROR;
+
     case XA_MIXER_CONFIG_PARAM_SAMPLE_RATE:      
          {
             /* ...set mixer sample rate */
@@ -506,6 +782,11 @@ static XA_ERRORCODE xa_mixer_get_config_param(XAPcmMixer *d, WORD32 i_idx, pVOID
         *(WORD32 *)pv_value = d->frame_size;
         return XA_NO_ERROR;
 
+    case XA_MIXER_CONFIG_PARAM_RAMP_LENGTH:
+        /* ...return volume ramp length (in samples) */
+        *(WORD32 *)pv_value = d->ramp_length;
+        return XA_NO_ERROR;
+
 #ifdef XA_EXT_CONFIG_TEST
     case XA_MIXER_CONFIG_PARAM_BUFFER_SIZE:
     {
@@ -550,7 +831,7 @@ static XA_ERRORCODE xa_mixer_execute(XAPcmMixer *d, WORD32 i_idx, pVOID pv_value
 #ifdef XAF_PROFILE
         mix_start = clk_read_start(CLK_SELN_THREAD);
 #endif
-        ret = xa_mixer_do_execute_stereo_16bit(d);
+        ret = xa_mixer_do_execute(d);
 #ifdef XAF_PROFILE
         mix_stop = clk_read_stop(CLK_SELN_THREAD);
         mix_cycles += clk_diff(mix_stop, mix_start);
@@ -712,9 +993,14 @@ static XA_ERRORCODE xa_mixer_get_mem_info_size(XAPcmMixer *d, WORD32 i_idx, pVOI
         /* ...input buffer length should be zero, if input-port bypass is enabled. */
         *(WORD32 *)pv_value = 0;
     }
+    else if (i_idx == XA_MIXER_MAX_TRACK_NUMBER + 1)
+    {
+        /* ...scratch holds the accumulator; twice the sample width */
+        *(WORD32 *)pv_value = (WORD32) d->buffer_size * 2;
+    }
     else
     {
-        /* ...all buffers are of the same length */
+        /* ...input and output buffers are of the same length */
         *(WORD32 *)pv_value = (WORD32) d->buffer_size;
     }
 
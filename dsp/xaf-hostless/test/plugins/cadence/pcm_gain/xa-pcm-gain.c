@@ -94,6 +94,17 @@ typedef struct XAPcmGain
     
     /* ...gain index */
     UWORD32                 gain_idx;
+
+    /* ...target gain (Q12) */
+    UWORD32                 gain_target;
+
+    /* ...current gain (Q12 with 15 extra fraction bits) and per-sample ramp step */
+    WORD32                  gain;
+    WORD32                  gain_step;
+
+    /* ...volume ramp length and remaining ramp length, in samples per channel */
+    UWORD32                 ramp_length;
+    UWORD32                 ramp_left;
  
     /* ...framesize in samples per channel */
     UWORD32                 frame_size;    
@@ -103,6 +114,25 @@ typedef struct XAPcmGain
 
 }   XAPcmGain;
 
+/* ...stream state carried by SAVE/RESTORE; module state flags and buffer accounting stay with the instance */
+typedef struct XAPcmGainState
+{
+    /* ...stream format; must match the restoring instance */
+    UWORD32                 channels;
+    UWORD32                 pcm_width;
+    UWORD32                 sample_rate;
+    UWORD32                 frame_size;
+
+    /* ...gain setting and ramp position */
+    UWORD32                 gain_idx;
+    UWORD32                 gain_target;
+    WORD32                  gain;
+    WORD32                  gain_step;
+    UWORD32                 ramp_length;
+    UWORD32                 ramp_left;
+
+}   XAPcmGainState;
+
 
 /****************************************************************************
  * Gain multiplier table
@@ -123,17 +153,20 @@ typedef struct XAPcmGain
 WORD16 pcm_gains_dB[7] = {   0,   -6,  -12, -18,    6,    12,    18};    // in dB
 WORD16 pcm_gains[7]    = {4096, 2053, 1029, 516, 8173, 16306, 32536};    // Q12 format
 
-#define MAX_8BIT ((WORD8)0x7F)
-#define MIN_8BIT ((WORD8)0x80)
+#define MAX_32BIT ((WORD64)(WORD32)0x7FFFFFFF)
+#define MIN_32BIT ((WORD64)(WORD32)0x80000000)
+
+/* ...linear gain limit (Q12, just below +24dB) */
+#define XA_PCM_GAIN_LINEAR_MAX      0xFFFF
 
-#define MAX_16BIT ((WORD16)0x7FFF)
-#define MIN_16BIT ((WORD16)0x8000)
+/* ...extra fraction bits of the current gain */
+#define XA_PCM_GAIN_FRAC            15
 
-#define MAX_24BIT ((WORD32)0x7FFFFF00)
-#define MIN_24BIT  ((WORD32)0x800000FF)
+/* ...gain is held constant over sub-blocks of that many samples per channel during a ramp */
+#define XA_PCM_GAIN_RAMP_BLOCK      16
 
-#define MAX_32BIT ((WORD32)0x7FFFFFFF)
-#define MIN_32BIT  ((WORD32)0x80000000)
+/* ...volume ramp length limit in samples per channel */
+#define XA_PCM_GAIN_RAMP_LENGTH_MAX (1 << 16)
 
 /*******************************************************************************
  * Pcm gain state flags
@@ -163,6 +196,8 @@ static inline void xa_pcm_gain_preinit(XAPcmGain *d)
     d->sample_rate = 48000;
     d->burn_cycles = 0;
     d->frame_size = 480; /* ...10ms frame size at 48 kHz */
+    d->gain_target = pcm_gains[0];
+    d->gain = (WORD32)d->gain_target << XA_PCM_GAIN_FRAC;
 
 #ifdef XA_INPORT_BYPASS_TEST
     /* ...enabled at init for testing. To be enabled by set-config to the plugin. */
@@ -171,193 +206,179 @@ static inline void xa_pcm_gain_preinit(XAPcmGain *d)
 
 }
 
-/* ...apply gain to 8-bit PCM stream */
-static XA_ERRORCODE xa_pcm_gain_do_execute_8bit(XAPcmGain *d)
+/* ...convert gain in 1/10 dB into linear Q12 gain */
+static UWORD32 xa_pcm_gain_db_to_linear(WORD32 db10)
 {
-    WORD32     i, nSize;
-    WORD8    *pIn = (WORD8 *) d->input;
-    WORD8    *pOut = (WORD8 *) d->output;
-    UWORD32     filled;
-    WORD8     input;
-    WORD16     gain = pcm_gains[d->gain_idx];
-    WORD32     product;
-
-    filled = (d->input_avail > d->buffer_size) ? d->buffer_size : d->input_avail;
-    nSize = filled;    //size of each sample is 1 byte
-    
-    /* ...check I/O buffer */
-    XF_CHK_ERR(d->input, XA_PCM_GAIN_EXEC_FATAL_INPUT);    
-    XF_CHK_ERR(d->output, XA_PCM_GAIN_EXEC_FATAL_INPUT);
-    
-    /* ...Processing loop */
-    for (i = 0; i < nSize; i++)
-    {    
-        input = *pIn++;
-        product = (WORD32)input*gain;
-        product = product >> 12;
-        
-        if(product > MAX_8BIT)
-            product = MAX_8BIT;
-        else if(product < MIN_8BIT)
-            product = MIN_8BIT;
-        
-        *pOut++ = (WORD8)product;
+    /* ...10^(n/200) and 10^(n/20) in Q15; 6dB step is 10^(6/20) */
+    static const UWORD16 tenths[10] = {32768, 33147, 33531, 33920, 34312, 34710, 35112, 35518, 35929, 36345};
+    static const UWORD16 units[6] = {32768, 36766, 41252, 46286, 51934, 58271};
+    UWORD32     n = (UWORD32)(db10 < 0 ? -db10 : db10);
+    UWORD64     f = (UWORD64)1 << 24;
+    UWORD64     g;
+
+    /* ...magnitude factor in Q24 */
+    for (; n >= 60; n -= 60)
+    {
+        f = (f * 65381) >> 15;
     }
 
-    /* ...save total number of consumed bytes */
-    //d->consumed = (UWORD32)((void *)pIn - d->input);
-    d->consumed = filled;
+    f = (f * units[n / 10]) >> 15;
+    f = (f * tenths[n % 10]) >> 15;
 
-    /* ...save total number of produced bytes */
-    d->produced = (UWORD32)((void *)pOut - d->output);
+    g = (db10 >= 0 ? ((UWORD64)pcm_gains[0] * f) >> 24 : ((UWORD64)pcm_gains[0] << 24) / f);
 
-    /* ...put flag saying we have output buffer */
-    d->state |= XA_PCM_GAIN_FLAG_OUTPUT;
-    
-    TRACE(PROCESS, _b("produced: %u bytes (%u samples)"), d->produced, nSize);
-
-    /* ...return success result code */
-    return XA_NO_ERROR;
-}    
+    return (UWORD32)(g > XA_PCM_GAIN_LINEAR_MAX ? XA_PCM_GAIN_LINEAR_MAX : g);
+}
 
-/* ...apply gain to 16-bit PCM stream */
-static XA_ERRORCODE xa_pcm_gain_do_execute_16bit(XAPcmGain *d)
+/* ...set new target gain (Q12); ramps from current gain if ramp length is configured */
+static void xa_pcm_gain_set_gain(XAPcmGain *d, UWORD32 gain)
 {
-    WORD32     i, nSize;
-    WORD16    *pIn = (WORD16 *) d->input;
-    WORD16    *pOut = (WORD16 *) d->output;
-    UWORD32     filled;
-    WORD16     input;
-    WORD16     gain = pcm_gains[d->gain_idx];
-    WORD32     product;
+    WORD32      target = (WORD32)gain << XA_PCM_GAIN_FRAC;
 
-    filled = (d->input_avail > d->buffer_size) ? d->buffer_size : d->input_avail;
-    nSize = filled >> 1;    //size of each sample is 2 bytes    
-    
-    /* ...check I/O buffer */
-    XF_CHK_ERR(d->input, XA_PCM_GAIN_EXEC_FATAL_INPUT);    
-    XF_CHK_ERR(d->output, XA_PCM_GAIN_EXEC_FATAL_INPUT);
-    
-    /* ...Processing loop */
-    for (i = 0; i < nSize; i++)
-    {    
-        input = *pIn++;
-        product = (WORD32)input*gain;
-        product = product >> 12;
-        
-        if(product > MAX_16BIT)
-            product = MAX_16BIT;
-        else if(product < MIN_16BIT)
-            product = MIN_16BIT;
-        
-        *pOut++ = (WORD16)product;
+    d->gain_target = gain;
+
+    if ((d->ramp_left = d->ramp_length) == 0)
+    {
+        d->gain = target, d->gain_step = 0;
     }
+    else
+    {
+        /* ...restarted from the current gain if previous ramp is still running */
+        d->gain_step = (target - d->gain) / (WORD32)d->ramp_length;
+    }
+}
 
-    /* ...save total number of consumed bytes */
-    //d->consumed = (UWORD32)((void *)pIn - d->input);
-    d->consumed = filled;
+/* ...load sample as MSB-aligned 32-bit value */
+static inline WORD32 xa_pcm_gain_load(void *p, UWORD32 i, UWORD32 width)
+{
+    switch (width)
+    {
+    case 8:
+        return (WORD32)((WORD8 *)p)[i] << 24;
+    case 16:
+        return (WORD32)((WORD16 *)p)[i] << 16;
+    default:
+        return ((WORD32 *)p)[i];
+    }
+}
 
-    /* ...save total number of produced bytes */
-    d->produced = (UWORD32)((void *)pOut - d->output);
+/* ...store MSB-aligned 32-bit value as a sample; 24-bit samples are MSB-aligned in 32-bit containers */
+static inline void xa_pcm_gain_store(void *p, UWORD32 i, WORD32 v, UWORD32 width)
+{
+    switch (width)
+    {
+    case 8:
+        ((WORD8 *)p)[i] = (WORD8)(v >> 24);
+        break;
+    case 16:
+        ((WORD16 *)p)[i] = (WORD16)(v >> 16);
+        break;
+    case 24:
+        ((WORD32 *)p)[i] = v & (WORD32)0xFFFFFF00;
+        break;
+    default:
+        ((WORD32 *)p)[i] = v;
+    }
+}
 
-    /* ...put flag saying we have output buffer */
-    d->state |= XA_PCM_GAIN_FLAG_OUTPUT;
-    
-    TRACE(PROCESS, _b("produced: %u bytes (%u samples)"), d->produced, nSize);
+/* ...scale MSB-aligned sample by Q12 gain; saturation maps onto min/max, no branches */
+static inline WORD32 xa_pcm_gain_scale(WORD32 x, WORD32 g)
+{
+    WORD64      v = ((WORD64)x * g) >> 12;
 
-    /* ...return success result code */
-    return XA_NO_ERROR;
-}    
+    v = (v > MAX_32BIT ? MAX_32BIT : v);
+    v = (v < MIN_32BIT ? MIN_32BIT : v);
+
+    return (WORD32)v;
+}
 
-/* ...apply gain to 24-bit PCM stream */
-static XA_ERRORCODE xa_pcm_gain_do_execute_24bit(XAPcmGain *d)
+/* ...apply constant gain to samples [i, n); input may be the same buffer as output */
+static inline __attribute__((always_inline)) void xa_pcm_gain_block(void *in, void *out, UWORD32 i, UWORD32 n, WORD32 g, UWORD32 width)
 {
-    WORD32     i, nSize;
-    WORD24    *pIn = (WORD24 *) d->input;
-    WORD24    *pOut = (WORD24 *) d->output;
-    UWORD32     filled;
-    WORD24     input;
-    WORD16     gain = pcm_gains[d->gain_idx];
-    WORD64     product;
+    /* ...unrolled by 4; every group is loaded before it is stored */
+    for (; i + 4 <= n; i += 4)
+    {
+        WORD32  x0 = xa_pcm_gain_load(in, i + 0, width);
+        WORD32  x1 = xa_pcm_gain_load(in, i + 1, width);
+        WORD32  x2 = xa_pcm_gain_load(in, i + 2, width);
+        WORD32  x3 = xa_pcm_gain_load(in, i + 3, width);
+
+        xa_pcm_gain_store(out, i + 0, xa_pcm_gain_scale(x0, g), width);
+        xa_pcm_gain_store(out, i + 1, xa_pcm_gain_scale(x1, g), width);
+        xa_pcm_gain_store(out, i + 2, xa_pcm_gain_scale(x2, g), width);
+        xa_pcm_gain_store(out, i + 3, xa_pcm_gain_scale(x3, g), width);
+    }
 
-    filled = (d->input_avail > d->buffer_size) ? d->buffer_size : d->input_avail;
-    nSize = filled >> 2;    //size of each sample is 4 bytes    
-    
-    /* ...check I/O buffer */
-    XF_CHK_ERR(d->input, XA_PCM_GAIN_EXEC_FATAL_INPUT);    
-    XF_CHK_ERR(d->output, XA_PCM_GAIN_EXEC_FATAL_INPUT);
-    
-    /* ...Processing loop */
-    for (i = 0; i < nSize; i++)
-    {    
-        input = *pIn++;
-        product = (WORD64)input*gain;
-        product = product >> 12;
-        
-        if(product > MAX_24BIT)
-            product = MAX_24BIT;
-        else if(product < MIN_24BIT)
-            product = MIN_24BIT;
-        
-        product &= 0xffffff00;
-        *pOut++ = (WORD24)product;
+    for (; i < n; i++)
+    {
+        xa_pcm_gain_store(out, i, xa_pcm_gain_scale(xa_pcm_gain_load(in, i, width), g), width);
     }
+}
 
-    /* ...save total number of consumed bytes */
-    //d->consumed = (UWORD32)((void *)pIn - d->input);
-    d->consumed = filled;
+/* ...apply gain to n samples; ramp advances per sub-block so inner loops keep constant gain */
+static inline __attribute__((always_inline)) void xa_pcm_gain_process(XAPcmGain *d, UWORD32 n, UWORD32 width)
+{
+    UWORD32     i = 0, k, m;
 
-    /* ...save total number of produced bytes */
-    d->produced = (UWORD32)((void *)pOut - d->output);
+    while (d->ramp_left && i < n)
+    {
+        k = (d->ramp_left < XA_PCM_GAIN_RAMP_BLOCK ? d->ramp_left : XA_PCM_GAIN_RAMP_BLOCK);
+        m = i + k * d->channels;
 
-    /* ...put flag saying we have output buffer */
-    d->state |= XA_PCM_GAIN_FLAG_OUTPUT;
-    
-    TRACE(PROCESS, _b("produced: %u bytes (%u samples)"), d->produced, nSize);
+        /* ...buffer may end within the sub-block; the ramp advances by the frames actually processed */
+        if (m > n)
+            m = n, k = (n - i) / d->channels;
 
-    /* ...return success result code */
-    return XA_NO_ERROR;
-}    
+        xa_pcm_gain_block(d->input, d->output, i, m, d->gain >> XA_PCM_GAIN_FRAC, width);
 
-/* ...apply gain to 32-bit PCM stream */
-static XA_ERRORCODE xa_pcm_gain_do_execute_32bit(XAPcmGain *d)
+        /* ...land exactly on target at the end of the ramp */
+        if ((d->ramp_left -= k) == 0)
+            d->gain = (WORD32)d->gain_target << XA_PCM_GAIN_FRAC;
+        else
+            d->gain += d->gain_step * (WORD32)k;
+
+        i = m;
+    }
+
+    xa_pcm_gain_block(d->input, d->output, i, n, d->gain >> XA_PCM_GAIN_FRAC, width);
+}
+
+/* ...apply gain to PCM stream; kernel is specialized per sample width */
+static XA_ERRORCODE xa_pcm_gain_do_execute(XAPcmGain *d)
 {
-    WORD32     i, nSize;
-    WORD32    *pIn = (WORD32 *) d->input;
-    WORD32    *pOut = (WORD32 *) d->output;
-    UWORD32     filled;   
-    WORD32     input;
-    WORD16     gain = pcm_gains[d->gain_idx];
-    WORD64     product;
+    UWORD32     bps = ((d->pcm_width == 24) ? sizeof(WORD24) : (d->pcm_width >> 3));
+    UWORD32     filled, nSize;
+
+    filled = (d->input_avail > d->buffer_size) ? d->buffer_size : d->input_avail;
+    nSize = filled / bps;
 
-    filled = (d->input_avail > d->buffer_size)?d->buffer_size:d->input_avail;
-    nSize = filled >> 2;    //size of each sample is 4 bytes    
-    
     /* ...check I/O buffer */
     XF_CHK_ERR(d->input, XA_PCM_GAIN_EXEC_FATAL_INPUT);    
     XF_CHK_ERR(d->output, XA_PCM_GAIN_EXEC_FATAL_INPUT);
-    
-    /* ...Processing loop */
-    for (i = 0; i < nSize; i++)
-    {    
-        input = *pIn++;
-        product = (WORD64)input*gain;
-        product = product >> 12;
-        
-        if(product > MAX_32BIT)
-            product = MAX_32BIT;
-        else if(product < MIN_32BIT)
-            product = MIN_32BIT;
-        
-        *pOut++ = (WORD32)product;
+
+    switch (d->pcm_width)
+    {
+    case 8:
+        xa_pcm_gain_process(d, nSize, 8);
+        break;
+    case 16:
+        xa_pcm_gain_process(d, nSize, 16);
+        break;
+    case 24:
+        xa_pcm_gain_process(d, nSize, 24);
+        break;
+    case 32:
+        xa_pcm_gain_process(d, nSize, 32);
+        break;
+    default:
+        return XA_PCM_GAIN_CONFIG_NONFATAL_RANGE;
     }
 
     /* ...save total number of consumed bytes */
-    //d->consumed = (UWORD32)((void *)pIn - d->input);
     d->consumed = filled;
 
     /* ...save total number of produced bytes */
-    d->produced = (UWORD32)((void *)pOut - d->output);
+    d->produced = nSize * bps;
 
     /* ...put flag saying we have output buffer */
     d->state |= XA_PCM_GAIN_FLAG_OUTPUT;
@@ -366,7 +387,7 @@ static XA_ERRORCODE xa_pcm_gain_do_execute_32bit(XAPcmGain *d)
 
     /* ...return success result code */
     return XA_NO_ERROR;
-}    
+}
 
 /* ...runtime reset */
 static XA_ERRORCODE xa_pcm_gain_do_runtime_init(XAPcmGain *d)
@@ -533,6 +554,25 @@ static XA_ERRORCODE xa_pcm_gain_set_config_param(XAPcmGain *d, WORD32 i_idx, pVO
         /* ...set pcm gain component gain index */
         XF_CHK_ERR((i_value <= 6), XA_PCM_GAIN_CONFIG_NONFATAL_RANGE);
         d->gain_idx = (UWORD32)i_value;
+        xa_pcm_gain_set_gain(d, pcm_gains[d->gain_idx]);
+        return XA_NO_ERROR;
+
+    case XA_PCM_GAIN_CONFIG_PARAM_GAIN_LINEAR:
+        /* ...set arbitrary linear gain (Q12) */
+        XF_CHK_ERR((i_value <= XA_PCM_GAIN_LINEAR_MAX), XA_PCM_GAIN_CONFIG_NONFATAL_RANGE);
+        xa_pcm_gain_set_gain(d, i_value);
+        return XA_NO_ERROR;
+
+    case XA_PCM_GAIN_CONFIG_PARAM_GAIN_DB:
+        /* ...set gain in 1/10 dB; saturates just below +24dB */
+        XF_CHK_ERR(((WORD32)i_value >= -1200 && (WORD32)i_value <= 240), XA_PCM_GAIN_CONFIG_NONFATAL_RANGE);
+        xa_pcm_gain_set_gain(d, xa_pcm_gain_db_to_linear((WORD32)i_value));
+        return XA_NO_ERROR;
+
+    case XA_PCM_GAIN_CONFIG_PARAM_RAMP_LENGTH:
+        /* ...applies to subsequent gain changes */
+        XF_CHK_ERR((i_value <= XA_PCM_GAIN_RAMP_LENGTH_MAX), XA_PCM_GAIN_CONFIG_NONFATAL_RANGE);
+        d->ramp_length = (UWORD32)i_value;
         return XA_NO_ERROR;
         
     case XA_PCM_GAIN_CONFIG_PARAM_FRAME_SIZE: /* ...deprecated */
@@ -551,6 +591,7 @@ static XA_ERRORCODE xa_pcm_gain_set_config_param(XAPcmGain *d, WORD32 i_idx, pVO
         memcpy(&gain_data, pv_value, sizeof(xa_gain_factor_event_t));
         /* ... setting gain index decteted by mimo_mix */
         d->gain_idx = gain_data.gain_index; 
+        xa_pcm_gain_set_gain(d, pcm_gains[d->gain_idx]);
         return XA_NO_ERROR;        
 #endif
 
@@ -610,6 +651,16 @@ static XA_ERRORCODE xa_pcm_gain_get_config_param(XAPcmGain *d, WORD32 i_idx, pVO
         *(WORD32 *)pv_value = pcm_gains_dB[d->gain_idx];
         return XA_NO_ERROR;        
 
+    case XA_PCM_GAIN_CONFIG_PARAM_GAIN_LINEAR:
+        /* ...return target linear gain (Q12) */
+        *(WORD32 *)pv_value = d->gain_target;
+        return XA_NO_ERROR;
+
+    case XA_PCM_GAIN_CONFIG_PARAM_RAMP_LENGTH:
+        /* ...return gain ramp length (in samples) */
+        *(WORD32 *)pv_value = d->ramp_length;
+        return XA_NO_ERROR;
+
     case XA_PCM_GAIN_BURN_ADDITIONAL_CYCLES:
         /* ...return number of cycles to be burnt */
         *(WORD32 *)pv_value = d->burn_cycles;
@@ -668,22 +719,9 @@ static XA_ERRORCODE xa_pcm_gain_execute(XAPcmGain *d, WORD32 i_idx, pVOID pv_val
         {
            xa_burn_cycles_module(d);
         }
-        switch(d->pcm_width)
+        if ((ret = xa_pcm_gain_do_execute(d)) != XA_NO_ERROR)
         {
-            case 8:
-                ret = xa_pcm_gain_do_execute_8bit(d);
-                break;
-            case 16:
-                ret = xa_pcm_gain_do_execute_16bit(d);
-                break;
-            case 24:
-                ret = xa_pcm_gain_do_execute_24bit(d);
-                break;
-            case 32:
-                ret = xa_pcm_gain_do_execute_32bit(d);
-                break;
-            default:
-                return XA_PCM_GAIN_CONFIG_NONFATAL_RANGE;
+            return ret;
         }
 
         if ((d->input_avail == d->consumed) && (d->state & XA_PCM_GAIN_FLAG_EOS_RECEIVED)) /* Signal done */
@@ -952,6 +990,69 @@ static XA_ERRORCODE xa_pcm_gain_set_mem_ptr(XAPcmGain *d, WORD32 i_idx, pVOID pv
     }
 }
 
+/* ...get size of the processing state */
+static XA_ERRORCODE xa_pcm_gain_get_state_size(XAPcmGain *d, WORD32 i_idx, pVOID pv_value)
+{
+    /* ...basic sanity check */
+    XF_CHK_ERR(d && pv_value, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    *(WORD32 *)pv_value = sizeof(XAPcmGainState);
+
+    return XA_NO_ERROR;
+}
+
+/* ...save processing state */
+static XA_ERRORCODE xa_pcm_gain_save_state(XAPcmGain *d, WORD32 i_idx, pVOID pv_value)
+{
+    XAPcmGainState     *s = (XAPcmGainState *)pv_value;
+
+    /* ...basic sanity check */
+    XF_CHK_ERR(d && pv_value, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...check the state buffer is large enough */
+    XF_CHK_ERR((UWORD32)i_idx >= sizeof(*s), XA_API_FATAL_INVALID_CMD_TYPE);
+
+    s->channels = d->channels;
+    s->pcm_width = d->pcm_width;
+    s->sample_rate = d->sample_rate;
+    s->frame_size = d->frame_size;
+    s->gain_idx = d->gain_idx;
+    s->gain_target = d->gain_target;
+    s->gain = d->gain;
+    s->gain_step = d->gain_step;
+    s->ramp_length = d->ramp_length;
+    s->ramp_left = d->ramp_left;
+
+    return XA_NO_ERROR;
+}
+
+/* ...restore processing state */
+static XA_ERRORCODE xa_pcm_gain_restore_state(XAPcmGain *d, WORD32 i_idx, pVOID pv_value)
+{
+    XAPcmGainState     *s = (XAPcmGainState *)pv_value;
+
+    /* ...basic sanity check */
+    XF_CHK_ERR(d && pv_value, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...codec must be initialized */
+    XF_CHK_ERR(d->state & XA_PCM_GAIN_FLAG_POSTINIT_DONE, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...check the state size */
+    XF_CHK_ERR((UWORD32)i_idx == sizeof(*s), XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...buffers are sized by the format; it cannot change */
+    XF_CHK_ERR(s->channels == d->channels && s->pcm_width == d->pcm_width, XA_PCM_GAIN_CONFIG_FATAL_RANGE);
+    XF_CHK_ERR(s->sample_rate == d->sample_rate && s->frame_size == d->frame_size, XA_PCM_GAIN_CONFIG_FATAL_RANGE);
+
+    d->gain_idx = s->gain_idx;
+    d->gain_target = s->gain_target;
+    d->gain = s->gain;
+    d->gain_step = s->gain_step;
+    d->ramp_length = s->ramp_length;
+    d->ramp_left = s->ramp_left;
+
+    return XA_NO_ERROR;
+}
 
 /*******************************************************************************
  * API command hooks
@@ -978,6 +1079,10 @@ static XA_ERRORCODE (* const xa_pcm_gain_api[])(XAPcmGain *, WORD32, pVOID) =
     [XA_API_CMD_GET_MEM_INFO_ALIGNMENT] = xa_pcm_gain_get_mem_info_alignment,
     [XA_API_CMD_GET_MEM_INFO_TYPE]      = xa_pcm_gain_get_mem_info_type,
     [XA_API_CMD_SET_MEM_PTR]            = xa_pcm_gain_set_mem_ptr,
+
+    [XA_API_CMD_GET_STATE_SIZE]         = xa_pcm_gain_get_state_size,
+    [XA_API_CMD_SAVE_STATE]             = xa_pcm_gain_save_state,
+    [XA_API_CMD_RESTORE_STATE]          = xa_pcm_gain_restore_state,
 };
 
 /* ...total number of commands supported */
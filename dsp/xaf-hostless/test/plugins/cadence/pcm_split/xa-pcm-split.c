@@ -53,7 +53,7 @@ extern clk_t pcm_split_cycles;
 
 #define XA_MIMO_CFG_DEFAULT_PCM_WIDTH	16
 #define XA_MIMO_CFG_DEFAULT_CHANNELS	2
-#define XA_MIMO_CFG_DEFAULT_FRAMESIZE	512
+#define XA_MIMO_CFG_DEFAULT_OUT_PORTS	2
 
 #define XA_MIMO_CFG_PERSIST_SIZE	4	
 #define XA_MIMO_CFG_SCRATCH_SIZE	4
@@ -61,7 +61,7 @@ extern clk_t pcm_split_cycles;
 #define XA_MIMO_CFG_OUT_BUFFER_SIZE	(1024*4)
 
 #define XA_MIMO_IN_PORTS		1
-#define XA_MIMO_OUT_PORTS		2
+#define XA_MIMO_OUT_PORTS		XA_PCM_SPLIT_MAX_OUTPUTS
 
 /*******************************************************************************
  * Internal functions definitions
@@ -102,6 +102,7 @@ typedef struct XAPcmAec
     UWORD32                 produced[XA_MIMO_OUT_PORTS];
     
     UWORD32                 num_out_ports; /* ... number of output ports active */
+    UWORD32                 max_out_ports; /* ... number of output ports of the created component */
 
     /* ...scratch buffer pointer */
     void               	    *scratch;
@@ -113,6 +114,9 @@ typedef struct XAPcmAec
     UWORD32                 pcm_width;
     UWORD32                 channels;
 
+    /* ...buffer length in samples per channel; 0 - default buffer sizes */
+    UWORD32                 frame_size;
+
     WORD16		    port_state[XA_MIMO_IN_PORTS + XA_MIMO_OUT_PORTS];
 
     /* ...input port bypass flag: 0 disabled (default), 1 enabled */
@@ -146,7 +150,8 @@ static inline void xa_aec_preinit(XAPcmAec *d)
         
     /* ...set default parameters */
     d->num_in_ports = XA_MIMO_IN_PORTS;
-    d->num_out_ports = XA_MIMO_OUT_PORTS;
+    d->num_out_ports = XA_MIMO_CFG_DEFAULT_OUT_PORTS;
+    d->max_out_ports = XA_MIMO_CFG_DEFAULT_OUT_PORTS;
 
     d->pcm_width = XA_MIMO_CFG_DEFAULT_PCM_WIDTH;
     d->channels = XA_MIMO_CFG_DEFAULT_CHANNELS;
@@ -163,90 +168,64 @@ static inline void xa_aec_preinit(XAPcmAec *d)
 
 }
 
-/* ...do pcm-gain scaling of stereo PCM-16 streams */
-static XA_ERRORCODE xa_aec_do_execute_stereo_16bit(XAPcmAec *d)
+/* ...copy input onto every connected output port; PCM format only affects buffer sizes */
+static XA_ERRORCODE xa_aec_do_execute(XAPcmAec *d)
 {
-    WORD32     i, nSize;
+    UWORD32    i, filled;
 
     XF_CHK_ERR(d->state & XA_AEC_FLAG_RUNNING, XA_API_FATAL_INVALID_CMD_TYPE);
 
-    if((d->num_in_ports==1) && (d->num_out_ports==2))
-    {
-	/* Playback-> speaker/src splitter */
-        /* 1 in, 2 out */
-
-        /* ...check I/O buffer */
-#if 1
-        XF_CHK_ERR(d->input[0], XA_PCM_SPLIT_EXEC_FATAL_STATE);
-        XF_CHK_ERR(d->output[0], XA_PCM_SPLIT_EXEC_NONFATAL_NO_DATA);
-        XF_CHK_ERR(d->output[1], XA_PCM_SPLIT_EXEC_NONFATAL_NO_DATA);
-#endif
+    /* ...check input buffer */
+    XF_CHK_ERR(d->input[0], XA_PCM_SPLIT_EXEC_FATAL_STATE);
 
-        WORD32    filled = d->input_length[0];
-        WORD16    *pIn0  = (WORD16 *) d->input[0];
-        WORD16    *pOut0 = (WORD16 *) d->output[0];
-        WORD16    *pOut1 = (WORD16 *) d->output[1];
+    /* reset consumed/produced counters */
+    for (i = 0; i < d->num_in_ports; i++)
+        d->consumed[i] = 0;
 
-        /* reset consumed/produced counters */
-        for (i = 0;i < (d->num_in_ports); i++)
-          d->consumed[i] = 0;
-        
-        for (i = 0;i < (d->num_out_ports); i++)
-          d->produced[i] = 0;
+    for (i = 0; i < d->num_out_ports; i++)
+        d->produced[i] = 0;
 
-        for (i = 0;i < (d->num_in_ports + d->num_out_ports); i++)
+    /* ...input must be connected; a paused port stalls all outputs to keep them aligned */
+    for (i = 0; i < (d->num_in_ports + d->num_out_ports); i++)
+    {
+        if ((d->port_state[i] & XA_AEC_FLAG_PORT_PAUSED) || ((i < d->num_in_ports) && !(d->port_state[i] & XA_AEC_FLAG_PORT_CONNECTED)))
         {
-          if((d->port_state[i] & XA_AEC_FLAG_PORT_PAUSED) || (!(d->port_state[i] & XA_AEC_FLAG_PORT_CONNECTED)))
-          {
-              /* non-fatal error if one of the port is paused or not connected*/
-              TRACE(PROCESS, _b("Port:%d is paused or not connected"), i);
-              return XA_PCM_SPLIT_EXEC_NONFATAL_NO_DATA;
-          }
+            /* non-fatal error if one of the port is paused or not connected*/
+            TRACE(PROCESS, _b("Port:%d is paused or not connected"), i);
+            return XA_PCM_SPLIT_EXEC_NONFATAL_NO_DATA;
         }
+    }
 
-        filled = (filled > d->out_buffer_size) ? d->out_buffer_size : filled;
-        nSize = filled >> 1;    //size of each sample is 2 bytes    
-
-        /* ...Processing loop */
-        for (i = 0; i < nSize; i++)
-        {    
-            WORD16     input0;
-            input0 = *pIn0++;
-            
-            *pOut0++ = (WORD16)input0;
-            *pOut1++ = (WORD16)input0;
-        }
-        
-        /* ...save total number of produced bytes */
-        d->produced[0] = (UWORD32)((void *)pOut0 - d->output[0]);
-        d->produced[1] = (UWORD32)((void *)pOut1 - d->output[1]);
-       
-        /* ...put flag saying we have output buffer */
-        if(d->produced[0])
-       	  d->state |= XA_AEC_FLAG_OUTPUT;
-        
-        /* ...save total number of consumed bytes */
-        //d->consumed[0] = (UWORD32)((void *)pIn0 - d->input[0]);
-        d->consumed[0] = filled;
-        d->input_length[0] -= d->consumed[0];
+    filled = (d->input_length[0] > d->out_buffer_size) ? d->out_buffer_size : d->input_length[0];
 
-      	if(d->port_state[0] & XA_AEC_FLAG_COMPLETE) 
-	{
-	  d->state |= XA_AEC_FLAG_EXEC_DONE; //set state: EXEC_DONE/COMPLETE
-	}
+    /* ...unconnected output ports of the component are left untouched */
+    for (i = 0; i < d->num_out_ports; i++)
+    {
+        if ((d->port_state[d->num_in_ports + i] & XA_AEC_FLAG_PORT_CONNECTED) && d->output[i])
+        {
+            memcpy(d->output[i], d->input[0], filled);
+            d->produced[i] = filled;
 
-        TRACE(PROCESS, _b("consumed: %u bytes, produced: (%u, %u) bytes (%u samples) done=%d"), d->consumed[0], d->produced[0], d->produced[1], nSize, (d->state & XA_AEC_FLAG_EXEC_DONE)?1:0);
+            /* ...put flag saying we have output buffer */
+            if (filled)
+                d->state |= XA_AEC_FLAG_OUTPUT;
+        }
     }
-    else
+
+    /* ...save total number of consumed bytes */
+    d->consumed[0] = filled;
+    d->input_length[0] -= filled;
+
+    if (d->port_state[0] & XA_AEC_FLAG_COMPLETE)
     {
-        TRACE(ERROR, _x("unsupported input(%d)/output(%d) port numbers"), d->num_in_ports, d->num_out_ports);
-	return XA_PCM_SPLIT_EXEC_FATAL_STATE;
+        d->state |= XA_AEC_FLAG_EXEC_DONE; //set state: EXEC_DONE/COMPLETE
     }
 
+    TRACE(PROCESS, _b("consumed: %u bytes, produced: %u bytes on %u ports, done=%d"), d->consumed[0], filled, d->num_out_ports, (d->state & XA_AEC_FLAG_EXEC_DONE) ? 1 : 0);
 
     /* ...return success result code */
     return XA_NO_ERROR;
-}    
+}
 
 /* ...runtime reset */
 static XA_ERRORCODE xa_aec_do_runtime_init(XAPcmAec *d)
@@ -302,7 +281,11 @@ static XA_ERRORCODE xa_aec_init(XAPcmAec *d, WORD32 i_idx, pVOID pv_value)
         XF_CHK_ERR(d->state & XA_AEC_FLAG_PREINIT_DONE, XA_API_FATAL_INVALID_CMD_TYPE);
     
         /* ...calculate input/output buffer size in bytes */
-        //d->in_buffer_size = d->channels * d->frame_size * (d->pcm_width == 16 ? sizeof(WORD16) : sizeof(WORD32));
+        if (d->frame_size)
+        {
+            d->in_buffer_size = d->channels * d->frame_size * ((d->pcm_width == 24) ? sizeof(WORD24) : (d->pcm_width >> 3));
+            d->out_buffer_size = d->in_buffer_size;
+        }
         
         /* ...mark post-initialization is complete */
         d->state |= XA_AEC_FLAG_POSTINIT_DONE;
@@ -386,17 +369,37 @@ static XA_ERRORCODE xa_aec_set_config_param(XAPcmAec *d, WORD32 i_idx, pVOID pv_
         }
 
     case XA_PCM_SPLIT_CONFIG_PARAM_PCM_WIDTH:
-        /* ...check value is permitted (16 bits only) */
-        XF_CHK_ERR(i_value == 16, XA_PCM_SPLIT_CONFIG_FATAL_RANGE);
+        /* ...check value is permitted (8, 16, 24 or 32 bits) */
+        XF_CHK_ERR((i_value == 8) || (i_value == 16) || (i_value == 24) || (i_value == 32), XA_PCM_SPLIT_CONFIG_FATAL_RANGE);
         d->pcm_width = (UWORD32)i_value;
 	break;
 
     case XA_PCM_SPLIT_CONFIG_PARAM_CHANNELS:
-        /* ...allow stereo only */
-        XF_CHK_ERR((i_value <= 2) && (i_value > 0), XA_PCM_SPLIT_CONFIG_FATAL_RANGE);
+        /* ...allow upto 16 channels */
+        XF_CHK_ERR((i_value <= 16) && (i_value > 0), XA_PCM_SPLIT_CONFIG_FATAL_RANGE);
         d->channels = (UWORD32)i_value;
 	break;
 
+    case XA_PCM_SPLIT_CONFIG_PARAM_FRAME_SIZE:
+        /* ...buffer sizes are fixed after post-initialization */
+        XF_CHK_ERR(!(d->state & XA_AEC_FLAG_POSTINIT_DONE), XA_PCM_SPLIT_CONFIG_FATAL_RANGE);
+        XF_CHK_ERR(i_value <= 8192, XA_PCM_SPLIT_CONFIG_FATAL_RANGE);
+        d->frame_size = (UWORD32)i_value;
+	break;
+
+    case XA_PCM_SPLIT_CONFIG_PARAM_NUM_OUTPUTS:
+        /* ...no more outputs than the component has ports; fixed after post-initialization */
+        XF_CHK_ERR(!(d->state & XA_AEC_FLAG_POSTINIT_DONE), XA_PCM_SPLIT_CONFIG_FATAL_RANGE);
+        XF_CHK_ERR((i_value >= 1) && (i_value <= d->max_out_ports), XA_PCM_SPLIT_CONFIG_FATAL_RANGE);
+        d->num_out_ports = (UWORD32)i_value;
+	break;
+
+    case XA_PCM_SPLIT_CONFIG_PARAM_INPORT_BYPASS:
+        /* ...input is read in place from upstream buffers; memory layout is fixed after post-initialization */
+        XF_CHK_ERR(!(d->state & XA_AEC_FLAG_POSTINIT_DONE), XA_PCM_SPLIT_CONFIG_FATAL_RANGE);
+        d->inport_bypass = (i_value ? 1 : 0);
+	break;
+
     case XA_PCM_SPLIT_CONFIG_PARAM_PORT_PAUSE:
         {
           XF_CHK_ERR((i_value < (d->num_in_ports + d->num_out_ports)), XA_PCM_SPLIT_CONFIG_FATAL_RANGE);
@@ -464,12 +467,31 @@ static XA_ERRORCODE xa_aec_get_config_param(XAPcmAec *d, WORD32 i_idx, pVOID pv_
         *(WORD32 *)pv_value = d->channels;
         return XA_NO_ERROR;
 
+    case XA_PCM_SPLIT_CONFIG_PARAM_FRAME_SIZE:
+        /* ...return buffer length in samples per channel */
+        *(WORD32 *)pv_value = d->frame_size;
+        return XA_NO_ERROR;
+
+    case XA_PCM_SPLIT_CONFIG_PARAM_NUM_OUTPUTS:
+        /* ...return number of output ports */
+        *(WORD32 *)pv_value = d->num_out_ports;
+        return XA_NO_ERROR;
+
+    case XA_PCM_SPLIT_CONFIG_PARAM_INPORT_BYPASS:
+        /* ...return input port bypass flag */
+        *(WORD32 *)pv_value = d->inport_bypass;
+        return XA_NO_ERROR;
+
 #ifdef XA_EXT_CONFIG_TEST 
     case XA_PCM_SPLIT_CONFIG_PARAM_PRODUCED:
     {
         xaf_ext_buffer_t *ext_buf = (xaf_ext_buffer_t *) pv_value;
-        memcpy(ext_buf->data, &d->produced, sizeof(d->produced));
-        ext_buf->valid_data_size = sizeof(d->produced);
+        UWORD32 size = d->num_out_ports * sizeof(d->produced[0]);
+
+        /* ...one counter per active output port */
+        XF_CHK_ERR(ext_buf->max_data_size >= size, XA_PCM_SPLIT_CONFIG_FATAL_RANGE);
+        memcpy(ext_buf->data, d->produced, size);
+        ext_buf->valid_data_size = size;
         return XA_NO_ERROR;
     }
 #endif
@@ -502,7 +524,7 @@ static XA_ERRORCODE xa_aec_execute(XAPcmAec *d, WORD32 i_idx, pVOID pv_value)
 #ifdef XAF_PROFILE
         pcm_split_start = clk_read_start(CLK_SELN_THREAD);
 #endif
-        ret = xa_aec_do_execute_stereo_16bit(d);
+        ret = xa_aec_do_execute(d);
 #ifdef XAF_PROFILE
         pcm_split_stop = clk_read_stop(CLK_SELN_THREAD);
         pcm_split_cycles += clk_diff(pcm_split_stop, pcm_split_start);
@@ -854,3 +876,26 @@ XA_ERRORCODE xa_pcm_split(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD3
     return xa_aec_api[i_cmd](d, i_idx, pv_value);
 }
 
+/* ...entry points of the 1-to-4 and 1-to-8 components; all created outputs are active by default */
+static XA_ERRORCODE xa_pcm_split_ports(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value, UWORD32 ports)
+{
+    XAPcmAec       *d = (XAPcmAec *) p_xa_module_obj;
+    XA_ERRORCODE    ret = xa_pcm_split(p_xa_module_obj, i_cmd, i_idx, pv_value);
+
+    if ((ret == XA_NO_ERROR) && (i_cmd == XA_API_CMD_INIT) && (i_idx == XA_CMD_TYPE_INIT_API_PRE_CONFIG_PARAMS))
+    {
+        d->num_out_ports = d->max_out_ports = ports;
+    }
+
+    return ret;
+}
+
+XA_ERRORCODE xa_pcm_split14(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value)
+{
+    return xa_pcm_split_ports(p_xa_module_obj, i_cmd, i_idx, pv_value, 4);
+}
+
+XA_ERRORCODE xa_pcm_split18(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value)
+{
+    return xa_pcm_split_ports(p_xa_module_obj, i_cmd, i_idx, pv_value, 8);
+}
@@ -52,6 +52,7 @@
  * Includes
  ******************************************************************************/
 #include "osal-timer.h"
+#include "osal-thread.h"
 #include <stdio.h>
 #include "audio/xa-renderer-api.h"
 #include "xf-debug.h"
@@ -73,11 +74,28 @@ extern clk_t renderer_cycles;
 /* maximum allowed framesize in bytes per channel. This is the default framesize */
 #define MAX_FRAME_SIZE_IN_BYTES_DEFAULT    ( HW_FIFO_LENGTH / 4 )      
 
-/* minimum allowed framesize in bytes per channel */
-#define MIN_FRAME_SIZE_IN_BYTES    ( 128 )
+/* minimum allowed framesize in bytes per channel: 1ms frame at 16 kHz with 2 bytes per sample (low-latency mode) */
+#define MIN_FRAME_SIZE_IN_BYTES    ( 16 * 1 * 2 )
 
 #define HW_I2S_SF (44100)
 
+/* ...output file name; instance N > 0 writes renderer_out_N.pcm */
+#define RENDERER_OUT_FILE               "renderer_out"
+#define RENDERER_OUT_FILE_NAME_LEN      32
+
+/* ...write-behind buffer of the file sink, in bytes (power of 2) */
+#define RENDERER_SINK_LENGTH            (2 * HW_FIFO_LENGTH)
+
+/* ...file sink thread; runs below the DSP worker threads */
+#define RENDERER_SINK_STACK_SIZE        4096
+#define RENDERER_SINK_THREAD_PRIORITY   1
+
+/* ...file sink events */
+#define RENDERER_SINK_EVENT_DATA        (1 << 0)
+#define RENDERER_SINK_EVENT_SPACE       (1 << 1)
+#define RENDERER_SINK_EVENT_EXIT        (1 << 2)
+#define RENDERER_SINK_EVENT_ALL         (RENDERER_SINK_EVENT_DATA | RENDERER_SINK_EVENT_SPACE | RENDERER_SINK_EVENT_EXIT)
+
 #define READ_FIFO(payload) {\
         if(d->output)\
         {\
@@ -85,19 +103,19 @@ extern clk_t renderer_cycles;
             memcpy(d->output, d->pfifo_r, payload);\
             d->bytes_produced = payload;\
         }\
-        /* ...write to output file and increment read pointer */\
-        fwrite((char *)d->pfifo_r, 1, payload, d->fw); d->pfifo_r += payload;\
-        if((UWORD32)d->pfifo_r >= (UWORD32)&g_fifo_renderer[2*payload])\
+        /* ...queue to output file sink and increment read pointer */\
+        xa_fw_renderer_sink_write(d, d->pfifo_r, payload); d->pfifo_r += payload;\
+        if((UWORD32)d->pfifo_r >= (UWORD32)&d->fifo[2*payload])\
         {\
-            d->pfifo_r = (void*)g_fifo_renderer;\
+            d->pfifo_r = (void*)d->fifo;\
         }\
     }
 
 #define UPDATE_WPTR(offset, payload) {\
         d->pfifo_w += offset;\
-        if((UWORD32)d->pfifo_w >= (UWORD32)&g_fifo_renderer[2*payload])\
+        if((UWORD32)d->pfifo_w >= (UWORD32)&d->fifo[2*payload])\
         {\
-            d->pfifo_w = (void*)g_fifo_renderer;\
+            d->pfifo_w = (void*)d->fifo;\
         }\
     }
 
@@ -178,6 +196,40 @@ typedef struct XARenderer
     /* ...input port bypass flag: 0 disabled (default), 1 enabled */
     UWORD32     inport_bypass;
 
+    /* ...instance index, selects the output file */
+    UWORD32     instance_id;
+
+    /* ...FIFO timer, one per instance */
+    xf_timer_t  timer;
+
+    /* ...number of FIFO underruns/overruns */
+    UWORD32     underruns;
+
+    /* ...number of frames that waited for the file sink to drain */
+    UWORD32     sink_stalls;
+
+    /* ...file sink write/read positions (free-running byte counters) */
+    volatile UWORD32    sink_w;
+    volatile UWORD32    sink_r;
+
+    /* ...file sink thread is running */
+    UWORD32     sink_active;
+
+    /* ...file sink thread and its events */
+    xf_thread_t sink_thread;
+    xf_event_t  sink_event;
+
+    /* ...HW FIFO emulation buffer */
+    UWORD8      fifo[HW_FIFO_LENGTH];
+
+    /* ...file sink write-behind buffer */
+    UWORD8      sink[RENDERER_SINK_LENGTH];
+
+#if !defined(HAVE_FREERTOS)
+    /* ...file sink thread stack */
+    UWORD8      sink_stack[RENDERER_SINK_STACK_SIZE];
+#endif
+
 }   XARenderer;
 
 
@@ -191,14 +243,6 @@ typedef struct XARenderer
 #define XA_RENDERER_FLAG_IDLE           (1 << 2)
 #define XA_RENDERER_FLAG_RUNNING        (1 << 3)
 #define XA_RENDERER_FLAG_PAUSED         (1 << 4)
-/*******************************************************************************
- * global variables
- ******************************************************************************/
-
-static xf_timer_t rend_timer;
-const char grenderer_out_file[] = "renderer_out.pcm";
-UWORD8 g_fifo_renderer[HW_FIFO_LENGTH];
-
 /*******************************************************************************
  * xa_fw_fifo_handler
  *
@@ -217,16 +261,18 @@ static void xa_fw_handler(void *arg)
 
     if((d->fifo_avail)>HW_FIFO_LENGTH)
        {/*under run case*/
+           d->underruns++;
            d->state ^= XA_RENDERER_FLAG_RUNNING | XA_RENDERER_FLAG_IDLE;
            d->fifo_avail = HW_FIFO_LENGTH;
-           __xf_timer_stop(&rend_timer);
+           __xf_timer_stop(&d->timer);
            d->cdata->cb(d->cdata, 0);
        }
       else if(((int)d-> fifo_avail) <= 0)
        {/* over run */
+           d->underruns++;
            d->state ^= XA_RENDERER_FLAG_RUNNING | XA_RENDERER_FLAG_IDLE;
            d->fifo_avail=HW_FIFO_LENGTH;
-           __xf_timer_stop(&rend_timer);
+           __xf_timer_stop(&d->timer);
            d->cdata->cb(d->cdata, 0);
        }
       else
@@ -235,15 +281,124 @@ static void xa_fw_handler(void *arg)
       }
 }
 
+/*******************************************************************************
+ * xa_fw_renderer_sink_thread
+ *
+ * Drain the write-behind buffer into the output file. The render path only
+ * copies into the buffer, so file I/O latency does not reach the FIFO timing
+ ******************************************************************************/
+
+static void *xa_fw_renderer_sink_thread(void *arg)
+{
+    XARenderer *d = arg;
+    UWORD32     r, n;
+
+    while (1)
+    {
+        __xf_event_wait_any(&d->sink_event, RENDERER_SINK_EVENT_DATA | RENDERER_SINK_EVENT_EXIT);
+        __xf_event_clear(&d->sink_event, RENDERER_SINK_EVENT_DATA);
+
+        while ((n = d->sink_w - d->sink_r) != 0)
+        {
+            /* ...write up to the end of the buffer; wrapped tail goes next iteration */
+            r = d->sink_r & (RENDERER_SINK_LENGTH - 1);
+            n = (n < RENDERER_SINK_LENGTH - r ? n : RENDERER_SINK_LENGTH - r);
+
+            fwrite(&d->sink[r], 1, n, d->fw);
+
+            d->sink_r += n;
+            __xf_event_set(&d->sink_event, RENDERER_SINK_EVENT_SPACE);
+        }
+
+        /* ...exit only once everything queued before the request is written */
+        if ((__xf_event_get(&d->sink_event) & RENDERER_SINK_EVENT_EXIT) && d->sink_w == d->sink_r)
+        {
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+/* ...queue data to the file sink; waits only if the write-behind buffer is full */
+static void xa_fw_renderer_sink_write(XARenderer *d, void *b, UWORD32 bytes)
+{
+    UWORD32 w, n;
+
+    if (!d->sink_active)
+    {
+        /* ...sink is drained after exec done; write anything late directly */
+        fwrite(b, 1, bytes, d->fw);
+        return;
+    }
+
+    if (RENDERER_SINK_LENGTH - (d->sink_w - d->sink_r) < bytes)
+    {
+        d->sink_stalls++;
+
+        TRACE(OUTPUT, _b("file sink stall, pending:%u"), d->sink_w - d->sink_r);
+
+        while (1)
+        {
+            __xf_event_clear(&d->sink_event, RENDERER_SINK_EVENT_SPACE);
+
+            if (RENDERER_SINK_LENGTH - (d->sink_w - d->sink_r) >= bytes)
+            {
+                break;
+            }
+
+            __xf_event_wait_any(&d->sink_event, RENDERER_SINK_EVENT_SPACE);
+        }
+    }
+
+    w = d->sink_w & (RENDERER_SINK_LENGTH - 1);
+    n = (bytes < RENDERER_SINK_LENGTH - w ? bytes : RENDERER_SINK_LENGTH - w);
+
+    memcpy(&d->sink[w], b, n);
+    memcpy(&d->sink[0], (UWORD8 *)b + n, bytes - n);
+
+    d->sink_w += bytes;
+    __xf_event_set(&d->sink_event, RENDERER_SINK_EVENT_DATA);
+}
+
+/* ...write out pending data and join the file sink thread */
+static void xa_fw_renderer_sink_stop(XARenderer *d)
+{
+    if (!d->sink_active)
+    {
+        return;
+    }
+
+    __xf_event_set(&d->sink_event, RENDERER_SINK_EVENT_EXIT);
+    __xf_thread_join(&d->sink_thread, NULL);
+    __xf_thread_destroy(&d->sink_thread);
+    __xf_event_destroy(&d->sink_event);
+
+    d->sink_active = 0;
+
+    fflush(d->fw);
+}
+
 /*******************************************************************************
  * Codec access functions
  ******************************************************************************/
 
 static inline void xa_fw_renderer_close(XARenderer *d)
 {
+    /* ...nothing to do if the sink is already closed */
+    if (d->fw == NULL)
+    {
+        return;
+    }
+
+    __xf_timer_stop(&d->timer);
+    __xf_timer_destroy(&d->timer);
+
+    /* ...flush pending data and stop the file sink before closing the file */
+    xa_fw_renderer_sink_stop(d);
+
     fclose(d->fw);
-    __xf_timer_stop(&rend_timer);
-    __xf_timer_destroy(&rend_timer);
+    d->fw = NULL;
 }
 
 /* ...submit data (in bytes) into internal renderer ring-buffer */
@@ -291,7 +446,7 @@ static inline UWORD32 xa_fw_renderer_submit(XARenderer *d, void *b, UWORD32 byte
             //if (avail <= (HW_FIFO_LENGTH - (2 * payload)))
             if (avail == 0)
             {
-                __xf_timer_start(&rend_timer,__xf_timer_ratio_to_period((d->frame_size_bytes / d->sample_size ),
+                __xf_timer_start(&d->timer,__xf_timer_ratio_to_period((d->frame_size_bytes / d->sample_size ),
                             d->rate));
                 d->state ^= XA_RENDERER_FLAG_IDLE | XA_RENDERER_FLAG_RUNNING;
 
@@ -314,8 +469,11 @@ static inline UWORD32 xa_fw_renderer_submit(XARenderer *d, void *b, UWORD32 byte
         if(d->exec_done) 
         {
             /* ... stop interrupts as soon as exec is done */
-            __xf_timer_stop(&rend_timer);
+            __xf_timer_stop(&d->timer);
             d->state ^= XA_RENDERER_FLAG_RUNNING | XA_RENDERER_FLAG_IDLE;
+
+            /* ...nothing more is queued; write out the sink and release its thread */
+            xa_fw_renderer_sink_stop(d);
         
             TRACE(OUTPUT, _b("exec done, timer stopped"));
         }
@@ -340,28 +498,55 @@ static XA_ERRORCODE xa_renderer_get_api_size(XARenderer *d, WORD32 i_idx, pVOID
 
 static XA_ERRORCODE xa_fw_renderer_init (XARenderer *d)
 {
+   char file_name[RENDERER_OUT_FILE_NAME_LEN];
+
    d->consumed = 0;
    d->fw = NULL;
 
+   /*initially FIFO will be empty so fifo_avail is 2x framesize bytes for ping and pong */
+   d->fifo_avail = d->frame_size_bytes * d->channels * 2;
+
+   /* ...make sure that the frame_size_bytes is within the FIFO length */
+   XF_CHK_ERR(d->fifo_avail <= HW_FIFO_LENGTH, XA_RENDERER_CONFIG_NONFATAL_RANGE);
+
    /*opening the output file*/
-   d->fw = fopen(grenderer_out_file,"wb");
+   if (d->instance_id)
+       snprintf(file_name, sizeof(file_name), RENDERER_OUT_FILE "_%u.pcm", (unsigned)d->instance_id);
+   else
+       snprintf(file_name, sizeof(file_name), RENDERER_OUT_FILE ".pcm");
+
+   d->fw = fopen(file_name,"wb");
    if ( d->fw == NULL )
    {
      /*file open failed*/
      return XA_FATAL_ERROR;
    }
-   /*initially FIFO will be empty so fifo_avail is 2x framesize bytes for ping and pong */
-   d->fifo_avail = d->frame_size_bytes * d->channels * 2;
-
-   /* ...make sure that the frame_size_bytes is within the FIFO length */
-   XF_CHK_ERR(d->fifo_avail <= HW_FIFO_LENGTH, XA_RENDERER_CONFIG_NONFATAL_RANGE);
 
    /* ...initialize FIFO params, zero fill FIFO and init pointers to start of FIFO */
-   d->pfifo_w = d->pfifo_r = (void *)g_fifo_renderer;
+   d->pfifo_w = d->pfifo_r = (void *)d->fifo;
    memset(d->pfifo_w, 0, d->fifo_avail);
    
+   /* ...start the file sink */
+   d->sink_w = d->sink_r = 0;
+   __xf_event_init(&d->sink_event, RENDERER_SINK_EVENT_ALL);
+   __xf_thread_init(&d->sink_thread);
+
+#if defined(HAVE_FREERTOS)
+   if (__xf_thread_create(&d->sink_thread, xa_fw_renderer_sink_thread, d, "renderer-sink", NULL, RENDERER_SINK_STACK_SIZE, RENDERER_SINK_THREAD_PRIORITY) != 0)
+#else
+   if (__xf_thread_create(&d->sink_thread, xa_fw_renderer_sink_thread, d, "renderer-sink", d->sink_stack, RENDERER_SINK_STACK_SIZE, RENDERER_SINK_THREAD_PRIORITY) != 0)
+#endif
+   {
+     __xf_event_destroy(&d->sink_event);
+     fclose(d->fw);
+     d->fw = NULL;
+     return XA_FATAL_ERROR;
+   }
+
+   d->sink_active = 1;
+
    /*initialises the timer ;timer0 is used as system timer*/
-   __xf_timer_init(&rend_timer, xa_fw_handler, d, 1);
+   __xf_timer_init(&d->timer, xa_fw_handler, d, 1);
 
 #ifdef XA_INPORT_BYPASS_TEST
     /* ...enabled at init for testing. To be enabled by set-config to the plugin. */
@@ -454,7 +639,7 @@ static inline XA_ERRORCODE xa_hw_renderer_control(XARenderer *d, UWORD32 state)
             d->fifo_avail = 0;
 
             /* ...start-up transmission with zero filled FIFO */
-            __xf_timer_start(&rend_timer, __xf_timer_ratio_to_period((d->frame_size_bytes / d->sample_size ), d->rate));
+            __xf_timer_start(&d->timer, __xf_timer_ratio_to_period((d->frame_size_bytes / d->sample_size ), d->rate));
 
             /* ...change state to Running */
             d->state ^= (XA_RENDERER_FLAG_IDLE | XA_RENDERER_FLAG_RUNNING);
@@ -601,6 +786,16 @@ static XA_ERRORCODE xa_renderer_set_config_param(XARenderer *d, WORD32 i_idx, pV
             
             return XA_NO_ERROR;
         }
+
+    case XA_RENDERER_CONFIG_PARAM_INSTANCE_ID:
+        /* ...command is valid only in configuration state */
+        XF_CHK_ERR((d->state & XA_RENDERER_FLAG_POSTINIT_DONE) == 0, XA_RENDERER_CONFIG_FATAL_STATE);
+
+        /* ...instance index selects the output file */
+        d->instance_id = (UWORD32) *(WORD32 *)pv_value;
+
+        return XA_NO_ERROR;
+
     default:
         /* ...unrecognized parameter */
         return XF_CHK_ERR(0, XA_API_FATAL_INVALID_CMD_TYPE);
@@ -676,6 +871,21 @@ static XA_ERRORCODE xa_renderer_get_config_param(XARenderer *d, WORD32 i_idx, pV
         return XA_NO_ERROR;
 #endif
 
+    case XA_RENDERER_CONFIG_PARAM_INSTANCE_ID:
+        /* ...return instance index */
+        *(WORD32 *)pv_value = d->instance_id;
+        return XA_NO_ERROR;
+
+    case XA_RENDERER_CONFIG_PARAM_UNDERRUNS:
+        /* ...return number of FIFO underruns/overruns */
+        *(WORD32 *)pv_value = d->underruns;
+        return XA_NO_ERROR;
+
+    case XA_RENDERER_CONFIG_PARAM_SINK_STALLS:
+        /* ...return number of file sink stalls */
+        *(WORD32 *)pv_value = d->sink_stalls;
+        return XA_NO_ERROR;
+
     default:
         /* ...unrecognized parameter */
         return XF_CHK_ERR(0, XA_API_FATAL_INVALID_CMD_TYPE);
@@ -968,6 +1178,18 @@ static XA_ERRORCODE xa_renderer_input_over(XARenderer *d, WORD32 i_idx, pVOID pv
     return XA_NO_ERROR;
 }
 
+/* ...component teardown; the file sink thread lives in the API structure */
+static XA_ERRORCODE xa_renderer_deinit(XARenderer *d, WORD32 i_idx, pVOID pv_value)
+{
+    /* ...basic sanity check */
+    XF_CHK_ERR(d, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...stop the timer and the file sink before the API memory is released */
+    xa_fw_renderer_close(d);
+
+    return XA_NO_ERROR;
+}
+
 /*******************************************************************************
  * API command hooks
  ******************************************************************************/
@@ -990,6 +1212,7 @@ static XA_ERRORCODE (* const xa_renderer_api[])(XARenderer *, WORD32, pVOID) =
     [XA_API_CMD_SET_MEM_PTR]            = xa_renderer_set_mem_ptr,
     [XA_API_CMD_INPUT_OVER]             = xa_renderer_input_over,
     [XA_API_CMD_GET_OUTPUT_BYTES]       = xa_renderer_get_output_bytes,
+    [XA_API_CMD_DEINIT]                 = xa_renderer_deinit,
 };
 
 /* ...total numer of commands supported */
@@ -0,0 +1,1005 @@
+/*
+* Copyright (c) 2015-2022 Cadence Design Systems Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to deal in the Software without restriction, including
+* without limitation the rights to use, copy, modify, merge, publish,
+* distribute, sublicense, and/or sell copies of the Software, and to
+* permit persons to whom the Software is furnished to do so, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+/*******************************************************************************
+ * xa-src-poly.c
+ *
+ * Polyphase windowed-sinc sample-rate converter plugin
+ ******************************************************************************/
+
+#define MODULE_TAG                      SRC_POLY
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <string.h>
+
+/* ...debugging facility */
+#include "xf-debug.h"
+#include "audio/xa-src-poly-api.h"
+#include "xaf-api.h"
+
+#ifdef XAF_PROFILE
+#include "xaf-clk-test.h"
+extern clk_t src_cycles;
+#endif
+
+/*******************************************************************************
+ * Internal definitions
+ ******************************************************************************/
+
+/* ...maximal phase resolution (high quality) */
+#define XA_SRC_POLY_PHASES_MAX          64
+
+/* ...maximal input chunk size in samples per channel */
+#define XA_SRC_POLY_CHUNK_MAX           (1 << 16)
+
+/* ...filter cutoff relative to the lower of the two Nyquist frequencies */
+#define XA_SRC_POLY_PASSBAND            0.9
+
+#define XA_SRC_POLY_PI                  3.14159265358979323846
+
+#define MAX_32BIT ((WORD64)(WORD32)0x7FFFFFFF)
+#define MIN_32BIT ((WORD64)(WORD32)0x80000000)
+
+/* ...quality level parameters */
+static const struct
+{
+    /* ...filter length, log2 of phases number, phase interpolation flag */
+    UWORD8          taps, phases_log2, interp;
+
+}   xa_src_poly_quality[XA_SRC_POLY_QUALITY_NUM] = {
+    [XA_SRC_POLY_QUALITY_LOW]       = {  8, 5, 0 },
+    [XA_SRC_POLY_QUALITY_MEDIUM]    = { 16, 6, 1 },
+    [XA_SRC_POLY_QUALITY_HIGH]      = { 32, 6, 1 },
+};
+
+/* ...API structure */
+typedef struct XASrcPoly
+{
+    /* ...src module state */
+    UWORD32                 state;
+
+    /* ...number of channels */
+    UWORD32                 channels;
+
+    /* ...bytes per sample; 3 and 4 use 32-bit containers */
+    UWORD32                 bps;
+
+    /* ...input and output sampling rates */
+    UWORD32                 in_fs;
+    UWORD32                 out_fs;
+
+    /* ...input chunk size in samples per channel */
+    UWORD32                 chunk_size;
+
+    /* ...quality level */
+    UWORD32                 quality;
+
+    /* ...filter length and phase index shift of the Q32 phase fraction */
+    UWORD32                 taps;
+    UWORD32                 phase_shift;
+
+    /* ...2^32 / out_fs, converts phase accumulator into Q32 fraction */
+    UWORD32                 inv_out;
+
+    /* ...phase accumulator in 1/out_fs units of input sample period */
+    UWORD32                 acc;
+
+    /* ...delay lines write position */
+    UWORD32                 w;
+
+    /* ...zero frames left to push through the filter at end of stream */
+    UWORD32                 flush_left;
+
+    /* ...output buffer capacity and number of produced frames */
+    UWORD32                 out_frames_max;
+    UWORD32                 out_frames;
+
+    /* ...input buffer */
+    void                   *input;
+
+    /* ...output buffer */
+    void                   *output;
+
+    /* ...number of available bytes in the input buffer */
+    UWORD32                 input_avail;
+
+    /* ...number of bytes consumed from input buffer */
+    UWORD32                 consumed;
+
+    /* ...number of produced bytes */
+    UWORD32                 produced;
+
+    /* ...delay lines, each kept twice so the newest taps are always contiguous */
+    WORD32                  delay[XA_SRC_POLY_MAX_CHANNELS][2 * XA_SRC_POLY_TAPS_MAX];
+
+    /* ...polyphase coefficients (Q15), one extra phase for interpolation */
+    WORD16                  coef[(XA_SRC_POLY_PHASES_MAX + 1) * XA_SRC_POLY_TAPS_MAX];
+
+    /* ...streamed coefficient table being received, and number of bytes received so far */
+    WORD16                  coef_load[(XA_SRC_POLY_PHASES_MAX + 1) * XA_SRC_POLY_TAPS_MAX];
+    UWORD32                 coef_loaded;
+
+}   XASrcPoly;
+
+/*******************************************************************************
+ * SRC state flags
+ ******************************************************************************/
+
+#define XA_SRC_POLY_FLAG_PREINIT_DONE      (1 << 0)
+#define XA_SRC_POLY_FLAG_POSTINIT_DONE     (1 << 1)
+#define XA_SRC_POLY_FLAG_RUNNING           (1 << 2)
+#define XA_SRC_POLY_FLAG_OUTPUT            (1 << 3)
+#define XA_SRC_POLY_FLAG_EOS_RECEIVED      (1 << 4)
+#define XA_SRC_POLY_FLAG_COMPLETE          (1 << 5)
+
+/*******************************************************************************
+ * Filter design
+ ******************************************************************************/
+
+/* ...cosine by Taylor series after range reduction; used at initialization only */
+static double xa_src_poly_cos(double x)
+{
+    double      x2, t, s;
+    int         k;
+
+    /* ...reduce to [-pi, pi] */
+    x -= 2 * XA_SRC_POLY_PI * (double)(WORD32)(x / (2 * XA_SRC_POLY_PI) + (x >= 0 ? 0.5 : -0.5));
+
+    for (x2 = x * x, t = s = 1, k = 2; k <= 28; k += 2)
+    {
+        t *= -x2 / (double)((k - 1) * k);
+        s += t;
+    }
+
+    return s;
+}
+
+/* ...Blackman-windowed sinc with normalized cutoff fc at offset x (in input samples) */
+static double xa_src_poly_kernel(double x, double fc, UWORD32 taps)
+{
+    double      w, y;
+
+    if (x <= -(double)taps / 2 || x >= (double)taps / 2)
+        return 0;
+
+    w = 0.42 + 0.5 * xa_src_poly_cos(2 * XA_SRC_POLY_PI * x / taps) + 0.08 * xa_src_poly_cos(4 * XA_SRC_POLY_PI * x / taps);
+
+    y = XA_SRC_POLY_PI * fc * x;
+
+    return w * fc * (y < 1e-9 && y > -1e-9 ? 1 : xa_src_poly_cos(y - XA_SRC_POLY_PI / 2) / y);
+}
+
+/* ...fill polyphase table; every phase is normalized to unity DC gain */
+static void xa_src_poly_design(XASrcPoly *d)
+{
+    UWORD32     taps = d->taps, phases = 1 << (32 - d->phase_shift);
+    double      fc = XA_SRC_POLY_PASSBAND * (d->out_fs < d->in_fs ? (double)d->out_fs / d->in_fs : 1.0);
+    double      s, v;
+    UWORD32     p, j;
+
+    for (p = 0; p <= phases; p++)
+    {
+        /* ...tap j holds the j-th newest sample; the output point lies past tap taps/2 */
+        for (s = 0, j = 0; j < taps; j++)
+        {
+            s += xa_src_poly_kernel((double)taps / 2 - j - (double)p / phases, fc, taps);
+        }
+
+        /* ...kernel is evaluated again rather than kept, stretched filters are too long for the stack */
+        for (j = 0; j < taps; j++)
+        {
+            v = xa_src_poly_kernel((double)taps / 2 - j - (double)p / phases, fc, taps) / s * 32768;
+            v = (v >= 0 ? v + 0.5 : v - 0.5);
+            v = (v > 32767 ? 32767 : (v < -32768 ? -32768 : v));
+            d->coef[p * taps + j] = (WORD16)v;
+        }
+    }
+}
+
+/*******************************************************************************
+ * DSP functions
+ ******************************************************************************/
+
+/* ...src component pre-initialization (default parameters) */
+static inline void xa_src_poly_preinit(XASrcPoly *d)
+{
+    /* ...pre-configuration initialization; reset internal data */
+    memset(d, 0, sizeof(*d));
+
+    /* ...set default parameters */
+    d->channels = 2;
+    d->bps = 2;
+    d->in_fs = 44100;
+    d->out_fs = 48000;
+    d->chunk_size = 1024;
+    d->quality = XA_SRC_POLY_QUALITY_MEDIUM;
+}
+
+/* ...reset filter history and resampling phase */
+static void xa_src_poly_reset(XASrcPoly *d)
+{
+    memset(d->delay, 0, sizeof(d->delay));
+    d->acc = 0;
+    d->w = 0;
+    d->flush_left = d->taps / 2;
+}
+
+/* ...load sample as MSB-aligned 32-bit value */
+static inline WORD32 xa_src_poly_load(void *p, UWORD32 i, UWORD32 bps)
+{
+    return (bps == 2 ? (WORD32)((WORD16 *)p)[i] << 16 : ((WORD32 *)p)[i]);
+}
+
+/* ...store MSB-aligned 32-bit value; 24-bit samples are MSB-aligned in 32-bit containers */
+static inline void xa_src_poly_store(void *p, UWORD32 i, WORD32 v, UWORD32 bps)
+{
+    switch (bps)
+    {
+    case 2:
+        ((WORD16 *)p)[i] = (WORD16)(v >> 16);
+        break;
+    case 3:
+        ((WORD32 *)p)[i] = v & (WORD32)0xFFFFFF00;
+        break;
+    default:
+        ((WORD32 *)p)[i] = v;
+    }
+}
+
+/* ...dot product of the newest taps with one filter phase; result in Q15 */
+static inline __attribute__((always_inline)) WORD64 xa_src_poly_fir(const WORD32 *x, const WORD16 *h, UWORD32 taps)
+{
+    WORD64      a0 = 0, a1 = 0;
+    UWORD32     k;
+
+    /* ...taps number is a multiple of 4 */
+    for (k = 0; k < taps; k += 4)
+    {
+        a0 += (WORD64)x[k + 0] * h[k + 0] + (WORD64)x[k + 1] * h[k + 1];
+        a1 += (WORD64)x[k + 2] * h[k + 2] + (WORD64)x[k + 3] * h[k + 3];
+    }
+
+    return a0 + a1;
+}
+
+/* ...resample up to n input frames (zeros if input is NULL); returns number of consumed frames */
+static inline __attribute__((always_inline)) UWORD32 xa_src_poly_process(XASrcPoly *d, void *in, UWORD32 n, UWORD32 bps, UWORD32 taps, UWORD32 interp)
+{
+    UWORD32     ch = d->channels, in_fs = d->in_fs, out_fs = d->out_fs;
+    UWORD32     room = d->out_frames_max - d->out_frames;
+    UWORD32     burst = out_fs / in_fs + 1;
+    UWORD32     acc = d->acc, w = d->w;
+    UWORD32     o = d->out_frames * ch;
+    UWORD32     i, c;
+
+    /* ...stop once the worst-case output of the next input frame no longer fits */
+    for (i = 0; i < n && room >= burst; i++)
+    {
+        /* ...push input frame into delay lines */
+        w = (w == 0 ? taps : w) - 1;
+
+        for (c = 0; c < ch; c++)
+        {
+            WORD32  x = (in ? xa_src_poly_load(in, i * ch + c, bps) : 0);
+
+            d->delay[c][w] = d->delay[c][w + taps] = x;
+        }
+
+        /* ...produce all output frames falling before the next input frame */
+        for (; acc < out_fs; acc += in_fs, room--)
+        {
+            UWORD32         frac = acc * d->inv_out;
+            const WORD16   *h;
+            WORD32          a = 0;
+
+            if (interp)
+            {
+                h = d->coef + (frac >> d->phase_shift) * taps;
+                a = (WORD32)((frac >> (d->phase_shift - 15)) & 0x7FFF);
+            }
+            else
+            {
+                /* ...nearest phase; table has an extra phase for fractions close to 1 */
+                h = d->coef + (((frac >> (d->phase_shift - 1)) + 1) >> 1) * taps;
+            }
+
+            for (c = 0; c < ch; c++)
+            {
+                const WORD32   *x = &d->delay[c][w];
+                WORD64          y = xa_src_poly_fir(x, h, taps) >> 15;
+
+                if (interp)
+                {
+                    /* ...linear interpolation between adjacent phase outputs */
+                    WORD64      y1 = xa_src_poly_fir(x, h + taps, taps) >> 15;
+
+                    y += ((y1 - y) * a) >> 15;
+                }
+
+                y = (y > MAX_32BIT ? MAX_32BIT : y);
+                y = (y < MIN_32BIT ? MIN_32BIT : y);
+
+                xa_src_poly_store(d->output, o++, (WORD32)y, bps);
+            }
+        }
+
+        acc -= out_fs;
+    }
+
+    d->acc = acc, d->w = w;
+    d->out_frames = o / ch;
+
+    return i;
+}
+
+/* ...kernel dispatch for given filter; specialized per sample size */
+static inline __attribute__((always_inline)) UWORD32 xa_src_poly_run_filter(XASrcPoly *d, void *in, UWORD32 n, UWORD32 taps, UWORD32 interp)
+{
+    switch (d->bps)
+    {
+    case 2:
+        return xa_src_poly_process(d, in, n, 2, taps, interp);
+    case 3:
+        return xa_src_poly_process(d, in, n, 3, taps, interp);
+    default:
+        return xa_src_poly_process(d, in, n, 4, taps, interp);
+    }
+}
+
+/* ...kernel dispatch per quality level */
+static UWORD32 xa_src_poly_run(XASrcPoly *d, void *in, UWORD32 n)
+{
+    /* ...filter stretched for down-conversion has its length known at run-time only */
+    if (d->taps != xa_src_poly_quality[d->quality].taps)
+    {
+        if (xa_src_poly_quality[d->quality].interp)
+            return xa_src_poly_run_filter(d, in, n, d->taps, 1);
+        else
+            return xa_src_poly_run_filter(d, in, n, d->taps, 0);
+    }
+
+    switch (d->quality)
+    {
+    case XA_SRC_POLY_QUALITY_LOW:
+        return xa_src_poly_run_filter(d, in, n, 8, 0);
+    case XA_SRC_POLY_QUALITY_MEDIUM:
+        return xa_src_poly_run_filter(d, in, n, 16, 1);
+    default:
+        return xa_src_poly_run_filter(d, in, n, 32, 1);
+    }
+}
+
+/* ...resample available input; flush filter tail once end-of-stream is received */
+static XA_ERRORCODE xa_src_poly_do_execute(XASrcPoly *d)
+{
+    UWORD32     frame = d->channels * (d->bps == 2 ? 2 : 4);
+    UWORD32     n = d->input_avail / frame, k;
+
+    /* ...check I/O buffer */
+    XF_CHK_ERR(d->output, XA_SRC_POLY_EXEC_FATAL_OUTPUT);
+    XF_CHK_ERR(d->input || n == 0, XA_SRC_POLY_EXEC_FATAL_INPUT);
+
+    d->out_frames = 0;
+
+    k = (n ? xa_src_poly_run(d, d->input, n) : 0);
+
+    /* ...trailing partial frame is dropped with the last full frame */
+    d->consumed = (k == n ? d->input_avail : k * frame);
+
+    if (k == n && (d->state & XA_SRC_POLY_FLAG_EOS_RECEIVED) && d->flush_left)
+    {
+        d->flush_left -= xa_src_poly_run(d, NULL, d->flush_left);
+    }
+
+    /* ...save total number of produced bytes */
+    d->produced = d->out_frames * frame;
+
+    /* ...put flag saying we have output buffer */
+    d->state |= XA_SRC_POLY_FLAG_OUTPUT;
+
+    TRACE(PROCESS, _b("consumed: %u bytes, produced: %u bytes"), d->consumed, d->produced);
+
+    return XA_NO_ERROR;
+}
+
+/* ...runtime reset */
+static XA_ERRORCODE xa_src_poly_do_runtime_init(XASrcPoly *d)
+{
+    xa_src_poly_reset(d);
+
+    return XA_NO_ERROR;
+}
+
+/*******************************************************************************
+ * Commands processing
+ ******************************************************************************/
+
+/* ...codec API size query */
+static XA_ERRORCODE xa_src_poly_get_api_size(XASrcPoly *d, WORD32 i_idx, pVOID pv_value)
+{
+    /* ...check parameters are sane */
+    XF_CHK_ERR(pv_value, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...retrieve API structure size */
+    *(WORD32 *)pv_value = sizeof(*d);
+
+    return XA_NO_ERROR;
+}
+
+/* ...standard codec initialization routine */
+static XA_ERRORCODE xa_src_poly_init(XASrcPoly *d, WORD32 i_idx, pVOID pv_value)
+{
+    /* ...sanity check - src component must be valid */
+    XF_CHK_ERR(d, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...process particular initialization type */
+    switch (i_idx)
+    {
+    case XA_CMD_TYPE_INIT_API_PRE_CONFIG_PARAMS:
+    {
+        /* ...pre-configuration initialization; reset internal data */
+        xa_src_poly_preinit(d);
+
+        /* ...and mark src component has been created */
+        d->state = XA_SRC_POLY_FLAG_PREINIT_DONE;
+
+        return XA_NO_ERROR;
+    }
+
+    case XA_CMD_TYPE_INIT_API_POST_CONFIG_PARAMS:
+    {
+        UWORD32     burst;
+
+        /* ...post-configuration initialization (all parameters are set) */
+        XF_CHK_ERR(d->state & XA_SRC_POLY_FLAG_PREINIT_DONE, XA_API_FATAL_INVALID_CMD_TYPE);
+
+        /* ...select filter and build the phase table for the rate pair */
+        d->taps = XA_SRC_POLY_TAPS(xa_src_poly_quality[d->quality].taps, d->in_fs, d->out_fs);
+        d->phase_shift = 32 - xa_src_poly_quality[d->quality].phases_log2;
+        d->inv_out = (UWORD32)(((UWORD64)1 << 32) / d->out_fs);
+        xa_src_poly_design(d);
+
+        /* ...output buffer holds the largest possible output of a full input chunk */
+        burst = d->out_fs / d->in_fs + 1;
+        d->out_frames_max = (UWORD32)(((UWORD64)d->chunk_size * d->out_fs + d->in_fs - 1) / d->in_fs) + burst;
+
+        xa_src_poly_reset(d);
+
+        /* ...mark post-initialization is complete */
+        d->state |= XA_SRC_POLY_FLAG_POSTINIT_DONE;
+
+        return XA_NO_ERROR;
+    }
+
+    case XA_CMD_TYPE_INIT_PROCESS:
+    {
+        /* ...kick run-time initialization process; make sure src component is setup */
+        XF_CHK_ERR(d->state & XA_SRC_POLY_FLAG_POSTINIT_DONE, XA_API_FATAL_INVALID_CMD_TYPE);
+
+        /* ...enter into execution stage */
+        d->state |= XA_SRC_POLY_FLAG_RUNNING;
+
+        return XA_NO_ERROR;
+    }
+
+    case XA_CMD_TYPE_INIT_DONE_QUERY:
+    {
+        /* ...check if initialization is done; make sure pointer is sane */
+        XF_CHK_ERR(pv_value, XA_API_FATAL_INVALID_CMD_TYPE);
+
+        /* ...put current status */
+        *(WORD32 *)pv_value = (d->state & XA_SRC_POLY_FLAG_RUNNING ? 1 : 0);
+
+        return XA_NO_ERROR;
+    }
+
+    default:
+        /* ...unrecognised command type */
+        TRACE(ERROR, _x("Unrecognised command type: %X"), i_idx);
+        return XA_API_FATAL_INVALID_CMD_TYPE;
+    }
+}
+
+/* ...receive a chunk of the streamed coefficient table; the table in use is replaced at the last chunk */
+static XA_ERRORCODE xa_src_poly_load_coef(XASrcPoly *d, xaf_ext_chunk_t *chunk)
+{
+    UWORD32     total, size;
+
+    /* ...table dimensions are known after post-initialization */
+    XF_CHK_ERR(d->state & XA_SRC_POLY_FLAG_POSTINIT_DONE, XA_SRC_POLY_CONFIG_FATAL_STATE);
+
+    total = XA_SRC_POLY_COEF_SIZE(d->taps, 1 << (32 - d->phase_shift));
+
+    /* ...only streamed tables are accepted, sized for the selected quality */
+    XF_CHK_ERR(chunk->buf.ext_config_flags & (1 << XAF_EXT_PARAM_FLAG_OFFSET_CHUNK), XA_SRC_POLY_CONFIG_FATAL_RANGE);
+    XF_CHK_ERR(chunk->total_size == total, XA_SRC_POLY_CONFIG_FATAL_RANGE);
+
+    /* ...first chunk restarts reception; any other has to continue the received data */
+    if (chunk->offset == 0)
+    {
+        d->coef_loaded = 0;
+    }
+
+    XF_CHK_ERR(chunk->offset == d->coef_loaded, XA_SRC_POLY_CONFIG_FATAL_STATE);
+
+    size = chunk->buf.valid_data_size;
+    XF_CHK_ERR(size > 0 && size <= total - chunk->offset, XA_SRC_POLY_CONFIG_FATAL_RANGE);
+
+    memcpy((UWORD8 *)d->coef_load + chunk->offset, chunk->buf.data, size);
+    d->coef_loaded += size;
+
+    if (d->coef_loaded == total)
+    {
+        memcpy(d->coef, d->coef_load, total);
+        d->coef_loaded = 0;
+
+        TRACE(INIT, _b("coefficient table loaded: %u bytes"), total);
+    }
+
+    return XA_NO_ERROR;
+}
+
+/* ...set src component configuration parameter */
+static XA_ERRORCODE xa_src_poly_set_config_param(XASrcPoly *d, WORD32 i_idx, pVOID pv_value)
+{
+    UWORD32     i_value;
+
+    /* ...sanity check - src component pointer must be sane */
+    XF_CHK_ERR(d && pv_value, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...pre-initialization must be completed */
+    XF_CHK_ERR(d->state & XA_SRC_POLY_FLAG_PREINIT_DONE, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...coefficient table is streamed into an initialized filter */
+    if (i_idx == XA_SRC_POLY_CONFIG_PARAM_COEF)
+    {
+        return xa_src_poly_load_coef(d, (xaf_ext_chunk_t *)pv_value);
+    }
+
+    /* ...filter and buffers are fixed after post-initialization */
+    XF_CHK_ERR(!(d->state & XA_SRC_POLY_FLAG_POSTINIT_DONE), XA_SRC_POLY_CONFIG_NONFATAL_STATE);
+
+    /* ...get parameter value  */
+    i_value = (UWORD32) *(WORD32 *)pv_value;
+
+    /* ...process individual configuration parameter */
+    switch (i_idx)
+    {
+    case XA_SRC_POLY_CONFIG_PARAM_INPUT_SAMPLE_RATE:
+        XF_CHK_ERR((i_value >= XA_SRC_POLY_MIN_SAMPLE_RATE && i_value <= XA_SRC_POLY_MAX_SAMPLE_RATE), XA_SRC_POLY_CONFIG_NONFATAL_RANGE);
+        d->in_fs = i_value;
+        return XA_NO_ERROR;
+
+    case XA_SRC_POLY_CONFIG_PARAM_OUTPUT_SAMPLE_RATE:
+        XF_CHK_ERR((i_value >= XA_SRC_POLY_MIN_SAMPLE_RATE && i_value <= XA_SRC_POLY_MAX_SAMPLE_RATE), XA_SRC_POLY_CONFIG_NONFATAL_RANGE);
+        d->out_fs = i_value;
+        return XA_NO_ERROR;
+
+    case XA_SRC_POLY_CONFIG_PARAM_INPUT_CHUNK_SIZE:
+        XF_CHK_ERR((i_value >= 1 && i_value <= XA_SRC_POLY_CHUNK_MAX), XA_SRC_POLY_CONFIG_NONFATAL_RANGE);
+        d->chunk_size = i_value;
+        return XA_NO_ERROR;
+
+    case XA_SRC_POLY_CONFIG_PARAM_INPUT_CHANNELS:
+        XF_CHK_ERR((i_value >= 1 && i_value <= XA_SRC_POLY_MAX_CHANNELS), XA_SRC_POLY_CONFIG_NONFATAL_RANGE);
+        d->channels = i_value;
+        return XA_NO_ERROR;
+
+    case XA_SRC_POLY_CONFIG_PARAM_BYTES_PER_SAMPLE:
+        XF_CHK_ERR((i_value >= 2 && i_value <= 4), XA_SRC_POLY_CONFIG_NONFATAL_RANGE);
+        d->bps = i_value;
+        return XA_NO_ERROR;
+
+    case XA_SRC_POLY_CONFIG_PARAM_QUALITY:
+        XF_CHK_ERR((i_value < XA_SRC_POLY_QUALITY_NUM), XA_SRC_POLY_CONFIG_NONFATAL_RANGE);
+        d->quality = i_value;
+        return XA_NO_ERROR;
+
+    default:
+        TRACE(ERROR, _x("Invalid parameter: %X"), i_idx);
+        return XA_API_FATAL_INVALID_CMD_TYPE;
+    }
+}
+
+/* ...retrieve configuration parameter */
+static XA_ERRORCODE xa_src_poly_get_config_param(XASrcPoly *d, WORD32 i_idx, pVOID pv_value)
+{
+    /* ...sanity check - src component must be initialized */
+    XF_CHK_ERR(d && pv_value, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...make sure pre-initialization is completed */
+    XF_CHK_ERR(d->state & XA_SRC_POLY_FLAG_PREINIT_DONE, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...process individual configuration parameter */
+    switch (i_idx)
+    {
+    case XA_SRC_POLY_CONFIG_PARAM_INPUT_SAMPLE_RATE:
+        *(WORD32 *)pv_value = d->in_fs;
+        return XA_NO_ERROR;
+
+    case XA_SRC_POLY_CONFIG_PARAM_OUTPUT_SAMPLE_RATE:
+    case XA_CODEC_CONFIG_PARAM_SAMPLE_RATE:
+        *(WORD32 *)pv_value = d->out_fs;
+        return XA_NO_ERROR;
+
+    case XA_SRC_POLY_CONFIG_PARAM_INPUT_CHUNK_SIZE:
+        *(WORD32 *)pv_value = d->chunk_size;
+        return XA_NO_ERROR;
+
+    case XA_SRC_POLY_CONFIG_PARAM_OUTPUT_CHUNK_SIZE:
+        /* ...samples per channel produced by last execution */
+        *(WORD32 *)pv_value = d->out_frames;
+        return XA_NO_ERROR;
+
+    case XA_SRC_POLY_CONFIG_PARAM_INPUT_CHANNELS:
+    case XA_CODEC_CONFIG_PARAM_CHANNELS:
+        *(WORD32 *)pv_value = d->channels;
+        return XA_NO_ERROR;
+
+    case XA_SRC_POLY_CONFIG_PARAM_BYTES_PER_SAMPLE:
+        *(WORD32 *)pv_value = d->bps;
+        return XA_NO_ERROR;
+
+    case XA_CODEC_CONFIG_PARAM_PCM_WIDTH:
+        *(WORD32 *)pv_value = d->bps * 8;
+        return XA_NO_ERROR;
+
+    case XA_SRC_POLY_CONFIG_PARAM_QUALITY:
+        *(WORD32 *)pv_value = d->quality;
+        return XA_NO_ERROR;
+
+    default:
+        TRACE(ERROR, _x("Invalid parameter: %X"), i_idx);
+        return XA_API_FATAL_INVALID_CMD_TYPE;
+    }
+}
+
+/* ...execution command */
+static XA_ERRORCODE xa_src_poly_execute(XASrcPoly *d, WORD32 i_idx, pVOID pv_value)
+{
+    XA_ERRORCODE ret = XA_NO_ERROR;
+#ifdef XAF_PROFILE
+    clk_t comp_start, comp_stop;
+#endif
+
+    /* ...sanity check - src component must be valid */
+    XF_CHK_ERR(d, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...src component must be in running state */
+    XF_CHK_ERR(d->state & XA_SRC_POLY_FLAG_RUNNING, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...process individual command type */
+    switch (i_idx)
+    {
+    case XA_CMD_TYPE_DO_EXECUTE:
+#ifdef XAF_PROFILE
+        comp_start = clk_read_start(CLK_SELN_THREAD);
+#endif
+        if ((ret = xa_src_poly_do_execute(d)) != XA_NO_ERROR)
+        {
+            return ret;
+        }
+
+        /* ...signal done once input is drained and filter tail is flushed */
+        if ((d->input_avail == d->consumed) && (d->state & XA_SRC_POLY_FLAG_EOS_RECEIVED) && d->flush_left == 0)
+        {
+            d->state |= XA_SRC_POLY_FLAG_COMPLETE;
+            d->state &= ~XA_SRC_POLY_FLAG_EOS_RECEIVED;
+        }
+
+#ifdef XAF_PROFILE
+        comp_stop = clk_read_stop(CLK_SELN_THREAD);
+        src_cycles += clk_diff(comp_stop, comp_start);
+#endif
+        return ret;
+
+    case XA_CMD_TYPE_DONE_QUERY:
+        /* ...check if processing is complete */
+        XF_CHK_ERR(pv_value, XA_API_FATAL_INVALID_CMD_TYPE);
+        *(WORD32 *)pv_value = (d->state & XA_SRC_POLY_FLAG_COMPLETE ? 1 : 0);
+        return XA_NO_ERROR;
+
+    case XA_CMD_TYPE_DO_RUNTIME_INIT:
+        /* ...reset src component operation */
+        return xa_src_poly_do_runtime_init(d);
+
+    default:
+        /* ...unrecognised command */
+        TRACE(ERROR, _x("Invalid index: %X"), i_idx);
+        return XA_API_FATAL_INVALID_CMD_TYPE;
+    }
+}
+
+/* ...set number of input bytes */
+static XA_ERRORCODE xa_src_poly_set_input_bytes(XASrcPoly *d, WORD32 i_idx, pVOID pv_value)
+{
+    /* ...sanity check - check parameters */
+    XF_CHK_ERR(d && pv_value, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...track index must be valid */
+    XF_CHK_ERR(i_idx == 0, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...src component must be initialized */
+    XF_CHK_ERR(d->state & XA_SRC_POLY_FLAG_POSTINIT_DONE, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...input frame length should not be negative (in bytes) */
+    XF_CHK_ERR((*(WORD32 *)pv_value) >= 0, XA_SRC_POLY_EXEC_NONFATAL_INPUT);
+
+    /* ...all is correct; set input buffer length in bytes */
+    d->input_avail = (UWORD32)*(WORD32 *)pv_value;
+
+    /* ...reset exec-done state of the plugin to enable processing input */
+    d->state &= ~XA_SRC_POLY_FLAG_COMPLETE;
+
+    return XA_NO_ERROR;
+}
+
+/* ...get number of output bytes */
+static XA_ERRORCODE xa_src_poly_get_output_bytes(XASrcPoly *d, WORD32 i_idx, pVOID pv_value)
+{
+    /* ...sanity check - check parameters */
+    XF_CHK_ERR(d && pv_value, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...track index must be valid */
+    XF_CHK_ERR(i_idx == 1, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...src component must be running */
+    XF_CHK_ERR(d->state & XA_SRC_POLY_FLAG_RUNNING, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...output buffer must exist */
+    XF_CHK_ERR(d->output, XA_SRC_POLY_EXEC_NONFATAL_OUTPUT);
+
+    /* ...return number of produced bytes */
+    *(WORD32 *)pv_value = ((d->state & XA_SRC_POLY_FLAG_OUTPUT) ? d->produced : 0);
+
+    return XA_NO_ERROR;
+}
+
+/* ...get number of consumed bytes */
+static XA_ERRORCODE xa_src_poly_get_curidx_input_buf(XASrcPoly *d, WORD32 i_idx, pVOID pv_value)
+{
+    /* ...sanity check - check parameters */
+    XF_CHK_ERR(d && pv_value, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...track index must be valid */
+    XF_CHK_ERR(i_idx == 0, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...src component must be running */
+    XF_CHK_ERR(d->state & XA_SRC_POLY_FLAG_RUNNING, XA_SRC_POLY_EXEC_FATAL_STATE);
+
+    /* ...return number of bytes consumed */
+    *(WORD32 *)pv_value = d->consumed;
+
+    /* ...and reset internally managed number of consumed bytes */
+    d->consumed = 0;
+
+    return XA_NO_ERROR;
+}
+
+/* ...end-of-stream processing */
+static XA_ERRORCODE xa_src_poly_input_over(XASrcPoly *d, WORD32 i_idx, pVOID pv_value)
+{
+    /* ...sanity check */
+    XF_CHK_ERR(d, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...put end-of-stream flag */
+    d->state |= XA_SRC_POLY_FLAG_EOS_RECEIVED;
+
+    TRACE(PROCESS, _b("Input-over-condition signalled"));
+
+    return XA_NO_ERROR;
+}
+
+/*******************************************************************************
+ * Memory information API
+ ******************************************************************************/
+
+/* ..get total amount of data for memory tables */
+static XA_ERRORCODE xa_src_poly_get_memtabs_size(XASrcPoly *d, WORD32 i_idx, pVOID pv_value)
+{
+    /* ...basic sanity checks */
+    XF_CHK_ERR(d && pv_value, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...check src component is pre-initialized */
+    XF_CHK_ERR(d->state & XA_SRC_POLY_FLAG_PREINIT_DONE, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...filter state and tables are inside API structure */
+    *(WORD32 *)pv_value = 0;
+
+    return XA_NO_ERROR;
+}
+
+/* ..set memory tables pointer */
+static XA_ERRORCODE xa_src_poly_set_memtabs_ptr(XASrcPoly *d, WORD32 i_idx, pVOID pv_value)
+{
+    /* ...basic sanity checks */
+    XF_CHK_ERR(d && pv_value, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...check src component is pre-initialized */
+    XF_CHK_ERR(d->state & XA_SRC_POLY_FLAG_PREINIT_DONE, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    return XA_NO_ERROR;
+}
+
+/* ...return total amount of memory buffers */
+static XA_ERRORCODE xa_src_poly_get_n_memtabs(XASrcPoly *d, WORD32 i_idx, pVOID pv_value)
+{
+    /* ...basic sanity checks */
+    XF_CHK_ERR(d && pv_value, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...we have 1 input buffer and 1 output buffer, no scratch */
+    *(WORD32 *)pv_value = 2;
+
+    return XA_NO_ERROR;
+}
+
+/* ...return memory buffer data */
+static XA_ERRORCODE xa_src_poly_get_mem_info_size(XASrcPoly *d, WORD32 i_idx, pVOID pv_value)
+{
+    UWORD32     frame;
+
+    /* ...basic sanity check */
+    XF_CHK_ERR(d && pv_value, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...return frame buffer minimal size only after post-initialization is done */
+    XF_CHK_ERR(d->state & XA_SRC_POLY_FLAG_POSTINIT_DONE, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    frame = d->channels * (d->bps == 2 ? 2 : 4);
+
+    switch (i_idx)
+    {
+    case 0:
+        /* ...input chunk */
+        *(WORD32 *)pv_value = d->chunk_size * frame;
+        return XA_NO_ERROR;
+
+    case 1:
+        /* ...resampled chunk */
+        *(WORD32 *)pv_value = d->out_frames_max * frame;
+        return XA_NO_ERROR;
+
+    default:
+        return XA_API_FATAL_INVALID_CMD_TYPE;
+    }
+}
+
+/* ...return memory alignment data */
+static XA_ERRORCODE xa_src_poly_get_mem_info_alignment(XASrcPoly *d, WORD32 i_idx, pVOID pv_value)
+{
+    /* ...basic sanity check */
+    XF_CHK_ERR(d && pv_value, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...return frame buffer minimal size only after post-initialization is done */
+    XF_CHK_ERR(d->state & XA_SRC_POLY_FLAG_POSTINIT_DONE, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...all buffers are 4-bytes aligned */
+    *(WORD32 *)pv_value = 4;
+
+    return XA_NO_ERROR;
+}
+
+/* ...return memory type data */
+static XA_ERRORCODE xa_src_poly_get_mem_info_type(XASrcPoly *d, WORD32 i_idx, pVOID pv_value)
+{
+    /* ...basic sanity check */
+    XF_CHK_ERR(d && pv_value, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...return frame buffer minimal size only after post-initialization is done */
+    XF_CHK_ERR(d->state & XA_SRC_POLY_FLAG_POSTINIT_DONE, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    switch (i_idx)
+    {
+    case 0:
+        /* ...input buffer */
+        *(WORD32 *)pv_value = XA_MEMTYPE_INPUT;
+        return XA_NO_ERROR;
+
+    case 1:
+        /* ...output buffer */
+        *(WORD32 *)pv_value = XA_MEMTYPE_OUTPUT;
+        return XA_NO_ERROR;
+
+    default:
+        /* ...invalid index */
+        return XA_API_FATAL_INVALID_CMD_TYPE;
+    }
+}
+
+/* ...set memory pointer */
+static XA_ERRORCODE xa_src_poly_set_mem_ptr(XASrcPoly *d, WORD32 i_idx, pVOID pv_value)
+{
+    /* ...basic sanity check */
+    XF_CHK_ERR(d && pv_value, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...codec must be initialized */
+    XF_CHK_ERR(d->state & XA_SRC_POLY_FLAG_POSTINIT_DONE, XA_API_FATAL_INVALID_CMD_TYPE);
+
+    /* ...select memory buffer */
+    switch (i_idx)
+    {
+    case 0:
+        /* ...input buffer */
+        d->input = pv_value;
+        return XA_NO_ERROR;
+
+    case 1:
+        /* ...output buffer */
+        d->output = pv_value;
+        return XA_NO_ERROR;
+
+    default:
+        /* ...invalid index */
+        return XA_API_FATAL_INVALID_CMD_TYPE;
+    }
+}
+
+/*******************************************************************************
+ * API command hooks
+ ******************************************************************************/
+
+static XA_ERRORCODE (* const xa_src_poly_api[])(XASrcPoly *, WORD32, pVOID) =
+{
+    [XA_API_CMD_GET_API_SIZE]           = xa_src_poly_get_api_size,
+
+    [XA_API_CMD_INIT]                   = xa_src_poly_init,
+    [XA_API_CMD_SET_CONFIG_PARAM]       = xa_src_poly_set_config_param,
+    [XA_API_CMD_GET_CONFIG_PARAM]       = xa_src_poly_get_config_param,
+
+    [XA_API_CMD_EXECUTE]                = xa_src_poly_execute,
+    [XA_API_CMD_SET_INPUT_BYTES]        = xa_src_poly_set_input_bytes,
+    [XA_API_CMD_GET_OUTPUT_BYTES]       = xa_src_poly_get_output_bytes,
+    [XA_API_CMD_GET_CURIDX_INPUT_BUF]   = xa_src_poly_get_curidx_input_buf,
+    [XA_API_CMD_INPUT_OVER]             = xa_src_poly_input_over,
+
+    [XA_API_CMD_GET_MEMTABS_SIZE]       = xa_src_poly_get_memtabs_size,
+    [XA_API_CMD_SET_MEMTABS_PTR]        = xa_src_poly_set_memtabs_ptr,
+    [XA_API_CMD_GET_N_MEMTABS]          = xa_src_poly_get_n_memtabs,
+    [XA_API_CMD_GET_MEM_INFO_SIZE]      = xa_src_poly_get_mem_info_size,
+    [XA_API_CMD_GET_MEM_INFO_ALIGNMENT] = xa_src_poly_get_mem_info_alignment,
+    [XA_API_CMD_GET_MEM_INFO_TYPE]      = xa_src_poly_get_mem_info_type,
+    [XA_API_CMD_SET_MEM_PTR]            = xa_src_poly_set_mem_ptr,
+};
+
+/* ...total number of commands supported */
+#define XA_SRC_POLY_API_COMMANDS_NUM   (sizeof(xa_src_poly_api) / sizeof(xa_src_poly_api[0]))
+
+/*******************************************************************************
+ * API entry point
+ ******************************************************************************/
+
+XA_ERRORCODE xa_src_poly(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value)
+{
+    XASrcPoly *d = (XASrcPoly *) p_xa_module_obj;
+
+    /* ...check if command index is sane */
+    XF_CHK_ERR(i_cmd < XA_SRC_POLY_API_COMMANDS_NUM, XA_API_FATAL_INVALID_CMD);
+
+    /* ...see if command is defined */
+    XF_CHK_ERR(xa_src_poly_api[i_cmd], XA_API_FATAL_INVALID_CMD);
+
+    /* ...execute requested command */
+    return xa_src_poly_api[i_cmd](d, i_idx, pv_value);
+}
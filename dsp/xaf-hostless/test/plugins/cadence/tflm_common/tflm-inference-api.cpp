@@ -28,18 +28,21 @@
 namespace {}  // namespace
 
 int inference_persistent_byte_size(int kTensorArenaSize) {return 0;};
-int inference_init(void *pPersist, void * pModel, int kTensorArenaSize, void *p_micro_op_resolver) {return 0;};
-int inference_exec_process(void *pIn, int inp_bytes, void *pOut, int *out_bytes, void **output_tensor, void *pPersist) {return 0;};
+int inference_init(void *pPersist, void * pModel, void *pArena, int kTensorArenaSize, int kTensorArenaTailSize, void *p_micro_op_resolver) {return 0;};
+int inference_exec_process(void *pIn, int inp_bytes, void *pOut, int *out_bytes, void **output_tensor, void *pPersist, int *copied_bytes) {return 0;};
 
 #else //PACK_WS_DUMMY
 #include "tensorflow/lite/micro/kernels/micro_ops.h"
 #include "tensorflow/lite/micro/micro_error_reporter.h"
 #include "tensorflow/lite/micro/micro_interpreter.h"
 #include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/micro/simple_memory_allocator.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 #include "tensorflow/lite/version.h"
 #include "tensorflow/lite/c/common.h"
 
+#include <string.h>
+
 #include "tflm-inference-api.h"
 
 namespace {}  // namespace
@@ -50,6 +53,11 @@ typedef struct
     //void *p_micro_op_resolver;
     tflite::MicroInterpreter interpreter;
     int kTensorArenaSize;
+    /* ...arena shared with other components; NULL when the arena is tensor_arena[] below */
+    uint8_t *shared_arena;
+    /* ...bytes at the arena tail holding TFLM persistent allocations (shared arena only) */
+    int kTensorArenaTailUsed;
+    /* ...private arena, or snapshot of the shared arena tail */
     uint8_t tensor_arena[0];
 } xa_inference_state_struct;
 
@@ -59,18 +67,33 @@ int inference_persistent_byte_size(int kTensorArenaSize)
             + sizeof(xa_inference_state_struct);
 }
 
-int inference_init(void *pPersist, void * pModel, int kTensorArenaSize, void *p_micro_op_resolver)
+int inference_init(void *pPersist, void * pModel, void *pArena, int kTensorArenaSize, int kTensorArenaTailSize, void *p_micro_op_resolver)
 {
     xa_inference_state_struct *pState = (xa_inference_state_struct *)pPersist;
     tflite::MicroErrorReporter *error_reporter = new (&pState->error_reporter) tflite::MicroErrorReporter;
+    tflite::SimpleMemoryAllocator *memory_allocator = nullptr;
+    tflite::MicroInterpreter *interpreter;
     const tflite::Model* model;
     model = tflite::GetModel(pModel);
-        
-    // Build an interpreter to run the model with.
-    tflite::MicroInterpreter *interpreter = new (&pState->interpreter) tflite::MicroInterpreter(
-            model, *(tflite::MicroOpResolver *) p_micro_op_resolver, (uint8_t *)pState->tensor_arena, kTensorArenaSize, error_reporter);
 
     pState->kTensorArenaSize = kTensorArenaSize;
+    pState->shared_arena = (uint8_t *)pArena;
+    pState->kTensorArenaTailUsed = 0;
+
+    // Build an interpreter to run the model with.
+    if (pArena == nullptr)
+    {
+        interpreter = new (&pState->interpreter) tflite::MicroInterpreter(
+            model, *(tflite::MicroOpResolver *) p_micro_op_resolver, (uint8_t *)pState->tensor_arena, kTensorArenaSize, error_reporter);
+    }
+    else
+    {
+        // Keep hold of the arena allocator to learn how much of the tail is persistent.
+        memory_allocator = tflite::SimpleMemoryAllocator::Create(error_reporter, (uint8_t *)pArena, kTensorArenaSize);
+        tflite::MicroAllocator *allocator = tflite::MicroAllocator::Create(memory_allocator, error_reporter);
+        interpreter = new (&pState->interpreter) tflite::MicroInterpreter(
+            model, *(tflite::MicroOpResolver *) p_micro_op_resolver, allocator, error_reporter);
+    }
 
     // Allocate memory from the tensor_arena for the model's tensors.
     TfLiteStatus allocate_status = interpreter->AllocateTensors();
@@ -79,29 +102,58 @@ int inference_init(void *pPersist, void * pModel, int kTensorArenaSize, void *p_
         printf("AllocateTensors() failed\n");
         return -1;
     }
+
+    if (memory_allocator != nullptr)
+    {
+        // Everything outliving an Invoke() sits at the arena tail; save it before the arena is reused.
+        int tail_used = (int)memory_allocator->GetTailUsedBytes();
+        if (tail_used > kTensorArenaTailSize)
+        {
+            printf("Tensor arena tail %d bytes exceeds the %d bytes reserved\n", tail_used, kTensorArenaTailSize);
+            return -1;
+        }
+        pState->kTensorArenaTailUsed = tail_used;
+        memcpy(pState->tensor_arena, (uint8_t *)pArena + kTensorArenaSize - tail_used, tail_used);
+    }
     return 0;
 }
 
-int  inference_exec_process(void *pIn, int inp_bytes, void *pOut, int *out_bytes, void **output_tensor, void *pPersist)
+int  inference_exec_process(void *pIn, int inp_bytes, void *pOut, int *out_bytes, void **output_tensor, void *pPersist, int *copied_bytes)
 {
     /* derive the pointers for instances */
     xa_inference_state_struct *pState = (xa_inference_state_struct *)pPersist;
     tflite::MicroInterpreter* interpreter= &pState->interpreter;
 
     TfLiteTensor* tensor = nullptr;
-    uint8_t* tensor_data = nullptr;
-    uint8_t *buffer = nullptr;
+    int nbytes;
+
+    uint8_t *tail = nullptr;
+
+    *copied_bytes = 0;
+
+    // Bring back the persistent tail of a shared arena; another component may have used it since.
+    // The input tensor itself lives in the tail, so it is looked up only after the restore.
+    if (pState->shared_arena != nullptr)
+    {
+        tail = pState->shared_arena + pState->kTensorArenaSize - pState->kTensorArenaTailUsed;
+        memcpy(tail, pState->tensor_arena, pState->kTensorArenaTailUsed);
+        *copied_bytes += pState->kTensorArenaTailUsed;
+    }
 
     tensor = interpreter->input(0);
-    tensor_data = tensor->data.uint8;
-    buffer = (uint8_t *)pIn;
 
-    // Copy feature buffer to input tensor
-    for (int i = 0; i < inp_bytes; i++) 
+    // Input must fit the input tensor; never run the model on a truncated frame
+    if (inp_bytes > (int)tensor->bytes)
     {
-        tensor_data[i] = buffer[i];
+        printf("Input of %d bytes exceeds input tensor of %d bytes\n", inp_bytes, (int)tensor->bytes);
+        return kTfLiteError;
     }
 
+    // Copy feature buffer to input tensor
+    nbytes = inp_bytes;
+    memcpy(tensor->data.uint8, pIn, nbytes);
+    *copied_bytes += nbytes;
+
     // Run the model on the spectrogram input and make sure it succeeds.
     TfLiteStatus invoke_status = interpreter->Invoke();
     if (invoke_status != kTfLiteOk) 
@@ -114,15 +166,21 @@ int  inference_exec_process(void *pIn, int inp_bytes, void *pOut, int *out_bytes
     *output_tensor = (void *) interpreter->output(0);
 
     tensor = interpreter->output(0);
-    tensor_data = tensor->data.uint8;
-    buffer = (uint8_t *)pOut;
     *out_bytes = tensor->bytes;
-    int nbytes = tensor->bytes;
 
-    // Copy output tensor data to output buffer
-    for (int i = 0; i < nbytes; i++) 
+    // Copy output tensor data to output buffer; with no buffer the tensor is consumed in place
+    if (pOut != nullptr)
+    {
+        nbytes = tensor->bytes;
+        memcpy(pOut, tensor->data.uint8, nbytes);
+        *copied_bytes += nbytes;
+    }
+
+    // Variable tensors in the tail may have been updated by Invoke(); keep the snapshot current
+    if (tail != nullptr)
     {
-        buffer[i] = tensor_data[i];
+        memcpy(pState->tensor_arena, tail, pState->kTensorArenaTailUsed);
+        *copied_bytes += pState->kTensorArenaTailUsed;
     }
 
     return kTfLiteOk;
@@ -101,8 +101,8 @@ typedef enum {
 #endif
 
 int  inference_persistent_byte_size(int kTensorArenaSize);
-int  inference_init(void *pPersist, void * pModel, int kTensorArenaSize, void *op_resolver);
-int  inference_exec_process(void *pIn, int inp_bytes, void *pOut, int *out_bytes, void **output_tensor, void *pPersist);
+int  inference_init(void *pPersist, void * pModel, void *pArena, int kTensorArenaSize, int kTensorArenaTailSize, void *op_resolver);
+int  inference_exec_process(void *pIn, int inp_bytes, void *pOut, int *out_bytes, void **output_tensor, void *pPersist, int *copied_bytes);
 #if 0
 int op_resolver_add_operator(void *pPersist, int tflm_operator);
 #endif
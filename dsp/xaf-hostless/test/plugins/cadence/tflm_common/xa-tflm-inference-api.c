@@ -90,6 +90,12 @@ typedef struct XAInference
     /* ...number of produced bytes */
     UWORD32             produced;
 
+    /* ...tensor I/O bytes copied by the last inference */
+    UWORD32             bytes_copied;
+
+    /* ...tensor arena is placed in the worker scratch */
+    UWORD32             shared_arena;
+
     /* ...inference specification */
     xaf_tflm_inference_spec_t inf_spec;
 
@@ -123,6 +129,18 @@ static inline void xa_inference_preinit(XAInference *d)
 }
 
 
+/* ...tensor arena bytes kept in persist; only the arena tail when the arena is shared */
+static inline int xa_inference_arena_persist_size(XAInference *d)
+{
+    return (d->shared_arena ? d->inf_spec.tensor_arena_tail_size : d->inf_spec.tensor_arena_size);
+}
+
+/* ...op resolver follows the inference state in persist */
+static inline void *xa_inference_op_resolver(XAInference *d)
+{
+    return (void *) ((unsigned int) d->persistent + inference_persistent_byte_size(xa_inference_arena_persist_size(d)));
+}
+
 /* ...apply gain to 16-bit PCM stream */
 static XA_ERRORCODE xa_inference_do_execute(XAInference *d)
 {
@@ -141,7 +159,10 @@ static XA_ERRORCODE xa_inference_do_execute(XAInference *d)
     if ( d->input_avail >=  d->inf_spec.input_size)
     {
         void *output_tensor;
-        int ret = inference_exec_process(pIn, d->inf_spec.input_size, pOut, (int *) &d->produced, &output_tensor, d->persistent);
+
+        /* ...with a post-process hook the output tensor is read in place, not copied to the output buffer */
+        int ret = inference_exec_process(pIn, d->inf_spec.input_size, (d->inf_spec.inference_exec_postprocess ? NULL : pOut),
+                                         (int *) &d->produced, &output_tensor, d->persistent, (int *) &d->bytes_copied);
 
         if ( ret != 0 )
         {
@@ -156,8 +177,7 @@ static XA_ERRORCODE xa_inference_do_execute(XAInference *d)
         
         if (d->inf_spec.inference_exec_postprocess)
         {
-            void *p_op_resolver = (void *) ((unsigned int) d->persistent + inference_persistent_byte_size(d->inf_spec.tensor_arena_size));
-            void *addl_persist = (void *) ((unsigned int) p_op_resolver + d->inf_spec.op_resolver_size);
+            void *addl_persist = (void *) ((unsigned int) xa_inference_op_resolver(d) + d->inf_spec.op_resolver_size);
             ret = (d->inf_spec.inference_exec_postprocess)(pOut, output_tensor, (int *) &d->produced, addl_persist);
 
             if ( ret != 0 )
@@ -229,9 +249,14 @@ static XA_ERRORCODE xa_inference_init(XAInference *d, WORD32 i_idx, pVOID pv_val
         /* ...post-configuration initialization (all parameters are set) */
         XF_CHK_ERR(d->state & XA_INFERENCE_FLAG_PREINIT_DONE, XA_API_FATAL_INVALID_CMD_TYPE);
 
+        /* ...a shared arena is time-shared with the other components of the worker */
         d->scratch_size = d->inf_spec.addl_scratch_size;
+        if (d->shared_arena)
+        {
+            d->scratch_size += d->inf_spec.tensor_arena_size;
+        }
         
-        d->persist_size  = inference_persistent_byte_size(d->inf_spec.tensor_arena_size);
+        d->persist_size  = inference_persistent_byte_size(xa_inference_arena_persist_size(d));
         d->persist_size += d->inf_spec.op_resolver_size;
         d->persist_size += d->inf_spec.addl_persist_size;
 
@@ -246,17 +271,17 @@ static XA_ERRORCODE xa_inference_init(XAInference *d, WORD32 i_idx, pVOID pv_val
         /* ...kick run-time initialization process; make sure Micro speech inference component is setup */
         XF_CHK_ERR(d->state & XA_INFERENCE_FLAG_POSTINIT_DONE, XA_API_FATAL_INVALID_CMD_TYPE);
 
-        void *p_op_resolver = (void *) ((unsigned int) d->persistent + inference_persistent_byte_size(d->inf_spec.tensor_arena_size));
-        void *addl_persist = (void *) ((unsigned int) d->persistent 
-                                   + inference_persistent_byte_size(d->inf_spec.tensor_arena_size)
-                                   + d->inf_spec.op_resolver_size);
+        void *p_op_resolver = xa_inference_op_resolver(d);
+        void *addl_persist = (void *) ((unsigned int) p_op_resolver + d->inf_spec.op_resolver_size);
         
         int ret = (d->inf_spec.inference_init_ops)(p_op_resolver, addl_persist);
             
         if ( ret != 0 )
             return XA_FATAL_ERROR;
     
-        ret = inference_init(d->persistent, d->inf_spec.model, d->inf_spec.tensor_arena_size, p_op_resolver);
+        /* ...shared arena starts the scratch; it holds nothing across executions but the saved tail */
+        ret = inference_init(d->persistent, d->inf_spec.model, (d->shared_arena ? d->scratch : NULL),
+                             d->inf_spec.tensor_arena_size, d->inf_spec.tensor_arena_tail_size, p_op_resolver);
     
         if ( ret != 0 )
             return XA_FATAL_ERROR;
@@ -343,7 +368,15 @@ static XA_ERRORCODE xa_inference_set_config_param(XAInference *d, WORD32 i_idx,
         return XA_NO_ERROR;
     }
 
+    case XA_INFERENCE_CONFIG_PARAM_SHARED_ARENA:
+        /* ...memory layout is fixed at post-initialization */
+        XF_CHK_ERR((d->state & XA_INFERENCE_FLAG_POSTINIT_DONE) == 0, XA_INFERENCE_CONFIG_NONFATAL_STATE);
+        XF_CHK_ERR((i_value == 0) || (i_value == 1 && d->inf_spec.tensor_arena_tail_size > 0), XA_INFERENCE_CONFIG_NONFATAL_RANGE);
+        d->shared_arena = (UWORD32)i_value;
+        return XA_NO_ERROR;
+
     case XA_INFERENCE_CONFIG_PARAM_FRAME_SIZE:
+    case XA_INFERENCE_CONFIG_PARAM_BYTES_COPIED:
         return XA_INFERENCE_CONFIG_NONFATAL_READONLY;
 
     default:
@@ -389,6 +422,16 @@ static XA_ERRORCODE xa_inference_get_config_param(XAInference *d, WORD32 i_idx,
         *(WORD32 *)pv_value = d->inf_spec.input_size;
         return XA_NO_ERROR;
 
+    case XA_INFERENCE_CONFIG_PARAM_BYTES_COPIED:
+        /* ...return tensor I/O bytes copied by the last inference */
+        *(WORD32 *)pv_value = d->bytes_copied;
+        return XA_NO_ERROR;
+
+    case XA_INFERENCE_CONFIG_PARAM_SHARED_ARENA:
+        /* ...return tensor arena placement */
+        *(WORD32 *)pv_value = d->shared_arena;
+        return XA_NO_ERROR;
+
     default:
         TRACE(ERROR, _x("Invalid parameter: %X"), i_idx);
         return XA_API_FATAL_INVALID_CMD_TYPE;
@@ -667,7 +710,9 @@ static XA_ERRORCODE xa_inference_set_mem_ptr(XAInference *d, WORD32 i_idx, pVOID
         return XA_NO_ERROR;
 
     case 2:
-        /* ...scratch buffer */
+        /* ...scratch buffer; a shared arena holds the interpreter tensors once it is built, so it cannot move
+         * (e.g. to the scratch of another worker on a priority change) */
+        XF_CHK_ERR(!(d->shared_arena && (d->state & XA_INFERENCE_FLAG_RUNNING)) || d->scratch == pv_value, XA_API_FATAL_INVALID_CMD_TYPE);
         d->scratch = pv_value;
         return XA_NO_ERROR;
 
@@ -40,6 +40,8 @@ enum xa_config_param_inference {
     XA_INFERENCE_CONFIG_PARAM_PCM_WIDTH         = 0x2,
     XA_INFERENCE_CONFIG_PARAM_PRODUCED          = 0x3,
     XA_INFERENCE_CONFIG_PARAM_FRAME_SIZE        = 0x4,
+    XA_INFERENCE_CONFIG_PARAM_BYTES_COPIED      = 0x5,  /* read-only: tensor I/O bytes copied by the last inference */
+    XA_INFERENCE_CONFIG_PARAM_SHARED_ARENA      = 0x6,  /* 1: tensor arena in worker scratch; set with the initial configuration, priority is fixed once running */
     XA_INFERENCE_CONFIG_PARAM_COUNT,
 };
 
@@ -101,6 +103,10 @@ typedef struct xaf_tflm_inference_spec
     /* ...tensor arena size of inference */
     WORD32 tensor_arena_size;
 
+    /* ...upper bound of the arena tail holding TFLM persistent allocations;
+       only this much is kept in persist when the arena is shared (0 - not shareable) */
+    WORD32 tensor_arena_tail_size;
+
     /* ...size of op resolver struct (function of num_operators in inference */
     WORD32 op_resolver_size;
 
@@ -120,7 +126,8 @@ typedef struct xaf_tflm_inference_spec
     /* ...callback function that <TFLM-n/w>-inference-wrapper should (OPTIONAL)
        implement if it requires to post-process the TFLM inference output.
        This function gives access to TfLiteTensor output from Invoke() and 
-       component output buffer to the wrapper */
+       component output buffer to the wrapper. The output tensor is not copied
+       to the output buffer when this callback is set; it is read in place */
     int (*inference_exec_postprocess)(void *, void *, int *, void *);
 
 } xaf_tflm_inference_spec_t;
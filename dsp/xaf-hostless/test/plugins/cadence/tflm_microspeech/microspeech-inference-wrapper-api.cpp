@@ -70,6 +70,7 @@ int  microspeech_inference_exec_postprocess(void *output_buffer, void *output_te
 
 
 #define TENSOR_ARENA_SIZE                    (15*1024)
+#define TENSOR_ARENA_TAIL_SIZE               (4*1024)
 #define NUM_OPS                              (4)
 #define INPUT_FRAMESIZE_kFeatureElementCount (49*40)
 #define CONSUMED_kFeatureSliceSize           (40)
@@ -86,6 +87,7 @@ static tflite::MicroErrorReporter microspeech_local_error_reporter;
     inference_spec.input_size        = INPUT_FRAMESIZE_kFeatureElementCount; \
     inference_spec.output_size       = PRODUCED_INFERENCE; \
     inference_spec.tensor_arena_size = TENSOR_ARENA_SIZE; \
+    inference_spec.tensor_arena_tail_size = TENSOR_ARENA_TAIL_SIZE; \
     inference_spec.op_resolver_size  = sizeof(tflite::MicroMutableOpResolver<NUM_OPS>); \
     inference_spec.input_stride      = CONSUMED_kFeatureSliceSize; \
     inference_spec.model             = (void *) g_model; \
@@ -64,6 +64,7 @@ XA_ERRORCODE xa_person_detect_inference(xa_codec_handle_t p_xa_module_obj, WORD3
 #else //PACK_WS_DUMMY
 
 #define TENSOR_ARENA_SIZE                   (136*1024)
+#define TENSOR_ARENA_TAIL_SIZE              (48*1024)
 #define NUM_OPS                             (5)
 #define INPUT_FRAMESIZE_kMaxImageSize       (96*96*1)
 #define PRODUCED_INFERENCE                  (2)
@@ -75,6 +76,7 @@ XA_ERRORCODE xa_person_detect_inference(xa_codec_handle_t p_xa_module_obj, WORD3
     inference_spec.input_size        = INPUT_FRAMESIZE_kMaxImageSize; \
     inference_spec.output_size       = PRODUCED_INFERENCE; \
     inference_spec.tensor_arena_size = TENSOR_ARENA_SIZE; \
+    inference_spec.tensor_arena_tail_size = TENSOR_ARENA_TAIL_SIZE; \
     inference_spec.op_resolver_size  = sizeof(tflite::MicroMutableOpResolver<NUM_OPS>); \
     inference_spec.input_stride      = INPUT_FRAMESIZE_kMaxImageSize; \
     inference_spec.model             = (void *) g_person_detect_model_data; \
@@ -75,12 +75,15 @@ extern XA_ERRORCODE xa_pcm_gain(xa_codec_handle_t, WORD32, WORD32, pVOID);
 extern XA_ERRORCODE xa_mp3_encoder(xa_codec_handle_t, WORD32, WORD32, pVOID);
 extern XA_ERRORCODE xa_amr_wb_decoder(xa_codec_handle_t, WORD32, WORD32, pVOID);
 extern XA_ERRORCODE xa_src_pp_fx(xa_codec_handle_t, WORD32, WORD32, pVOID);
+extern XA_ERRORCODE xa_src_poly(xa_codec_handle_t, WORD32, WORD32, pVOID);
 extern XA_ERRORCODE xa_renderer(xa_codec_handle_t , WORD32 , WORD32 , pVOID);
 extern XA_ERRORCODE xa_capturer(xa_codec_handle_t , WORD32 , WORD32 , pVOID);
 extern XA_ERRORCODE xa_vorbis_decoder(xa_codec_handle_t, WORD32, WORD32, pVOID);
 extern XA_ERRORCODE xa_dummy_aec22(xa_codec_handle_t, WORD32, WORD32, pVOID);
 extern XA_ERRORCODE xa_dummy_aec23(xa_codec_handle_t, WORD32, WORD32, pVOID);
 extern XA_ERRORCODE xa_pcm_split(xa_codec_handle_t, WORD32, WORD32, pVOID);
+extern XA_ERRORCODE xa_pcm_split14(xa_codec_handle_t, WORD32, WORD32, pVOID);
+extern XA_ERRORCODE xa_pcm_split18(xa_codec_handle_t, WORD32, WORD32, pVOID);
 extern XA_ERRORCODE xa_mimo_mix(xa_codec_handle_t, WORD32, WORD32, pVOID);
 extern XA_ERRORCODE xa_opus_encoder(xa_codec_handle_t, WORD32, WORD32, pVOID);
 extern XA_ERRORCODE xa_microspeech_fe(xa_codec_handle_t, WORD32, WORD32, pVOID);
@@ -112,6 +115,8 @@ const char *comp_id[] = {"audio-decoder",
                          "mimo-proc23",
                          "mimo-proc10",
                          "mimo-proc11",
+                         "mimo-proc14",
+                         "mimo-proc18",
             };
 
 /* ...component class id */
@@ -147,6 +152,13 @@ static const xf_component_id_t xf_component_id[] =
 #if XA_SRC_PP_FX
     { "post-proc/src-pp",        xa_audio_codec_factory,     xa_src_pp_fx },
 #endif
+#if XA_SRC_POLY
+    { "post-proc/src-poly",      xa_audio_codec_factory,     xa_src_poly },
+#endif
+#if XA_SRC_POLY && !XA_SRC_PP_FX
+    /* ...src-poly takes the src-pp configuration ids; stand in when src-pp library is not built */
+    { "post-proc/src-pp",        xa_audio_codec_factory,     xa_src_poly },
+#endif
 #if XA_VORBIS_DECODER
     { "audio-decoder/vorbis",       xa_audio_codec_factory,     xa_vorbis_decoder },
 #endif
@@ -158,6 +170,8 @@ static const xf_component_id_t xf_component_id[] =
 #endif
 #if XA_PCM_SPLIT
     { "mimo-proc12/pcm_split",  xa_mimo_proc_factory,       xa_pcm_split },
+    { "mimo-proc14/pcm_split",  xa_mimo_proc_factory,       xa_pcm_split14 },
+    { "mimo-proc18/pcm_split",  xa_mimo_proc_factory,       xa_pcm_split18 },
 #endif
 #if XA_MIMO_MIX
     { "mimo-proc21/mimo_mix",    xa_mimo_proc_factory,       xa_mimo_mix },
@@ -198,6 +212,8 @@ const int xf_io_ports[XAF_MAX_COMPTYPE][2] =
     {2, 3},     /* XAF_MIMO_PROC_23 */
     {1, 0},     /* XAF_MIMO_PROC_10 */
     {1, 1},     /* XAF_MIMO_PROC_11 */
+    {1, 4},     /* XAF_MIMO_PROC_14 */
+    {1, 8},     /* XAF_MIMO_PROC_18 */
 };
 
 /*******************************************************************************
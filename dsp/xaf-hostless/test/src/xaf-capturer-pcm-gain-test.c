@@ -70,6 +70,7 @@ XA_ERRORCODE xa_aac_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pV
 XA_ERRORCODE xa_mixer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
 XA_ERRORCODE xa_mp3_encoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
 XA_ERRORCODE xa_src_pp_fx(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_src_poly(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
 XA_ERRORCODE xa_renderer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
 XA_ERRORCODE xa_amr_wb_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
 XA_ERRORCODE xa_hotword_decoder(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value){return 0;}
@@ -77,6 +78,8 @@ XA_ERRORCODE xa_vorbis_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3,
 XA_ERRORCODE xa_dummy_aec22(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
 XA_ERRORCODE xa_dummy_aec23(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
 XA_ERRORCODE xa_pcm_split(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_pcm_split14(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_pcm_split18(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
 XA_ERRORCODE xa_mimo_mix(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
 XA_ERRORCODE xa_dummy_wwd(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
 XA_ERRORCODE xa_dummy_hbuf(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
@@ -210,6 +213,31 @@ static int capturer_get_config(void *p_comp, xaf_format_t *comp_format)
     return 0;
 }
 
+static int get_comp_latency(void *p_comp, int *latency)
+{
+    int param[8];
+    int ret;
+
+    TST_CHK_PTR(p_comp, "get_comp_latency");
+    TST_CHK_PTR(latency, "get_comp_latency");
+
+    param[0] = XAF_COMP_CONFIG_PARAM_LATENCY_P50;
+    param[2] = XAF_COMP_CONFIG_PARAM_LATENCY_P90;
+    param[4] = XAF_COMP_CONFIG_PARAM_LATENCY_P99;
+    param[6] = XAF_COMP_CONFIG_PARAM_LATENCY_MAX;
+
+    ret = xaf_comp_get_config(p_comp, 4, &param[0]);
+    if(ret < 0)
+        return ret;
+
+    latency[0] = param[1];
+    latency[1] = param[3];
+    latency[2] = param[5];
+    latency[3] = param[7];
+
+    return 0;
+}
+
 void fio_quit()
 {
     return;
@@ -446,6 +474,15 @@ int main_task(int argc, char **argv)
             FIO_PRINTF(stderr,"Local Memory used by Framework, in bytes                 : %8d\n", meminfo[2]);
         }
     }
+
+    {
+        /* capture-to-application latency of the pcm-gain output, in usec */
+        int latency[4];
+        if(get_comp_latency(p_pcm_gain, &latency[0]) == 0)
+        {
+            FIO_PRINTF(stderr,"Capture-to-app latency, in usec : p50 %6d  p90 %6d  p99 %6d  max %6d\n", latency[0], latency[1], latency[2], latency[3]);
+        }
+    }
     /* ...exec done, clean-up */
     TST_CHK_API(xaf_comp_delete(p_pcm_gain), "xaf_comp_delete");
     TST_CHK_API(xaf_comp_delete(p_capturer), "xaf_comp_delete");
@@ -0,0 +1,1162 @@
+/*
+* Copyright (c) 2015-2022 Cadence Design Systems Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to deal in the Software without restriction, including
+* without limitation the rights to use, copy, modify, merge, publish,
+* distribute, sublicense, and/or sell copies of the Software, and to
+* permit persons to whom the Software is furnished to do so, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include "audio/xa-pcm-gain-api.h"
+#if XA_SRC_POLY
+#include "audio/xa-src-poly-api.h"
+#endif
+#if XA_AEC22
+#include "audio/xa-aec22-api.h"
+#endif
+#include "xaf-utils-test.h"
+#include "xaf-fio-test.h"
+
+/* control-path benchmark: latency of pause/resume/delete against graphs of N pcm-gain components,
+ * message rate of streaming N pcm-gain components with and without batched notifications,
+ * streaming N pcm-gain components from a single thread using completion notifications, and
+ * contention of feeder threads streaming and reconfiguring their own pcm-gain component,
+ * cycles per output sample of the polyphase sample-rate converter at each quality level
+ * (checking output length and tone frequency),
+ * and buffering latency against cycles per frame of the aec22 plugin for 1 to 16 ms frames */
+
+#define PRINT_USAGE FIO_PRINTF(stdout, "\nUsage: %s [optional -iterations:N (default %d)]\n\n", argv[0], BENCH_ITERATIONS);
+
+#define BENCH_MAX_COMP          64
+#define BENCH_ITERATIONS        4
+#define BENCH_MSG_RATE_COMP     32
+#define BENCH_MSG_RATE_FRAMES   64
+#define BENCH_MAX_FEEDERS       8
+#define BENCH_FEEDER_FRAMES     64
+#define BENCH_TXN_COMP          8
+#define BENCH_DISPATCHERS       4
+#define BENCH_SRC_FRAMES        64
+#define BENCH_SRC_TONE_HZ       1000
+#define BENCH_SRC_PI            3.14159265358979323846
+#define BENCH_AEC_FRAMES        64
+#define BENCH_AEC_SAMPLE_RATE   16000
+
+/* ...per-component memory is scaled with the number of components in the graph */
+#define AUDIO_FRMWK_BUF_SIZE(n) ((256 << 8) + (n) * (1024 << 4))
+#define AUDIO_COMP_BUF_SIZE(n)  ((1024 << 7) + (n) * (1024 << 5))
+
+//component parameters
+#define PCM_GAIN_SAMPLE_WIDTH   16
+#define PCM_GAIN_NUM_CH         1
+#define PCM_GAIN_IDX_FOR_GAIN   1
+#define PCM_GAIN_SAMPLE_RATE    44100
+#define PCM_GAIN_FRAME_SIZE     1024
+
+unsigned int num_bytes_read, num_bytes_write;
+extern int audio_frmwk_buf_size;
+extern int audio_comp_buf_size;
+double strm_duration;
+
+#ifdef XAF_PROFILE
+    extern long long tot_cycles, frmwk_cycles, fread_cycles, fwrite_cycles;
+    extern long long dsp_comps_cycles, pcm_gain_cycles;
+    extern double dsp_mcps;
+#define BENCH_CLK()             clk_read_start(CLK_SELN_WALL)
+#define BENCH_CLK_DIFF(a, b)    clk_diff((a), (b))
+#else
+#define BENCH_CLK()             0
+#define BENCH_CLK_DIFF(a, b)    0
+#endif
+
+/* Dummy unused functions */
+XA_ERRORCODE xa_mp3_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_aac_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_mixer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_mp3_encoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_src_pp_fx(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+#if !XA_SRC_POLY
+XA_ERRORCODE xa_src_poly(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+#endif
+XA_ERRORCODE xa_renderer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_capturer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_amr_wb_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_hotword_decoder(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value){return 0;}
+XA_ERRORCODE xa_vorbis_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+#if !XA_AEC22
+XA_ERRORCODE xa_dummy_aec22(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+#endif
+XA_ERRORCODE xa_dummy_aec23(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_pcm_split(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_pcm_split14(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_pcm_split18(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_mimo_mix(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_dummy_wwd(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_dummy_hbuf(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_opus_encoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_dummy_wwd_msg(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_dummy_hbuf_msg(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_opus_decoder(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_microspeech_fe(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_microspeech_inference(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_person_detect_inference(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_keyword_detection_inference(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+
+static int pcm_gain_setup(void *p_comp)
+{
+    int param[10];
+
+    param[0] = XA_PCM_GAIN_CONFIG_PARAM_CHANNELS;
+    param[1] = PCM_GAIN_NUM_CH;
+    param[2] = XA_PCM_GAIN_CONFIG_PARAM_SAMPLE_RATE;
+    param[3] = PCM_GAIN_SAMPLE_RATE;
+    param[4] = XA_PCM_GAIN_CONFIG_PARAM_PCM_WIDTH;
+    param[5] = PCM_GAIN_SAMPLE_WIDTH;
+    param[6] = XA_PCM_GAIN_CONFIG_PARAM_FRAME_SIZE;
+    param[7] = PCM_GAIN_FRAME_SIZE;
+    param[8] = XA_PCM_GAIN_CONFIG_PARAM_GAIN_FACTOR;
+    param[9] = PCM_GAIN_IDX_FOR_GAIN;
+
+    return(xaf_comp_set_config(p_comp, 5, &param[0]));
+}
+
+/* ...start a configured component; input buffers are fed (or returned ones re-fed) until its initialization completes */
+static int bench_comp_start(void *p_adev, void *p_comp, void *inbuf[2], int feed)
+{
+    xaf_comp_status status;
+    int info[4];
+    int i;
+
+    TST_CHK_API(xaf_comp_process(p_adev, p_comp, NULL, 0, XAF_START_FLAG), "xaf_comp_process");
+
+    for (i = 0; i < (feed ? 2 : 0); i++)
+    {
+        memset(inbuf[i], 0, PCM_GAIN_FRAME_SIZE);
+        TST_CHK_API(xaf_comp_process(p_adev, p_comp, inbuf[i], PCM_GAIN_FRAME_SIZE, XAF_INPUT_READY_FLAG), "xaf_comp_process");
+    }
+
+    while (1)
+    {
+        TST_CHK_API(xaf_comp_get_status(p_adev, p_comp, &status, &info[0]), "xaf_comp_get_status");
+
+        if (status == XAF_INIT_DONE) break;
+
+        if (status == XAF_NEED_INPUT)
+        {
+            memset((void *)info[0], 0, PCM_GAIN_FRAME_SIZE);
+            TST_CHK_API(xaf_comp_process(p_adev, p_comp, (void *)info[0], PCM_GAIN_FRAME_SIZE, XAF_INPUT_READY_FLAG), "xaf_comp_process");
+        }
+        else
+        {
+            FIO_PRINTF(stderr, "Failed to init, status:%d\n", status);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/* ...create and start a pcm-gain component, feeding silence until its initialization completes */
+static int bench_comp_create(void *p_adev, void **pp_comp, void *inbuf[2])
+{
+    TST_CHK_API_COMP_CREATE(p_adev, pp_comp, "post-proc/pcm_gain", 2, 1, &inbuf[0], XAF_POST_PROC, "xaf_comp_create");
+    TST_CHK_API(pcm_gain_setup(*pp_comp), "pcm_gain_setup");
+
+    return bench_comp_start(p_adev, *pp_comp, inbuf, 1);
+}
+
+static void bench_report(const char *op, int num_comp, int num_ops, long long cycles)
+{
+    FIO_PRINTF(stderr, "%-8s N=%2d : %10lld cycles total, %8lld cycles/op\n", op, num_comp, cycles, (num_ops ? cycles / num_ops : 0));
+}
+
+static int bench_run(int num_comp, int iterations)
+{
+    void *p_adev = NULL;
+    void *p_comp[BENCH_MAX_COMP];
+    void *inbuf[BENCH_MAX_COMP][2];
+    xaf_adev_config_t adev_config;
+    long long t_pause = 0, t_resume = 0, t_delete;
+    long long t0;
+    int i, k;
+
+    TST_CHK_API(xaf_adev_config_default_init(&adev_config), "xaf_adev_config_default_init");
+
+    adev_config.pmem_malloc = mem_malloc;
+    adev_config.pmem_free = mem_free;
+    adev_config.audio_framework_buffer_size = AUDIO_FRMWK_BUF_SIZE(num_comp);
+    adev_config.audio_component_buffer_size = AUDIO_COMP_BUF_SIZE(num_comp);
+    TST_CHK_API(xaf_adev_open(&p_adev, &adev_config), "xaf_adev_open");
+
+    for (i = 0; i < num_comp; i++)
+    {
+        TST_CHK_API(bench_comp_create(p_adev, &p_comp[i], &inbuf[i][0]), "bench_comp_create");
+    }
+
+    /* ...pause/resume round trips on the input port of every component */
+    for (k = 0; k < iterations; k++)
+    {
+        t0 = BENCH_CLK();
+        for (i = 0; i < num_comp; i++)
+        {
+            TST_CHK_API(xaf_pause(p_comp[i], 0), "xaf_pause");
+        }
+        t_pause += BENCH_CLK_DIFF(BENCH_CLK(), t0);
+
+        t0 = BENCH_CLK();
+        for (i = 0; i < num_comp; i++)
+        {
+            TST_CHK_API(xaf_resume(p_comp[i], 0), "xaf_resume");
+        }
+        t_resume += BENCH_CLK_DIFF(BENCH_CLK(), t0);
+    }
+
+    /* ...deletion, latest component first, so that the worker queues still hold traffic of the others */
+    t0 = BENCH_CLK();
+    for (i = num_comp - 1; i >= 0; i--)
+    {
+        TST_CHK_API(xaf_comp_delete(p_comp[i]), "xaf_comp_delete");
+    }
+    t_delete = BENCH_CLK_DIFF(BENCH_CLK(), t0);
+
+    TST_CHK_API(xaf_adev_close(p_adev, XAF_ADEV_NORMAL_CLOSE), "xaf_adev_close");
+
+    bench_report("pause", num_comp, num_comp * iterations, t_pause);
+    bench_report("resume", num_comp, num_comp * iterations, t_resume);
+    bench_report("delete", num_comp, num_comp, t_delete);
+
+    return 0;
+}
+
+/* ...stream format change on N components, deleting and creating them again against in-place reset */
+static int bench_reconfig(int num_comp, int iterations)
+{
+    void *p_adev = NULL;
+    void *p_comp[BENCH_MAX_COMP];
+    void *inbuf[BENCH_MAX_COMP][2];
+    xaf_adev_config_t adev_config;
+    long long t_recreate = 0, t_reset = 0;
+    long long t0;
+    int param[10];
+    int i, k;
+
+    TST_CHK_API(xaf_adev_config_default_init(&adev_config), "xaf_adev_config_default_init");
+
+    adev_config.pmem_malloc = mem_malloc;
+    adev_config.pmem_free = mem_free;
+    adev_config.audio_framework_buffer_size = AUDIO_FRMWK_BUF_SIZE(num_comp);
+    adev_config.audio_component_buffer_size = AUDIO_COMP_BUF_SIZE(num_comp);
+    TST_CHK_API(xaf_adev_open(&p_adev, &adev_config), "xaf_adev_open");
+
+    for (i = 0; i < num_comp; i++)
+    {
+        TST_CHK_API(bench_comp_create(p_adev, &p_comp[i], &inbuf[i][0]), "bench_comp_create");
+    }
+
+    /* ...full teardown: memory, plugin instance and proxy handle are re-created */
+    for (k = 0; k < iterations; k++)
+    {
+        t0 = BENCH_CLK();
+        for (i = 0; i < num_comp; i++)
+        {
+            TST_CHK_API(xaf_comp_delete(p_comp[i]), "xaf_comp_delete");
+            TST_CHK_API(bench_comp_create(p_adev, &p_comp[i], &inbuf[i][0]), "bench_comp_create");
+        }
+        t_recreate += BENCH_CLK_DIFF(BENCH_CLK(), t0);
+    }
+
+    /* ...sample rate toggled in place; frame size is kept, so the buffers still fit */
+    for (k = 0; k < iterations; k++)
+    {
+        /* ...reset restores the plugin defaults; pass the whole configuration */
+        param[0] = XA_PCM_GAIN_CONFIG_PARAM_CHANNELS;
+        param[1] = PCM_GAIN_NUM_CH;
+        param[2] = XA_PCM_GAIN_CONFIG_PARAM_SAMPLE_RATE;
+        param[3] = ((k & 1) ? PCM_GAIN_SAMPLE_RATE : 48000);
+        param[4] = XA_PCM_GAIN_CONFIG_PARAM_PCM_WIDTH;
+        param[5] = PCM_GAIN_SAMPLE_WIDTH;
+        param[6] = XA_PCM_GAIN_CONFIG_PARAM_FRAME_SIZE;
+        param[7] = PCM_GAIN_FRAME_SIZE;
+        param[8] = XA_PCM_GAIN_CONFIG_PARAM_GAIN_FACTOR;
+        param[9] = PCM_GAIN_IDX_FOR_GAIN;
+
+        t0 = BENCH_CLK();
+        for (i = 0; i < num_comp; i++)
+        {
+            TST_CHK_API(xaf_comp_reset(p_comp[i], 5, &param[0]), "xaf_comp_reset");
+            TST_CHK_API(bench_comp_start(p_adev, p_comp[i], &inbuf[i][0], 0), "bench_comp_start");
+        }
+        t_reset += BENCH_CLK_DIFF(BENCH_CLK(), t0);
+    }
+
+    for (i = num_comp - 1; i >= 0; i--)
+    {
+        TST_CHK_API(xaf_comp_delete(p_comp[i]), "xaf_comp_delete");
+    }
+
+    TST_CHK_API(xaf_adev_close(p_adev, XAF_ADEV_NORMAL_CLOSE), "xaf_adev_close");
+
+    bench_report("recreate", num_comp, num_comp * iterations, t_recreate);
+    bench_report("reset", num_comp, num_comp * iterations, t_reset);
+
+    return 0;
+}
+
+/* ...stream frames through N components; in batched mode the input buffers of all components are
+ * submitted with a single DSP notification and responses are coalesced up to one per component */
+static int bench_msg_rate(int num_comp, int frames, int batched)
+{
+    void *p_adev = NULL;
+    void *p_comp[BENCH_MAX_COMP];
+    void *inbuf[BENCH_MAX_COMP][2];
+    void *p_free[BENCH_MAX_COMP];
+    xaf_adev_config_t adev_config;
+    xaf_ipc_stats_t stats;
+    xaf_comp_status status;
+    int info[4];
+    long long t_stream, t0;
+    int i, k;
+
+    TST_CHK_API(xaf_adev_config_default_init(&adev_config), "xaf_adev_config_default_init");
+
+    adev_config.pmem_malloc = mem_malloc;
+    adev_config.pmem_free = mem_free;
+    adev_config.audio_framework_buffer_size = AUDIO_FRMWK_BUF_SIZE(num_comp);
+    adev_config.audio_component_buffer_size = AUDIO_COMP_BUF_SIZE(num_comp);
+    adev_config.resp_coalesce_count = (batched ? num_comp : 1);
+    TST_CHK_API(xaf_adev_open(&p_adev, &adev_config), "xaf_adev_open");
+
+    for (i = 0; i < num_comp; i++)
+    {
+        TST_CHK_API(bench_comp_create(p_adev, &p_comp[i], &inbuf[i][0]), "bench_comp_create");
+        TST_CHK_API(xaf_comp_process(p_adev, p_comp[i], NULL, 0, XAF_EXEC_FLAG), "xaf_comp_process");
+    }
+
+    t0 = BENCH_CLK();
+    for (k = 0; k < frames; k++)
+    {
+        /* ...collect one consumed input buffer from every component */
+        for (i = 0; i < num_comp; i++)
+        {
+            do
+            {
+                TST_CHK_API(xaf_comp_get_status(p_adev, p_comp[i], &status, &info[0]), "xaf_comp_get_status");
+
+                if (status == XAF_OUTPUT_READY)
+                {
+                    TST_CHK_API(xaf_comp_process(p_adev, p_comp[i], (void *)info[0], info[1], XAF_NEED_OUTPUT_FLAG), "xaf_comp_process");
+                }
+                else if (status != XAF_NEED_INPUT)
+                {
+                    FIO_PRINTF(stderr, "Unexpected status:%d\n", status);
+                    return -1;
+                }
+            }
+            while (status != XAF_NEED_INPUT);
+
+            p_free[i] = (void *)info[0];
+        }
+
+        /* ...and hand them all back */
+        if (batched)
+        {
+            TST_CHK_API(xaf_cmd_batch_begin(p_adev), "xaf_cmd_batch_begin");
+        }
+
+        for (i = 0; i < num_comp; i++)
+        {
+            TST_CHK_API(xaf_comp_process(p_adev, p_comp[i], p_free[i], PCM_GAIN_FRAME_SIZE, XAF_INPUT_READY_FLAG), "xaf_comp_process");
+        }
+
+        if (batched)
+        {
+            TST_CHK_API(xaf_cmd_batch_end(p_adev), "xaf_cmd_batch_end");
+        }
+    }
+    t_stream = BENCH_CLK_DIFF(BENCH_CLK(), t0);
+
+    TST_CHK_API(xaf_get_ipc_stats(p_adev, &stats), "xaf_get_ipc_stats");
+
+    for (i = num_comp - 1; i >= 0; i--)
+    {
+        TST_CHK_API(xaf_comp_delete(p_comp[i]), "xaf_comp_delete");
+    }
+
+    TST_CHK_API(xaf_adev_close(p_adev, XAF_ADEV_NORMAL_CLOSE), "xaf_adev_close");
+
+    bench_report((batched ? "batched" : "single"), num_comp, num_comp * frames, t_stream);
+    FIO_PRINTF(stderr, "%-8s N=%2d : commands %u, doorbells %u; responses %u, doorbells %u; waits %u\n", "", num_comp,
+        stats.cmd_count, stats.cmd_doorbells, stats.resp_count, stats.resp_doorbells, stats.resp_waits);
+
+    return 0;
+}
+
+/* ...completion callback, invoked from proxy thread */
+static void bench_completion_cb(void *p_comp, void *cb_data)
+{
+    (*(volatile int *)cb_data)++;
+}
+
+/* ...stream frames through N components from one thread, servicing whichever component completes first;
+ * with blocking xaf_comp_get_status() the same graph needs one application thread per component */
+static int bench_wait_any(int num_comp, int frames)
+{
+    void *p_adev = NULL;
+    void *p_comp[BENCH_MAX_COMP];
+    void *inbuf[BENCH_MAX_COMP][2];
+    void *p_ready;
+    int consumed[BENCH_MAX_COMP];
+    xaf_adev_config_t adev_config;
+    xaf_ipc_stats_t stats;
+    xaf_comp_status status;
+    int info[4];
+    volatile int completions = 0;
+    long long t_stream, t0;
+    int i, done;
+
+    TST_CHK_API(xaf_adev_config_default_init(&adev_config), "xaf_adev_config_default_init");
+
+    adev_config.pmem_malloc = mem_malloc;
+    adev_config.pmem_free = mem_free;
+    adev_config.audio_framework_buffer_size = AUDIO_FRMWK_BUF_SIZE(num_comp);
+    adev_config.audio_component_buffer_size = AUDIO_COMP_BUF_SIZE(num_comp);
+    TST_CHK_API(xaf_adev_open(&p_adev, &adev_config), "xaf_adev_open");
+
+    for (i = 0; i < num_comp; i++)
+    {
+        TST_CHK_API(bench_comp_create(p_adev, &p_comp[i], &inbuf[i][0]), "bench_comp_create");
+        TST_CHK_API(xaf_comp_set_completion_cb(p_comp[i], bench_completion_cb, (void *)&completions), "xaf_comp_set_completion_cb");
+        TST_CHK_API(xaf_comp_process(p_adev, p_comp[i], NULL, 0, XAF_EXEC_FLAG), "xaf_comp_process");
+        consumed[i] = 0;
+    }
+
+    t0 = BENCH_CLK();
+    for (done = 0; done < num_comp; )
+    {
+        TST_CHK_API(xaf_comp_wait_any(p_adev, &p_ready), "xaf_comp_wait_any");
+
+        for (i = 0; p_comp[i] != p_ready; i++);
+
+        /* ...response is already delivered, so this does not block */
+        TST_CHK_API(xaf_comp_get_status(p_adev, p_comp[i], &status, &info[0]), "xaf_comp_get_status");
+
+        if (status == XAF_OUTPUT_READY)
+        {
+            TST_CHK_API(xaf_comp_process(p_adev, p_comp[i], (void *)info[0], info[1], XAF_NEED_OUTPUT_FLAG), "xaf_comp_process");
+        }
+        else if (status == XAF_NEED_INPUT)
+        {
+            if (consumed[i] < frames)
+            {
+                TST_CHK_API(xaf_comp_process(p_adev, p_comp[i], (void *)info[0], PCM_GAIN_FRAME_SIZE, XAF_INPUT_READY_FLAG), "xaf_comp_process");
+
+                done += (++consumed[i] == frames);
+            }
+        }
+        else
+        {
+            FIO_PRINTF(stderr, "Unexpected status:%d\n", status);
+            return -1;
+        }
+    }
+    t_stream = BENCH_CLK_DIFF(BENCH_CLK(), t0);
+
+    TST_CHK_API(xaf_get_ipc_stats(p_adev, &stats), "xaf_get_ipc_stats");
+
+    for (i = num_comp - 1; i >= 0; i--)
+    {
+        TST_CHK_API(xaf_comp_delete(p_comp[i]), "xaf_comp_delete");
+    }
+
+    TST_CHK_API(xaf_adev_close(p_adev, XAF_ADEV_NORMAL_CLOSE), "xaf_adev_close");
+
+    bench_report("wait-any", num_comp, num_comp * frames, t_stream);
+    FIO_PRINTF(stderr, "%-8s N=%2d : app threads 1 (blocking: %d); responses %u, waits %u, callbacks %d\n", "", num_comp,
+        num_comp, stats.resp_count, stats.resp_waits, completions);
+
+    return 0;
+}
+
+typedef struct bench_feeder_s {
+    void   *p_adev;
+    void   *p_comp;
+    int     frames;
+    int     error;
+} bench_feeder_t;
+
+/* ...stream frames through one component, updating its gain with every frame */
+static int bench_feeder(bench_feeder_t *feeder)
+{
+    void *p_adev = feeder->p_adev;
+    void *p_comp = feeder->p_comp;
+    xaf_comp_status status;
+    int info[4];
+    int param[2];
+    int k;
+
+    TST_CHK_API(xaf_comp_process(p_adev, p_comp, NULL, 0, XAF_EXEC_FLAG), "xaf_comp_process");
+
+    for (k = 0; k < feeder->frames; k++)
+    {
+        do
+        {
+            TST_CHK_API(xaf_comp_get_status(p_adev, p_comp, &status, &info[0]), "xaf_comp_get_status");
+
+            if (status == XAF_OUTPUT_READY)
+            {
+                TST_CHK_API(xaf_comp_process(p_adev, p_comp, (void *)info[0], info[1], XAF_NEED_OUTPUT_FLAG), "xaf_comp_process");
+            }
+            else if (status != XAF_NEED_INPUT)
+            {
+                FIO_PRINTF(stderr, "Unexpected status:%d\n", status);
+                return -1;
+            }
+        }
+        while (status != XAF_NEED_INPUT);
+
+        TST_CHK_API(xaf_comp_process(p_adev, p_comp, (void *)info[0], PCM_GAIN_FRAME_SIZE, XAF_INPUT_READY_FLAG), "xaf_comp_process");
+
+        /* ...config traffic takes auxiliary buffers from the pool shared by all components */
+        param[0] = XA_PCM_GAIN_CONFIG_PARAM_GAIN_FACTOR;
+        param[1] = (k & 1) ? PCM_GAIN_IDX_FOR_GAIN : 0;
+        TST_CHK_API(xaf_comp_set_config(p_comp, 1, &param[0]), "xaf_comp_set_config");
+    }
+
+    return 0;
+}
+
+static void *bench_feeder_entry(void *arg)
+{
+    bench_feeder_t *feeder = (bench_feeder_t *)arg;
+
+    feeder->error = bench_feeder(feeder);
+
+    return NULL;
+}
+
+/* ...N feeder threads, each streaming and reconfiguring its own component; responses are
+ * delivered either on the proxy thread or by the given number of dispatcher threads */
+static int bench_feeders(int num_threads, int frames, int dispatch)
+{
+    void *p_adev = NULL;
+    void *p_comp[BENCH_MAX_FEEDERS];
+    void *inbuf[BENCH_MAX_FEEDERS][2];
+    xf_thread_t thread[BENCH_MAX_FEEDERS];
+    bench_feeder_t feeder[BENCH_MAX_FEEDERS];
+    static unsigned char stack[BENCH_MAX_FEEDERS][STACK_SIZE];
+    xaf_adev_config_t adev_config;
+    long long t_feed, t0;
+    int i, error = 0;
+
+    TST_CHK_API(xaf_adev_config_default_init(&adev_config), "xaf_adev_config_default_init");
+
+    adev_config.pmem_malloc = mem_malloc;
+    adev_config.pmem_free = mem_free;
+    adev_config.audio_framework_buffer_size = AUDIO_FRMWK_BUF_SIZE(num_threads);
+    adev_config.audio_component_buffer_size = AUDIO_COMP_BUF_SIZE(num_threads);
+    adev_config.proxy_dispatch_threads = dispatch;
+    TST_CHK_API(xaf_adev_open(&p_adev, &adev_config), "xaf_adev_open");
+
+    for (i = 0; i < num_threads; i++)
+    {
+        TST_CHK_API(bench_comp_create(p_adev, &p_comp[i], &inbuf[i][0]), "bench_comp_create");
+
+        feeder[i].p_adev = p_adev;
+        feeder[i].p_comp = p_comp[i];
+        feeder[i].frames = frames;
+        feeder[i].error = 0;
+    }
+
+    t0 = BENCH_CLK();
+    for (i = 0; i < num_threads; i++)
+    {
+        __xf_thread_create(&thread[i], bench_feeder_entry, &feeder[i], "Feeder Thread", stack[i], STACK_SIZE, XAF_APP_THREADS_PRIORITY);
+    }
+
+    for (i = 0; i < num_threads; i++)
+    {
+        __xf_thread_join(&thread[i], NULL);
+        __xf_thread_destroy(&thread[i]);
+
+        error |= feeder[i].error;
+    }
+    t_feed = BENCH_CLK_DIFF(BENCH_CLK(), t0);
+
+    TST_CHK_API(error, "bench_feeder");
+
+    for (i = num_threads - 1; i >= 0; i--)
+    {
+        TST_CHK_API(xaf_comp_delete(p_comp[i]), "xaf_comp_delete");
+    }
+
+    TST_CHK_API(xaf_adev_close(p_adev, XAF_ADEV_NORMAL_CLOSE), "xaf_adev_close");
+
+    bench_report((dispatch ? "dispatch" : "feeders"), num_threads, num_threads * frames, t_feed);
+
+    return 0;
+}
+
+/* ...reconfigure N components: gain update, pause and resume of the input port, either call by call
+ * or recorded into transactions of up to BENCH_TXN_COMP components each */
+static int bench_graph_setup(int num_comp, int iterations, int txn)
+{
+    void *p_adev = NULL;
+    void *p_comp[BENCH_MAX_COMP];
+    void *inbuf[BENCH_MAX_COMP][2];
+    void *p_txn;
+    xaf_adev_config_t adev_config;
+    xaf_ipc_stats_t stats[2];
+    long long t_setup = 0;
+    long long t0;
+    int param[2];
+    int i, j, k;
+
+    TST_CHK_API(xaf_adev_config_default_init(&adev_config), "xaf_adev_config_default_init");
+
+    adev_config.pmem_malloc = mem_malloc;
+    adev_config.pmem_free = mem_free;
+    adev_config.audio_framework_buffer_size = AUDIO_FRMWK_BUF_SIZE(num_comp);
+    adev_config.audio_component_buffer_size = AUDIO_COMP_BUF_SIZE(num_comp);
+    TST_CHK_API(xaf_adev_open(&p_adev, &adev_config), "xaf_adev_open");
+
+    for (i = 0; i < num_comp; i++)
+    {
+        TST_CHK_API(bench_comp_create(p_adev, &p_comp[i], &inbuf[i][0]), "bench_comp_create");
+    }
+
+    param[0] = XA_PCM_GAIN_CONFIG_PARAM_GAIN_FACTOR;
+
+    TST_CHK_API(xaf_get_ipc_stats(p_adev, &stats[0]), "xaf_get_ipc_stats");
+
+    for (k = 0; k < iterations; k++)
+    {
+        param[1] = (k & 1) ? PCM_GAIN_IDX_FOR_GAIN : 0;
+
+        t0 = BENCH_CLK();
+        if (txn)
+        {
+            for (i = 0; i < num_comp; i += BENCH_TXN_COMP)
+            {
+                TST_CHK_API(xaf_txn_begin(p_adev, &p_txn), "xaf_txn_begin");
+
+                for (j = i; j < i + BENCH_TXN_COMP && j < num_comp; j++)
+                {
+                    TST_CHK_API(xaf_txn_set_config(p_txn, p_comp[j], 1, &param[0]), "xaf_txn_set_config");
+                    TST_CHK_API(xaf_txn_pause(p_txn, p_comp[j], 0), "xaf_txn_pause");
+                    TST_CHK_API(xaf_txn_resume(p_txn, p_comp[j], 0), "xaf_txn_resume");
+                }
+
+                TST_CHK_API(xaf_txn_commit(p_txn, NULL), "xaf_txn_commit");
+            }
+        }
+        else
+        {
+            for (i = 0; i < num_comp; i++)
+            {
+                TST_CHK_API(xaf_comp_set_config(p_comp[i], 1, &param[0]), "xaf_comp_set_config");
+                TST_CHK_API(xaf_pause(p_comp[i], 0), "xaf_pause");
+                TST_CHK_API(xaf_resume(p_comp[i], 0), "xaf_resume");
+            }
+        }
+        t_setup += BENCH_CLK_DIFF(BENCH_CLK(), t0);
+    }
+
+    TST_CHK_API(xaf_get_ipc_stats(p_adev, &stats[1]), "xaf_get_ipc_stats");
+
+    for (i = num_comp - 1; i >= 0; i--)
+    {
+        TST_CHK_API(xaf_comp_delete(p_comp[i]), "xaf_comp_delete");
+    }
+
+    TST_CHK_API(xaf_adev_close(p_adev, XAF_ADEV_NORMAL_CLOSE), "xaf_adev_close");
+
+    bench_report((txn ? "txn" : "calls"), num_comp, num_comp * 3 * iterations, t_setup);
+    FIO_PRINTF(stderr, "%-8s N=%2d : %u commands, %u doorbells\n", (txn ? "txn" : "calls"), num_comp,
+        stats[1].cmd_count - stats[0].cmd_count, stats[1].cmd_doorbells - stats[0].cmd_doorbells);
+
+    return 0;
+}
+
+/* ...initialization input of the graph chain head: silence */
+static WORD32 bench_graph_input(pVOID cb_data, WORD32 comp_idx, pVOID p_buf, UWORD32 buf_size)
+{
+    memset(p_buf, 0, PCM_GAIN_FRAME_SIZE);
+
+    return PCM_GAIN_FRAME_SIZE;
+}
+
+/* ...bring up a chain of N components, either call by call or from a graph description */
+static int bench_graph_chain(int num_comp, int graph)
+{
+    void *p_adev = NULL;
+    void *p_comp[BENCH_MAX_COMP];
+    void *inbuf[2];
+    xaf_adev_config_t adev_config;
+    xaf_graph_comp_t gcomp[BENCH_MAX_COMP];
+    xaf_graph_conn_t gconn[BENCH_MAX_COMP];
+    xaf_graph_t desc;
+    void *p_txn;
+    xaf_comp_status status;
+    long long t_create;
+    long long t0;
+    int param[10];
+    int info[4];
+    WORD32 mem[2][5];
+    int i;
+
+    TST_CHK_API(xaf_adev_config_default_init(&adev_config), "xaf_adev_config_default_init");
+
+    adev_config.pmem_malloc = mem_malloc;
+    adev_config.pmem_free = mem_free;
+    adev_config.audio_framework_buffer_size = AUDIO_FRMWK_BUF_SIZE(num_comp);
+    adev_config.audio_component_buffer_size = AUDIO_COMP_BUF_SIZE(num_comp);
+    TST_CHK_API(xaf_adev_open(&p_adev, &adev_config), "xaf_adev_open");
+
+    if (graph)
+    {
+        param[0] = XA_PCM_GAIN_CONFIG_PARAM_CHANNELS;
+        param[1] = PCM_GAIN_NUM_CH;
+        param[2] = XA_PCM_GAIN_CONFIG_PARAM_SAMPLE_RATE;
+        param[3] = PCM_GAIN_SAMPLE_RATE;
+        param[4] = XA_PCM_GAIN_CONFIG_PARAM_PCM_WIDTH;
+        param[5] = PCM_GAIN_SAMPLE_WIDTH;
+        param[6] = XA_PCM_GAIN_CONFIG_PARAM_FRAME_SIZE;
+        param[7] = PCM_GAIN_FRAME_SIZE;
+        param[8] = XA_PCM_GAIN_CONFIG_PARAM_GAIN_FACTOR;
+        param[9] = PCM_GAIN_IDX_FOR_GAIN;
+
+        memset(gcomp, 0, sizeof(gcomp));
+        memset(gconn, 0, sizeof(gconn));
+
+        for (i = 0; i < num_comp; i++)
+        {
+            TST_CHK_API(xaf_comp_config_default_init(&gcomp[i].config), "xaf_comp_config_default_init");
+            gcomp[i].config.comp_id = "post-proc/pcm_gain";
+            gcomp[i].config.comp_type = XAF_POST_PROC;
+            gcomp[i].config.num_input_buffers = (i == 0 ? 2 : 0);
+            gcomp[i].config.num_output_buffers = (i == 0 || i == num_comp - 1);
+            gcomp[i].config.pp_inbuf = (pVOID (*)[XAF_MAX_INBUFS])&inbuf[0];
+            gcomp[i].num_param = 5;
+            gcomp[i].p_param = &param[0];
+            gcomp[i].priority = XAF_GRAPH_PRIORITY_DEFAULT;
+            gcomp[i].init_input_cb = bench_graph_input;
+
+            if (i > 0)
+            {
+                gconn[i - 1].src = i - 1;
+                gconn[i - 1].src_out_port = 1;
+                gconn[i - 1].dest = i;
+                gconn[i - 1].dest_in_port = 0;
+                gconn[i - 1].num_buf = 0;
+            }
+        }
+
+        desc.num_comp = num_comp;
+        desc.comp = &gcomp[0];
+        desc.num_conn = num_comp - 1;
+        desc.conn = &gconn[0];
+
+        t0 = BENCH_CLK();
+        TST_CHK_API(xaf_graph_create(p_adev, &desc, p_comp), "xaf_graph_create");
+        t_create = BENCH_CLK_DIFF(BENCH_CLK(), t0);
+
+        TST_CHK_API(xaf_graph_delete(&desc, p_comp), "xaf_graph_delete");
+
+        /* ...route buffers of the last link do not fit, failing after all other links are made;
+         * rollback must leave the memory in use as it was */
+        TST_CHK_API(xaf_get_mem_stats(p_adev, &mem[0][0]), "xaf_get_mem_stats");
+
+        gconn[num_comp - 2].num_buf = 1024;
+
+        if (xaf_graph_create(p_adev, &desc, p_comp) == XAF_NO_ERR)
+        {
+            FIO_PRINTF(stderr, "Graph creation did not fail\n");
+            return -1;
+        }
+
+        gconn[num_comp - 2].num_buf = 0;
+
+        TST_CHK_API(xaf_get_mem_stats(p_adev, &mem[1][0]), "xaf_get_mem_stats");
+
+        /* ...current local and shared memory in use */
+        if (mem[1][3] != mem[0][3] || mem[1][4] != mem[0][4])
+        {
+            FIO_PRINTF(stderr, "Graph rollback leaked memory: local %d -> %d, shared %d -> %d\n", mem[0][3], mem[1][3], mem[0][4], mem[1][4]);
+            return -1;
+        }
+    }
+    else
+    {
+        t0 = BENCH_CLK();
+        TST_CHK_API(bench_comp_create(p_adev, &p_comp[0], &inbuf[0]), "bench_comp_create");
+
+        for (i = 1; i < num_comp; i++)
+        {
+            TST_CHK_API_COMP_CREATE(p_adev, &p_comp[i], "post-proc/pcm_gain", 0, (i == num_comp - 1), NULL, XAF_POST_PROC, "xaf_comp_create");
+            TST_CHK_API(pcm_gain_setup(p_comp[i]), "pcm_gain_setup");
+            TST_CHK_API(xaf_connect(p_comp[i - 1], 1, p_comp[i], 0, XAF_GRAPH_CONN_BUFS), "xaf_connect");
+            TST_CHK_API(xaf_comp_process(p_adev, p_comp[i], NULL, 0, XAF_START_FLAG), "xaf_comp_process");
+            TST_CHK_API(xaf_comp_get_status(p_adev, p_comp[i], &status, &info[0]), "xaf_comp_get_status");
+
+            if (status != XAF_INIT_DONE)
+            {
+                FIO_PRINTF(stderr, "Failed to init, status:%d\n", status);
+                return -1;
+            }
+        }
+        t_create = BENCH_CLK_DIFF(BENCH_CLK(), t0);
+
+        /* ...a port pair connected twice in one transaction is rejected before it reaches the DSP */
+        TST_CHK_API(xaf_disconnect(p_comp[num_comp - 2], 1, p_comp[num_comp - 1], 0), "xaf_disconnect");
+        TST_CHK_API(xaf_txn_begin(p_adev, &p_txn), "xaf_txn_begin");
+        TST_CHK_API(xaf_txn_connect(p_txn, p_comp[num_comp - 2], 1, p_comp[num_comp - 1], 0, XAF_GRAPH_CONN_BUFS), "xaf_txn_connect");
+
+        if (xaf_txn_connect(p_txn, p_comp[num_comp - 2], 1, p_comp[num_comp - 1], 0, XAF_GRAPH_CONN_BUFS) != XAF_ROUTING_ERR)
+        {
+            FIO_PRINTF(stderr, "Duplicate connect was not rejected\n");
+            return -1;
+        }
+
+        TST_CHK_API(xaf_txn_commit(p_txn, NULL), "xaf_txn_commit");
+
+        for (i = num_comp - 1; i >= 0; i--)
+        {
+            TST_CHK_API(xaf_comp_delete(p_comp[i]), "xaf_comp_delete");
+        }
+    }
+
+    TST_CHK_API(xaf_adev_close(p_adev, XAF_ADEV_NORMAL_CLOSE), "xaf_adev_close");
+
+    bench_report((graph ? "graph" : "manual"), num_comp, num_comp, t_create);
+
+    return 0;
+}
+
+#if XA_SRC_POLY
+/* ...cosine by Taylor series for |x| <= pi; keeps the test free of libm */
+static double bench_cos(double x)
+{
+    double x2 = x * x, t = 1, s = 1;
+    int k;
+
+    for (k = 2; k <= 28; k += 2)
+    {
+        t *= -x2 / (double)((k - 1) * k);
+        s += t;
+    }
+
+    return s;
+}
+
+/* ...drive the resampler API directly; kernel cost only, no framework overhead;
+ * a stereo tone is converted and the output length and tone frequency are checked */
+static int bench_src(int in_fs, int out_fs, int quality, int frames)
+{
+    static const char *name[XA_SRC_POLY_QUALITY_NUM] = {"src-low", "src-med", "src-high"};
+    static const int base_taps[XA_SRC_POLY_QUALITY_NUM] = {8, 16, 32};
+    long long taps = XA_SRC_POLY_TAPS(base_taps[quality], in_fs, out_fs);
+    void *p_adev = NULL;
+    xa_codec_handle_t p_src;
+    void *inbuf, *outbuf;
+    WORD32 size, in_size, out_size, produced, value;
+    long long t_exec = 0, out_samples = 0;
+    long long t0, expected, pos = 0, first = -1, last = -1;
+    double phase = 0, step = 2 * BENCH_SRC_PI * BENCH_SRC_TONE_HZ / in_fs, freq;
+    int i, j, cycles = 0, prev = 0;
+
+    TST_CHK_API(xa_src_poly(NULL, XA_API_CMD_GET_API_SIZE, 0, &size), "xa_src_poly");
+    TST_CHK_PTR((p_src = malloc(size)), "malloc");
+    TST_CHK_API(xa_src_poly(p_src, XA_API_CMD_INIT, XA_CMD_TYPE_INIT_API_PRE_CONFIG_PARAMS, NULL), "xa_src_poly");
+
+    value = in_fs;
+    TST_CHK_API(xa_src_poly(p_src, XA_API_CMD_SET_CONFIG_PARAM, XA_SRC_POLY_CONFIG_PARAM_INPUT_SAMPLE_RATE, &value), "xa_src_poly");
+    value = out_fs;
+    TST_CHK_API(xa_src_poly(p_src, XA_API_CMD_SET_CONFIG_PARAM, XA_SRC_POLY_CONFIG_PARAM_OUTPUT_SAMPLE_RATE, &value), "xa_src_poly");
+    value = 2;
+    TST_CHK_API(xa_src_poly(p_src, XA_API_CMD_SET_CONFIG_PARAM, XA_SRC_POLY_CONFIG_PARAM_INPUT_CHANNELS, &value), "xa_src_poly");
+    value = 2;
+    TST_CHK_API(xa_src_poly(p_src, XA_API_CMD_SET_CONFIG_PARAM, XA_SRC_POLY_CONFIG_PARAM_BYTES_PER_SAMPLE, &value), "xa_src_poly");
+    value = PCM_GAIN_FRAME_SIZE;
+    TST_CHK_API(xa_src_poly(p_src, XA_API_CMD_SET_CONFIG_PARAM, XA_SRC_POLY_CONFIG_PARAM_INPUT_CHUNK_SIZE, &value), "xa_src_poly");
+    value = quality;
+    TST_CHK_API(xa_src_poly(p_src, XA_API_CMD_SET_CONFIG_PARAM, XA_SRC_POLY_CONFIG_PARAM_QUALITY, &value), "xa_src_poly");
+
+    TST_CHK_API(xa_src_poly(p_src, XA_API_CMD_INIT, XA_CMD_TYPE_INIT_API_POST_CONFIG_PARAMS, NULL), "xa_src_poly");
+    TST_CHK_API(xa_src_poly(p_src, XA_API_CMD_GET_MEM_INFO_SIZE, 0, &in_size), "xa_src_poly");
+    TST_CHK_API(xa_src_poly(p_src, XA_API_CMD_GET_MEM_INFO_SIZE, 1, &out_size), "xa_src_poly");
+    TST_CHK_PTR((inbuf = malloc(in_size)), "malloc");
+    TST_CHK_PTR((outbuf = malloc(out_size)), "malloc");
+    TST_CHK_API(xa_src_poly(p_src, XA_API_CMD_SET_MEM_PTR, 0, inbuf), "xa_src_poly");
+    TST_CHK_API(xa_src_poly(p_src, XA_API_CMD_SET_MEM_PTR, 1, outbuf), "xa_src_poly");
+    TST_CHK_API(xa_src_poly(p_src, XA_API_CMD_INIT, XA_CMD_TYPE_INIT_PROCESS, NULL), "xa_src_poly");
+
+    for (i = 0; i < frames; i++)
+    {
+        /* ...continuous-phase tone, same on both channels */
+        for (j = 0; j < in_size / 4; j++)
+        {
+            ((WORD16 *)inbuf)[2 * j] = ((WORD16 *)inbuf)[2 * j + 1] = (WORD16)(16384 * bench_cos(phase));
+            if ((phase += step) > BENCH_SRC_PI)
+                phase -= 2 * BENCH_SRC_PI;
+        }
+
+        TST_CHK_API(xa_src_poly(p_src, XA_API_CMD_SET_INPUT_BYTES, 0, &in_size), "xa_src_poly");
+
+        t0 = BENCH_CLK();
+        TST_CHK_API(xa_src_poly(p_src, XA_API_CMD_EXECUTE, XA_CMD_TYPE_DO_EXECUTE, NULL), "xa_src_poly");
+        t_exec += BENCH_CLK_DIFF(BENCH_CLK(), t0);
+
+        TST_CHK_API(xa_src_poly(p_src, XA_API_CMD_GET_OUTPUT_BYTES, 1, &produced), "xa_src_poly");
+        TST_CHK_API(xa_src_poly(p_src, XA_API_CMD_GET_CURIDX_INPUT_BUF, 0, &value), "xa_src_poly");
+        out_samples += produced / 2;
+
+        /* ...rising zero crossings of the left channel, past the filter start-up */
+        for (j = 0; j < produced / 4; j++, pos++)
+        {
+            int v = ((WORD16 *)outbuf)[2 * j];
+
+            if (pos >= taps * out_fs / in_fs && prev < 0 && v >= 0)
+            {
+                if (first < 0)
+                    first = pos;
+                last = pos;
+                cycles++;
+            }
+            prev = v;
+        }
+    }
+
+    /* ...output length follows the rate ratio, short by at most the filter delay */
+    expected = (long long)frames * (in_size / 4) * out_fs / in_fs;
+    freq = (cycles > 1 ? (double)(cycles - 1) * out_fs / (last - first) : 0);
+
+    FIO_PRINTF(stderr, "%-8s %6d -> %6d : %10lld cycles total, %8lld cycles/sample, %lld/%lld frames, tone %.1f Hz\n", name[quality], in_fs, out_fs, t_exec, (out_samples ? t_exec / out_samples : 0), out_samples / 2, expected, freq);
+
+    free(outbuf);
+    free(inbuf);
+    free(p_src);
+
+    if (out_samples / 2 > expected + 1 || out_samples / 2 < expected - taps * out_fs / in_fs - 1)
+    {
+        FIO_PRINTF(stderr, "%s %d -> %d: output length %lld, expected %lld\n", name[quality], in_fs, out_fs, out_samples / 2, expected);
+        return -1;
+    }
+
+    if (freq < BENCH_SRC_TONE_HZ * 0.995 || freq > BENCH_SRC_TONE_HZ * 1.005)
+    {
+        FIO_PRINTF(stderr, "%s %d -> %d: output tone %.1f Hz, expected %d Hz\n", name[quality], in_fs, out_fs, freq, BENCH_SRC_TONE_HZ);
+        return -1;
+    }
+
+    return 0;
+}
+#endif
+
+#if XA_AEC22
+/* ...drive the aec22 API directly with mono 16-bit voice frames; latency is one frame of buffering per port */
+static int bench_aec(int frame_ms, int frames)
+{
+    void *p_adev = NULL;
+    xa_codec_handle_t p_aec;
+    void *buf[4];
+    char persist[4], scratch[4];
+    WORD32 size, frame_bytes, value;
+    long long t_exec = 0;
+    long long t0;
+    int i;
+
+    TST_CHK_API(xa_dummy_aec22(NULL, XA_API_CMD_GET_API_SIZE, 0, &size), "xa_dummy_aec22");
+    TST_CHK_PTR((p_aec = malloc(size)), "malloc");
+    TST_CHK_API(xa_dummy_aec22(p_aec, XA_API_CMD_INIT, XA_CMD_TYPE_INIT_API_PRE_CONFIG_PARAMS, NULL), "xa_dummy_aec22");
+
+    value = BENCH_AEC_SAMPLE_RATE;
+    TST_CHK_API(xa_dummy_aec22(p_aec, XA_API_CMD_SET_CONFIG_PARAM, XA_AEC22_CONFIG_PARAM_SAMPLE_RATE, &value), "xa_dummy_aec22");
+    value = 1;
+    TST_CHK_API(xa_dummy_aec22(p_aec, XA_API_CMD_SET_CONFIG_PARAM, XA_AEC22_CONFIG_PARAM_CHANNELS, &value), "xa_dummy_aec22");
+    value = 16;
+    TST_CHK_API(xa_dummy_aec22(p_aec, XA_API_CMD_SET_CONFIG_PARAM, XA_AEC22_CONFIG_PARAM_PCM_WIDTH, &value), "xa_dummy_aec22");
+    value = BENCH_AEC_SAMPLE_RATE / 1000 * frame_ms;
+    TST_CHK_API(xa_dummy_aec22(p_aec, XA_API_CMD_SET_CONFIG_PARAM, XA_AEC22_CONFIG_PARAM_FRAME_SIZE, &value), "xa_dummy_aec22");
+
+    TST_CHK_API(xa_dummy_aec22(p_aec, XA_API_CMD_INIT, XA_CMD_TYPE_INIT_API_POST_CONFIG_PARAMS, NULL), "xa_dummy_aec22");
+    TST_CHK_API(xa_dummy_aec22(p_aec, XA_API_CMD_GET_MEM_INFO_SIZE, 0, &frame_bytes), "xa_dummy_aec22");
+
+    /* ...2 input and 2 output ports, all connected */
+    for (i = 0; i < 4; i++)
+    {
+        TST_CHK_PTR((buf[i] = malloc(frame_bytes)), "malloc");
+        TST_CHK_API(xa_dummy_aec22(p_aec, XA_API_CMD_SET_MEM_PTR, i, buf[i]), "xa_dummy_aec22");
+        value = i;
+        TST_CHK_API(xa_dummy_aec22(p_aec, XA_API_CMD_SET_CONFIG_PARAM, XA_AEC22_CONFIG_PARAM_PORT_CONNECT, &value), "xa_dummy_aec22");
+    }
+    TST_CHK_API(xa_dummy_aec22(p_aec, XA_API_CMD_SET_MEM_PTR, 4, persist), "xa_dummy_aec22");
+    TST_CHK_API(xa_dummy_aec22(p_aec, XA_API_CMD_SET_MEM_PTR, 5, scratch), "xa_dummy_aec22");
+    TST_CHK_API(xa_dummy_aec22(p_aec, XA_API_CMD_INIT, XA_CMD_TYPE_INIT_PROCESS, NULL), "xa_dummy_aec22");
+
+    /* ...content does not change the cost; any non-trivial pattern will do */
+    for (i = 0; i < frame_bytes / 2; i++)
+    {
+        ((WORD16 *)buf[0])[i] = ((WORD16 *)buf[1])[i] = (WORD16)(i * 1237);
+    }
+
+    for (i = 0; i < frames; i++)
+    {
+        TST_CHK_API(xa_dummy_aec22(p_aec, XA_API_CMD_SET_INPUT_BYTES, 0, &frame_bytes), "xa_dummy_aec22");
+        TST_CHK_API(xa_dummy_aec22(p_aec, XA_API_CMD_SET_INPUT_BYTES, 1, &frame_bytes), "xa_dummy_aec22");
+
+        t0 = BENCH_CLK();
+        TST_CHK_API(xa_dummy_aec22(p_aec, XA_API_CMD_EXECUTE, XA_CMD_TYPE_DO_EXECUTE, NULL), "xa_dummy_aec22");
+        t_exec += BENCH_CLK_DIFF(BENCH_CLK(), t0);
+    }
+
+    FIO_PRINTF(stderr, "aec22 %2d ms frame (%4d samples) : latency %2d ms, %8lld cycles/frame, %6lld cycles/sample\n",
+               frame_ms, frame_bytes / 2, frame_ms, t_exec / frames, t_exec / ((long long)frames * (frame_bytes / 2)));
+
+    for (i = 0; i < 4; i++)
+    {
+        free(buf[i]);
+    }
+    free(p_aec);
+
+    return 0;
+}
+#endif
+
+void fio_quit()
+{
+    return;
+}
+
+int main_task(int argc, char **argv)
+{
+    static const int num_comp[] = {8, 32, BENCH_MAX_COMP};
+    void *p_adev = NULL;
+    pUWORD8 ver_info[3] = {0,0,0};    //{ver,lib_rev,api_rev}
+    unsigned short board_id = 0;
+    int iterations = BENCH_ITERATIONS;
+    mem_obj_t* mem_handle;
+    int i;
+
+    // NOTE: set_wbna() should be called before any other dynamic
+    // adjustment of the region attributes for cache.
+    set_wbna(&argc, argv);
+
+    /* ...start xos */
+    board_id = start_rtos();
+
+    /* ...get xaf version info*/
+    TST_CHK_API(xaf_get_verinfo(ver_info), "xaf_get_verinfo");
+
+    /* ...show xaf version info*/
+    TST_CHK_API(print_verinfo(ver_info,(pUWORD8)"\'Control Path Benchmark\'"), "print_verinfo");
+
+    /* ...initialize tracing facility */
+    TRACE_INIT("Xtensa Audio Framework - \'Control Path Benchmark\' Sample App");
+
+    /* ...check input arguments */
+    if (argc > 2)
+    {
+        PRINT_USAGE;
+        return 0;
+    }
+
+    if (argc == 2)
+    {
+        if (NULL != strstr(argv[1], "-iterations:"))
+        {
+            iterations = atoi((char *)&(argv[1][12]));
+        }
+        if (iterations <= 0)
+        {
+            PRINT_USAGE;
+            return 0;
+        }
+    }
+
+    mem_handle = mem_init();
+
+#ifdef XAF_PROFILE
+    clk_start();
+#endif
+
+    for (i = 0; i < (int)(sizeof(num_comp) / sizeof(num_comp[0])); i++)
+    {
+        TST_CHK_API(bench_run(num_comp[i], iterations), "bench_run");
+    }
+
+    /* ...message rate, one notification per message against batched notifications */
+    TST_CHK_API(bench_msg_rate(BENCH_MSG_RATE_COMP, BENCH_MSG_RATE_FRAMES, 0), "bench_msg_rate");
+    TST_CHK_API(bench_msg_rate(BENCH_MSG_RATE_COMP, BENCH_MSG_RATE_FRAMES, 1), "bench_msg_rate");
+
+    /* ...single application thread driving all components through completion notifications */
+    TST_CHK_API(bench_wait_any(BENCH_MSG_RATE_COMP, BENCH_MSG_RATE_FRAMES), "bench_wait_any");
+
+    /* ...buffer pool contention, one feeder against all feeders running concurrently */
+    TST_CHK_API(bench_feeders(1, BENCH_FEEDER_FRAMES, 0), "bench_feeders");
+    TST_CHK_API(bench_feeders(BENCH_MAX_FEEDERS, BENCH_FEEDER_FRAMES, 0), "bench_feeders");
+
+    /* ...same load with responses sharded across dispatcher threads */
+    TST_CHK_API(bench_feeders(BENCH_MAX_FEEDERS, BENCH_FEEDER_FRAMES, BENCH_DISPATCHERS), "bench_feeders");
+
+    /* ...graph reconfiguration, one round trip per command against batched transactions */
+    TST_CHK_API(bench_graph_setup(8, iterations, 0), "bench_graph_setup");
+    TST_CHK_API(bench_graph_setup(8, iterations, 1), "bench_graph_setup");
+    TST_CHK_API(bench_graph_setup(16, iterations, 0), "bench_graph_setup");
+    TST_CHK_API(bench_graph_setup(16, iterations, 1), "bench_graph_setup");
+
+    /* ...stream format change, delete and create against in-place reset */
+    TST_CHK_API(bench_reconfig(8, iterations), "bench_reconfig");
+
+    /* ...graph bring-up, hand-coded against a graph description */
+    TST_CHK_API(bench_graph_chain(8, 0), "bench_graph_chain");
+    TST_CHK_API(bench_graph_chain(8, 1), "bench_graph_chain");
+
+#if XA_SRC_POLY
+    /* ...sample-rate conversion cost per output sample, stereo 16-bit */
+    for (i = 0; i < XA_SRC_POLY_QUALITY_NUM; i++)
+    {
+        TST_CHK_API(bench_src(44100, 48000, i, BENCH_SRC_FRAMES), "bench_src");
+        TST_CHK_API(bench_src(48000, 16000, i, BENCH_SRC_FRAMES), "bench_src");
+    }
+#endif
+
+#if XA_AEC22
+    /* ...echo-canceller frame size, buffering latency against per-frame overhead */
+    for (i = 1; i <= 16; i <<= 1)
+    {
+        TST_CHK_API(bench_aec(i, BENCH_AEC_FRAMES), "bench_aec");
+    }
+#endif
+
+#ifdef XAF_PROFILE
+    clk_stop();
+#endif
+
+    (void)board_id;
+    (void)mem_handle;
+    mem_exit();
+
+    fio_quit();
+
+    /* ...deinitialize tracing facility */
+    TRACE_DEINIT();
+
+    return 0;
+}
@@ -0,0 +1,1203 @@
+/*
+* Copyright (c) 2015-2022 Cadence Design Systems Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to deal in the Software without restriction, including
+* without limitation the rights to use, copy, modify, merge, publish,
+* distribute, sublicense, and/or sell copies of the Software, and to
+* permit persons to whom the Software is furnished to do so, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "audio/xa-pcm-gain-api.h"
+#include "xaf-utils-test.h"
+#include "xaf-fio-test.h"
+
+/* control-path test: behaviour of the control path against graphs of pcm-gain components;
+ * deleting components with input in flight leaves the others streaming their own buffers,
+ * and all component memory is released; a burst of traffic beyond a shallow worker queue is
+ * deferred, not blocked, and the queue never holds more than its configured depth; a batch of
+ * commands takes a single doorbell and responses are signalled in groups; one thread drives all
+ * components through xaf_comp_wait_any, with a completion callback for every response; feeder
+ * threads streaming and reconfiguring their own components concurrently get back only their own
+ * buffers and settings; a transaction reports a status per command, an aborted one has no effect
+ * and a duplicate connect is refused; a chain built from a graph description carries frames end to
+ * end in order, and a graph failing half-way is rolled back without leaks; with responses sharded
+ * over dispatcher threads every component gets its buffers back in order, and a deleted component
+ * gets no callbacks after the delete returns; a component reset in place takes its new parameters
+ * without leaking and streams again, unless it feeds a peer */
+
+#define PRINT_USAGE FIO_PRINTF(stdout, "\nUsage: %s\n\n", argv[0]);
+
+#define CTRL_MAX_COMP           32
+#define CTRL_FRAMES             16
+#define CTRL_QUEUE_DEPTH        4
+#define CTRL_BURN_CYCLES        200000
+/* ...commands of one batch fit into the command queue; a full queue rings the doorbell early */
+#define CTRL_BATCH_COMP         8
+#define CTRL_FEEDERS            8
+#define CTRL_GRAPH_COMP         4
+#define CTRL_DISPATCH_THREADS   4
+#define CTRL_CB_SLEEP_MSEC      5
+
+/* ...per-component memory is scaled with the number of components in the graph */
+#define AUDIO_FRMWK_BUF_SIZE(n) ((256 << 8) + (n) * (1024 << 4))
+#define AUDIO_COMP_BUF_SIZE(n)  ((1024 << 7) + (n) * (1024 << 5))
+
+//component parameters
+#define PCM_GAIN_SAMPLE_WIDTH   16
+#define PCM_GAIN_NUM_CH         1
+#define PCM_GAIN_IDX_FOR_GAIN   1
+#define PCM_GAIN_SAMPLE_RATE    44100
+#define PCM_GAIN_FRAME_SIZE     1024
+
+/* ...record a failed check and carry on with the next one */
+#define CTRL_CHK(cond, ...)                         \
+    do {                                            \
+        if (!(cond))                                \
+        {                                           \
+            FIO_PRINTF(stderr, __VA_ARGS__);        \
+            errors++;                               \
+        }                                           \
+        checks++;                                   \
+    } while (0)
+
+unsigned int num_bytes_read, num_bytes_write;
+extern int audio_frmwk_buf_size;
+extern int audio_comp_buf_size;
+double strm_duration;
+
+#ifdef XAF_PROFILE
+    extern long long tot_cycles, frmwk_cycles, fread_cycles, fwrite_cycles;
+    extern long long dsp_comps_cycles, pcm_gain_cycles;
+    extern double dsp_mcps;
+#endif
+
+/* ...number of checks evaluated, reported with the result */
+static int checks;
+
+/* Dummy unused functions */
+XA_ERRORCODE xa_mp3_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_aac_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_mixer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_mp3_encoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_src_pp_fx(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_src_poly(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_renderer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_capturer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_amr_wb_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_hotword_decoder(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value){return 0;}
+XA_ERRORCODE xa_vorbis_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_dummy_aec22(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_dummy_aec23(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_pcm_split(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_pcm_split14(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_pcm_split18(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_mimo_mix(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_dummy_wwd(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_dummy_hbuf(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_opus_encoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_dummy_wwd_msg(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_dummy_hbuf_msg(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_opus_decoder(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_microspeech_fe(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_microspeech_inference(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_person_detect_inference(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_keyword_detection_inference(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+
+static int pcm_gain_setup(void *p_comp)
+{
+    int param[10];
+
+    param[0] = XA_PCM_GAIN_CONFIG_PARAM_CHANNELS;
+    param[1] = PCM_GAIN_NUM_CH;
+    param[2] = XA_PCM_GAIN_CONFIG_PARAM_SAMPLE_RATE;
+    param[3] = PCM_GAIN_SAMPLE_RATE;
+    param[4] = XA_PCM_GAIN_CONFIG_PARAM_PCM_WIDTH;
+    param[5] = PCM_GAIN_SAMPLE_WIDTH;
+    param[6] = XA_PCM_GAIN_CONFIG_PARAM_FRAME_SIZE;
+    param[7] = PCM_GAIN_FRAME_SIZE;
+    param[8] = XA_PCM_GAIN_CONFIG_PARAM_GAIN_FACTOR;
+    param[9] = PCM_GAIN_IDX_FOR_GAIN;
+
+    return(xaf_comp_set_config(p_comp, 5, &param[0]));
+}
+
+/* ...start a configured component; input buffers are fed (or returned ones re-fed) until its initialization completes */
+static int ctrl_comp_start(void *p_adev, void *p_comp, void *inbuf[2], int feed)
+{
+    xaf_comp_status status;
+    int info[4];
+    int i;
+
+    TST_CHK_API(xaf_comp_process(p_adev, p_comp, NULL, 0, XAF_START_FLAG), "xaf_comp_process");
+
+    for (i = 0; i < (feed ? 2 : 0); i++)
+    {
+        memset(inbuf[i], 0, PCM_GAIN_FRAME_SIZE);
+        TST_CHK_API(xaf_comp_process(p_adev, p_comp, inbuf[i], PCM_GAIN_FRAME_SIZE, XAF_INPUT_READY_FLAG), "xaf_comp_process");
+    }
+
+    while (1)
+    {
+        TST_CHK_API(xaf_comp_get_status(p_adev, p_comp, &status, &info[0]), "xaf_comp_get_status");
+
+        if (status == XAF_INIT_DONE) break;
+
+        if (status == XAF_NEED_INPUT)
+        {
+            memset((void *)info[0], 0, PCM_GAIN_FRAME_SIZE);
+            TST_CHK_API(xaf_comp_process(p_adev, p_comp, (void *)info[0], PCM_GAIN_FRAME_SIZE, XAF_INPUT_READY_FLAG), "xaf_comp_process");
+        }
+        else
+        {
+            FIO_PRINTF(stderr, "Failed to init, status:%d\n", status);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/* ...create and start a pcm-gain component, feeding silence until its initialization completes */
+static int ctrl_comp_create(void *p_adev, void **pp_comp, void *inbuf[2])
+{
+    TST_CHK_API_COMP_CREATE(p_adev, pp_comp, "post-proc/pcm_gain", 2, 1, &inbuf[0], XAF_POST_PROC, "xaf_comp_create");
+    TST_CHK_API(pcm_gain_setup(*pp_comp), "pcm_gain_setup");
+
+    return ctrl_comp_start(p_adev, *pp_comp, inbuf, 1);
+}
+
+/* ...wait for a consumed input buffer of a running component, recycling output buffers on the way */
+static int ctrl_comp_next_input(void *p_adev, void *p_comp, void **pp_buf)
+{
+    xaf_comp_status status;
+    int info[4];
+
+    do
+    {
+        TST_CHK_API(xaf_comp_get_status(p_adev, p_comp, &status, &info[0]), "xaf_comp_get_status");
+
+        if (status == XAF_OUTPUT_READY)
+        {
+            TST_CHK_API(xaf_comp_process(p_adev, p_comp, (void *)info[0], info[1], XAF_NEED_OUTPUT_FLAG), "xaf_comp_process");
+        }
+        else if (status != XAF_NEED_INPUT)
+        {
+            FIO_PRINTF(stderr, "Unexpected status:%d\n", status);
+            return -1;
+        }
+    }
+    while (status != XAF_NEED_INPUT);
+
+    *pp_buf = (void *)info[0];
+
+    return 0;
+}
+
+static int ctrl_adev_open(void **pp_adev, xaf_adev_config_t *adev_config, int num_comp)
+{
+    adev_config->pmem_malloc = mem_malloc;
+    adev_config->pmem_free = mem_free;
+    adev_config->audio_framework_buffer_size = AUDIO_FRMWK_BUF_SIZE(num_comp);
+    adev_config->audio_component_buffer_size = AUDIO_COMP_BUF_SIZE(num_comp);
+
+    return xaf_adev_open(pp_adev, adev_config);
+}
+
+/* ...N components streaming; every other one is deleted with its input still in flight, the others
+ * must keep getting their own buffers back, and deleting all must release all component memory */
+static int ctrl_delete(int num_comp, int frames)
+{
+    void *p_adev = NULL;
+    void *p_comp[CTRL_MAX_COMP];
+    void *inbuf[CTRL_MAX_COMP][2];
+    void *p_buf;
+    xaf_adev_config_t adev_config;
+    WORD32 mem[2][5];
+    int errors = 0;
+    int i, k;
+
+    TST_CHK_API(xaf_adev_config_default_init(&adev_config), "xaf_adev_config_default_init");
+    TST_CHK_API(ctrl_adev_open(&p_adev, &adev_config, num_comp), "ctrl_adev_open");
+
+    /* ...worker scratch is kept once allocated; take the reference after the first component is gone */
+    TST_CHK_API(ctrl_comp_create(p_adev, &p_comp[0], &inbuf[0][0]), "ctrl_comp_create");
+    TST_CHK_API(xaf_comp_delete(p_comp[0]), "xaf_comp_delete");
+    TST_CHK_API(xaf_get_mem_stats(p_adev, &mem[0][0]), "xaf_get_mem_stats");
+
+    for (i = 0; i < num_comp; i++)
+    {
+        TST_CHK_API(ctrl_comp_create(p_adev, &p_comp[i], &inbuf[i][0]), "ctrl_comp_create");
+        TST_CHK_API(xaf_comp_process(p_adev, p_comp[i], NULL, 0, XAF_EXEC_FLAG), "xaf_comp_process");
+    }
+
+    for (k = 0; k < frames; k++)
+    {
+        for (i = 0; i < num_comp; i++)
+        {
+            if (p_comp[i] == NULL) continue;
+
+            TST_CHK_API(ctrl_comp_next_input(p_adev, p_comp[i], &p_buf), "ctrl_comp_next_input");
+
+            CTRL_CHK(p_buf == inbuf[i][0] || p_buf == inbuf[i][1], "delete: component %d got foreign buffer %p\n", i, p_buf);
+
+            TST_CHK_API(xaf_comp_process(p_adev, p_comp[i], p_buf, PCM_GAIN_FRAME_SIZE, XAF_INPUT_READY_FLAG), "xaf_comp_process");
+        }
+
+        /* ...half-way through, drop every other component while both of its buffers are queued */
+        if (k == frames / 2)
+        {
+            for (i = 1; i < num_comp; i += 2)
+            {
+                TST_CHK_API(xaf_comp_delete(p_comp[i]), "xaf_comp_delete");
+                p_comp[i] = NULL;
+            }
+
+            /* ...control commands of the survivors are not held up by the cancelled traffic */
+            for (i = 0; i < num_comp; i += 2)
+            {
+                TST_CHK_API(xaf_pause(p_comp[i], 0), "xaf_pause");
+                TST_CHK_API(xaf_resume(p_comp[i], 0), "xaf_resume");
+            }
+        }
+    }
+
+    for (i = num_comp - 1; i >= 0; i--)
+    {
+        if (p_comp[i] == NULL) continue;
+
+        TST_CHK_API(xaf_comp_delete(p_comp[i]), "xaf_comp_delete");
+    }
+
+    TST_CHK_API(xaf_get_mem_stats(p_adev, &mem[1][0]), "xaf_get_mem_stats");
+
+    /* ...current local and shared memory in use */
+    CTRL_CHK(mem[1][3] == mem[0][3] && mem[1][4] == mem[0][4], "delete: memory not released: local %d -> %d, shared %d -> %d\n",
+        mem[0][3], mem[1][3], mem[0][4], mem[1][4]);
+
+    TST_CHK_API(xaf_adev_close(p_adev, XAF_ADEV_NORMAL_CLOSE), "xaf_adev_close");
+
+    return errors;
+}
+
+/* ...burst of input buffers of N components, submitted at once, against a worker queue a few
+ * messages deep; the overflow is deferred and every buffer still comes back to its owner */
+static int ctrl_backpressure(int num_comp, int frames, int depth)
+{
+    void *p_adev = NULL;
+    void *p_comp[CTRL_MAX_COMP];
+    void *inbuf[CTRL_MAX_COMP][2];
+    void *p_buf[CTRL_MAX_COMP];
+    xaf_adev_config_t adev_config;
+    xaf_worker_queue_stats_t stats;
+    int param[2];
+    int errors = 0;
+    int i, k;
+
+    TST_CHK_API(xaf_adev_config_default_init(&adev_config), "xaf_adev_config_default_init");
+
+    for (i = 0; i < XAF_MAX_WORKER_THREADS; i++)
+    {
+        adev_config.worker_queue_depth[i] = depth;
+    }
+
+    TST_CHK_API(ctrl_adev_open(&p_adev, &adev_config, num_comp), "ctrl_adev_open");
+
+    /* ...worker threads take over component execution from the DSP thread */
+    TST_CHK_API(xaf_adev_set_priorities(p_adev, 1, 3, 2), "xaf_adev_set_priorities");
+
+    /* ...every frame takes a while, so that the worker falls behind the burst */
+    param[0] = XA_PCM_GAIN_BURN_ADDITIONAL_CYCLES;
+    param[1] = CTRL_BURN_CYCLES;
+
+    for (i = 0; i < num_comp; i++)
+    {
+        TST_CHK_API(ctrl_comp_create(p_adev, &p_comp[i], &inbuf[i][0]), "ctrl_comp_create");
+        TST_CHK_API(xaf_comp_set_config(p_comp[i], 1, &param[0]), "xaf_comp_set_config");
+        TST_CHK_API(xaf_comp_process(p_adev, p_comp[i], NULL, 0, XAF_EXEC_FLAG), "xaf_comp_process");
+    }
+
+    for (k = 0; k < frames; k++)
+    {
+        for (i = 0; i < num_comp; i++)
+        {
+            TST_CHK_API(ctrl_comp_next_input(p_adev, p_comp[i], &p_buf[i]), "ctrl_comp_next_input");
+
+            CTRL_CHK(p_buf[i] == inbuf[i][0] || p_buf[i] == inbuf[i][1], "backpressure: component %d got foreign buffer %p\n", i, p_buf[i]);
+        }
+
+        TST_CHK_API(xaf_cmd_batch_begin(p_adev), "xaf_cmd_batch_begin");
+
+        for (i = 0; i < num_comp; i++)
+        {
+            TST_CHK_API(xaf_comp_process(p_adev, p_comp[i], p_buf[i], PCM_GAIN_FRAME_SIZE, XAF_INPUT_READY_FLAG), "xaf_comp_process");
+        }
+
+        TST_CHK_API(xaf_cmd_batch_end(p_adev), "xaf_cmd_batch_end");
+    }
+
+    /* ...all components run on the default worker */
+    param[0] = XAF_COMP_CONFIG_PARAM_MEMTAB_WORKER;
+    TST_CHK_API(xaf_comp_get_config(p_comp[0], 1, &param[0]), "xaf_comp_get_config");
+    TST_CHK_API(xaf_get_worker_queue_stats(p_adev, param[1], &stats), "xaf_get_worker_queue_stats");
+
+    FIO_PRINTF(stderr, "backpressure: depth %u, used hwm %u, deferred %u (hwm %u), coalesced %u\n",
+        stats.depth, stats.used_hwm, stats.deferred, stats.deferred_hwm, stats.coalesced);
+
+    CTRL_CHK(stats.depth == (UWORD32)depth, "backpressure: queue depth %u, configured %d\n", stats.depth, depth);
+    CTRL_CHK(stats.used_hwm <= stats.depth, "backpressure: %u messages queued, depth %u\n", stats.used_hwm, stats.depth);
+    CTRL_CHK(stats.deferred > 0 && stats.deferred_hwm > 0, "backpressure: burst of %d buffers was not deferred\n", num_comp);
+
+    for (i = num_comp - 1; i >= 0; i--)
+    {
+        TST_CHK_API(xaf_comp_delete(p_comp[i]), "xaf_comp_delete");
+    }
+
+    TST_CHK_API(xaf_adev_close(p_adev, XAF_ADEV_NORMAL_CLOSE), "xaf_adev_close");
+
+    return errors;
+}
+
+/* ...stream N components, handing the consumed buffers back call by call or in one batch;
+ * a batch must cost exactly one DSP notification, with responses coalesced up to N per notification */
+static int ctrl_doorbell(int num_comp, int frames, int batched)
+{
+    void *p_adev = NULL;
+    void *p_comp[CTRL_MAX_COMP];
+    void *inbuf[CTRL_MAX_COMP][2];
+    void *p_buf[CTRL_MAX_COMP];
+    xaf_adev_config_t adev_config;
+    xaf_ipc_stats_t stats[2];
+    int errors = 0;
+    int i, k;
+
+    TST_CHK_API(xaf_adev_config_default_init(&adev_config), "xaf_adev_config_default_init");
+    adev_config.resp_coalesce_count = (batched ? num_comp : 1);
+    TST_CHK_API(ctrl_adev_open(&p_adev, &adev_config, num_comp), "ctrl_adev_open");
+
+    for (i = 0; i < num_comp; i++)
+    {
+        TST_CHK_API(ctrl_comp_create(p_adev, &p_comp[i], &inbuf[i][0]), "ctrl_comp_create");
+        TST_CHK_API(xaf_comp_process(p_adev, p_comp[i], NULL, 0, XAF_EXEC_FLAG), "xaf_comp_process");
+    }
+
+    for (k = 0; k < frames; k++)
+    {
+        for (i = 0; i < num_comp; i++)
+        {
+            TST_CHK_API(ctrl_comp_next_input(p_adev, p_comp[i], &p_buf[i]), "ctrl_comp_next_input");
+        }
+
+        TST_CHK_API(xaf_get_ipc_stats(p_adev, &stats[0]), "xaf_get_ipc_stats");
+
+        if (batched)
+        {
+            TST_CHK_API(xaf_cmd_batch_begin(p_adev), "xaf_cmd_batch_begin");
+        }
+
+        for (i = 0; i < num_comp; i++)
+        {
+            TST_CHK_API(xaf_comp_process(p_adev, p_comp[i], p_buf[i], PCM_GAIN_FRAME_SIZE, XAF_INPUT_READY_FLAG), "xaf_comp_process");
+        }
+
+        if (batched)
+        {
+            TST_CHK_API(xaf_cmd_batch_end(p_adev), "xaf_cmd_batch_end");
+        }
+
+        TST_CHK_API(xaf_get_ipc_stats(p_adev, &stats[1]), "xaf_get_ipc_stats");
+
+        CTRL_CHK(stats[1].cmd_count - stats[0].cmd_count == (UWORD32)num_comp, "doorbell: %u commands sent, %d submitted\n",
+            stats[1].cmd_count - stats[0].cmd_count, num_comp);
+        CTRL_CHK(stats[1].cmd_doorbells - stats[0].cmd_doorbells == (UWORD32)(batched ? 1 : num_comp), "doorbell: %u doorbells for %d %s commands\n",
+            stats[1].cmd_doorbells - stats[0].cmd_doorbells, num_comp, (batched ? "batched" : "single"));
+    }
+
+    TST_CHK_API(xaf_get_ipc_stats(p_adev, &stats[1]), "xaf_get_ipc_stats");
+
+    FIO_PRINTF(stderr, "doorbell: %s, commands %u, doorbells %u; responses %u, doorbells %u\n", (batched ? "batched" : "single"),
+        stats[1].cmd_count, stats[1].cmd_doorbells, stats[1].resp_count, stats[1].resp_doorbells);
+
+    /* ...never more notifications than responses; fewer once they are coalesced */
+    CTRL_CHK(stats[1].resp_doorbells <= stats[1].resp_count, "doorbell: %u response doorbells for %u responses\n",
+        stats[1].resp_doorbells, stats[1].resp_count);
+    CTRL_CHK(!batched || stats[1].resp_doorbells < stats[1].resp_count, "doorbell: %u responses were not coalesced\n", stats[1].resp_count);
+
+    for (i = num_comp - 1; i >= 0; i--)
+    {
+        TST_CHK_API(xaf_comp_delete(p_comp[i]), "xaf_comp_delete");
+    }
+
+    TST_CHK_API(xaf_adev_close(p_adev, XAF_ADEV_NORMAL_CLOSE), "xaf_adev_close");
+
+    return errors;
+}
+
+/* ...completion callback, invoked from proxy thread */
+static void ctrl_completion_cb(void *p_comp, void *cb_data)
+{
+    (*(volatile int *)cb_data)++;
+}
+
+/* ...stream N components from one thread, servicing whichever component completes first */
+static int ctrl_wait_any(int num_comp, int frames)
+{
+    void *p_adev = NULL;
+    void *p_comp[CTRL_MAX_COMP];
+    void *inbuf[CTRL_MAX_COMP][2];
+    void *p_ready;
+    volatile int completions[CTRL_MAX_COMP];
+    int serviced[CTRL_MAX_COMP];
+    int consumed[CTRL_MAX_COMP];
+    xaf_adev_config_t adev_config;
+    xaf_comp_status status;
+    int info[4];
+    int param[2];
+    int errors = 0;
+    int i, done;
+
+    TST_CHK_API(xaf_adev_config_default_init(&adev_config), "xaf_adev_config_default_init");
+    TST_CHK_API(ctrl_adev_open(&p_adev, &adev_config, num_comp), "ctrl_adev_open");
+
+    /* ...nothing is pending, so there is nothing to wait for */
+    p_ready = p_adev;
+    CTRL_CHK(xaf_comp_wait_any(p_adev, &p_ready) == XAF_API_ERR && p_ready == NULL, "wait-any: idle device did not return XAF_API_ERR\n");
+
+    for (i = 0; i < num_comp; i++)
+    {
+        TST_CHK_API(ctrl_comp_create(p_adev, &p_comp[i], &inbuf[i][0]), "ctrl_comp_create");
+        completions[i] = serviced[i] = consumed[i] = 0;
+        TST_CHK_API(xaf_comp_set_completion_cb(p_comp[i], ctrl_completion_cb, (void *)&completions[i]), "xaf_comp_set_completion_cb");
+        TST_CHK_API(xaf_comp_process(p_adev, p_comp[i], NULL, 0, XAF_EXEC_FLAG), "xaf_comp_process");
+    }
+
+    for (done = 0; done < num_comp; )
+    {
+        TST_CHK_API(xaf_comp_wait_any(p_adev, &p_ready), "xaf_comp_wait_any");
+
+        for (i = 0; i < num_comp && p_comp[i] != p_ready; i++);
+
+        if (i == num_comp)
+        {
+            FIO_PRINTF(stderr, "wait-any: unknown component %p\n", p_ready);
+            return -1;
+        }
+
+        /* ...response is already delivered, so this does not block */
+        TST_CHK_API(xaf_comp_get_status(p_adev, p_comp[i], &status, &info[0]), "xaf_comp_get_status");
+        serviced[i]++;
+
+        if (status == XAF_OUTPUT_READY)
+        {
+            TST_CHK_API(xaf_comp_process(p_adev, p_comp[i], (void *)info[0], info[1], XAF_NEED_OUTPUT_FLAG), "xaf_comp_process");
+        }
+        else if (status == XAF_NEED_INPUT)
+        {
+            CTRL_CHK((void *)info[0] == inbuf[i][0] || (void *)info[0] == inbuf[i][1], "wait-any: component %d got foreign buffer %p\n", i, (void *)info[0]);
+
+            if (consumed[i] < frames)
+            {
+                TST_CHK_API(xaf_comp_process(p_adev, p_comp[i], (void *)info[0], PCM_GAIN_FRAME_SIZE, XAF_INPUT_READY_FLAG), "xaf_comp_process");
+
+                done += (++consumed[i] == frames);
+            }
+        }
+        else
+        {
+            FIO_PRINTF(stderr, "Unexpected status:%d\n", status);
+            return -1;
+        }
+    }
+
+    /* ...responses are delivered in order; once this one is back, callbacks of all earlier ones have returned */
+    param[0] = XA_PCM_GAIN_CONFIG_PARAM_GAIN_FACTOR;
+    TST_CHK_API(xaf_comp_get_config(p_comp[0], 1, &param[0]), "xaf_comp_get_config");
+
+    /* ...one callback per response; those not serviced yet are for the two input and one output buffer
+     * still held by the component, and the configuration request */
+    for (i = 0; i < num_comp; i++)
+    {
+        CTRL_CHK(completions[i] >= serviced[i] && completions[i] <= serviced[i] + 3 + (i == 0),
+            "wait-any: component %d, %d callbacks for %d responses\n", i, completions[i], serviced[i]);
+    }
+
+    for (i = num_comp - 1; i >= 0; i--)
+    {
+        TST_CHK_API(xaf_comp_delete(p_comp[i]), "xaf_comp_delete");
+    }
+
+    TST_CHK_API(xaf_adev_close(p_adev, XAF_ADEV_NORMAL_CLOSE), "xaf_adev_close");
+
+    return errors;
+}
+
+typedef struct ctrl_feeder_s {
+    void   *p_adev;
+    void   *p_comp;
+    void   *inbuf[2];
+    int     frames;
+    int     offset;
+    int     checks;
+    int     errors;
+    int     error;
+} ctrl_feeder_t;
+
+/* ...stream frames through one component, changing its gain with every frame and reading it back;
+ * the gain is set by index and read back in dB */
+static int ctrl_feeder(ctrl_feeder_t *feeder)
+{
+    static const int gain_db[] = {0, -6, -12, -18, 6, 12, 18};
+    void *p_adev = feeder->p_adev;
+    void *p_comp = feeder->p_comp;
+    void *p_buf;
+    int param[2];
+    int k, idx;
+
+    TST_CHK_API(xaf_comp_process(p_adev, p_comp, NULL, 0, XAF_EXEC_FLAG), "xaf_comp_process");
+
+    for (k = 0; k < feeder->frames; k++)
+    {
+        TST_CHK_API(ctrl_comp_next_input(p_adev, p_comp, &p_buf), "ctrl_comp_next_input");
+
+        feeder->checks++;
+        if (p_buf != feeder->inbuf[0] && p_buf != feeder->inbuf[1])
+        {
+            FIO_PRINTF(stderr, "feeders: component %p got foreign buffer %p\n", p_comp, p_buf);
+            feeder->errors++;
+        }
+
+        TST_CHK_API(xaf_comp_process(p_adev, p_comp, p_buf, PCM_GAIN_FRAME_SIZE, XAF_INPUT_READY_FLAG), "xaf_comp_process");
+
+        /* ...config traffic takes auxiliary buffers from the pool shared by all components;
+         * every feeder walks the gains from its own offset, so a crossed setting shows */
+        idx = (feeder->offset + k) % (int)(sizeof(gain_db) / sizeof(gain_db[0]));
+
+        param[0] = XA_PCM_GAIN_CONFIG_PARAM_GAIN_FACTOR;
+        param[1] = idx;
+        TST_CHK_API(xaf_comp_set_config(p_comp, 1, &param[0]), "xaf_comp_set_config");
+
+        param[1] = -1;
+        TST_CHK_API(xaf_comp_get_config(p_comp, 1, &param[0]), "xaf_comp_get_config");
+
+        feeder->checks++;
+        if (param[1] != gain_db[idx])
+        {
+            FIO_PRINTF(stderr, "feeders: component %p frame %d, gain %d dB read back, %d dB set\n", p_comp, k, param[1], gain_db[idx]);
+            feeder->errors++;
+        }
+    }
+
+    return 0;
+}
+
+static void *ctrl_feeder_entry(void *arg)
+{
+    ctrl_feeder_t *feeder = (ctrl_feeder_t *)arg;
+
+    feeder->error = ctrl_feeder(feeder);
+
+    return NULL;
+}
+
+/* ...N feeder threads, each streaming and reconfiguring its own component */
+static int ctrl_feeders(int num_threads, int frames, int dispatch)
+{
+    void *p_adev = NULL;
+    void *p_comp[CTRL_FEEDERS];
+    xf_thread_t thread[CTRL_FEEDERS];
+    ctrl_feeder_t feeder[CTRL_FEEDERS];
+    static unsigned char stack[CTRL_FEEDERS][STACK_SIZE];
+    xaf_adev_config_t adev_config;
+    int errors = 0, error = 0;
+    int i;
+
+    TST_CHK_API(xaf_adev_config_default_init(&adev_config), "xaf_adev_config_default_init");
+    adev_config.proxy_dispatch_threads = dispatch;
+    TST_CHK_API(ctrl_adev_open(&p_adev, &adev_config, num_threads), "ctrl_adev_open");
+
+    for (i = 0; i < num_threads; i++)
+    {
+        TST_CHK_API(ctrl_comp_create(p_adev, &p_comp[i], &feeder[i].inbuf[0]), "ctrl_comp_create");
+
+        feeder[i].p_adev = p_adev;
+        feeder[i].p_comp = p_comp[i];
+        feeder[i].frames = frames;
+        feeder[i].offset = i;
+        feeder[i].checks = feeder[i].errors = feeder[i].error = 0;
+    }
+
+    for (i = 0; i < num_threads; i++)
+    {
+        __xf_thread_create(&thread[i], ctrl_feeder_entry, &feeder[i], "Feeder Thread", stack[i], STACK_SIZE, XAF_APP_THREADS_PRIORITY);
+    }
+
+    for (i = 0; i < num_threads; i++)
+    {
+        __xf_thread_join(&thread[i], NULL);
+        __xf_thread_destroy(&thread[i]);
+
+        error |= feeder[i].error;
+        checks += feeder[i].checks;
+        errors += feeder[i].errors;
+    }
+
+    TST_CHK_API(error, "ctrl_feeder");
+
+    for (i = num_threads - 1; i >= 0; i--)
+    {
+        TST_CHK_API(xaf_comp_delete(p_comp[i]), "xaf_comp_delete");
+    }
+
+    TST_CHK_API(xaf_adev_close(p_adev, XAF_ADEV_NORMAL_CLOSE), "xaf_adev_close");
+
+    return errors;
+}
+
+/* ...a transaction reports the status of every command it carries, an aborted one changes nothing,
+ * and a port pair connected twice in one transaction is rejected */
+static int ctrl_txn(void)
+{
+    void *p_adev = NULL;
+    void *p_comp[2];
+    void *inbuf[2];
+    void *p_txn;
+    xaf_adev_config_t adev_config;
+    xaf_comp_status status;
+    WORD32 txn_status[3];
+    int param[3][2];
+    int info[4];
+    int errors = 0;
+    int ret;
+
+    TST_CHK_API(xaf_adev_config_default_init(&adev_config), "xaf_adev_config_default_init");
+    TST_CHK_API(ctrl_adev_open(&p_adev, &adev_config, 2), "ctrl_adev_open");
+
+    TST_CHK_API(ctrl_comp_create(p_adev, &p_comp[0], &inbuf[0]), "ctrl_comp_create");
+
+    /* ...gain index 1 is -6 dB; a channel count of 0 is out of range */
+    param[0][0] = XA_PCM_GAIN_CONFIG_PARAM_GAIN_FACTOR;
+    param[0][1] = 1;
+    param[1][0] = XA_PCM_GAIN_CONFIG_PARAM_CHANNELS;
+    param[1][1] = 0;
+    param[2][0] = XA_PCM_GAIN_CONFIG_PARAM_GAIN_FACTOR;
+    param[2][1] = 0;
+
+    TST_CHK_API(xaf_txn_begin(p_adev, &p_txn), "xaf_txn_begin");
+    TST_CHK_API(xaf_txn_set_config(p_txn, p_comp[0], 1, &param[0][0]), "xaf_txn_set_config");
+    TST_CHK_API(xaf_txn_set_config(p_txn, p_comp[0], 1, &param[1][0]), "xaf_txn_set_config");
+    TST_CHK_API(xaf_txn_get_config(p_txn, p_comp[0], 1, &param[2][0]), "xaf_txn_get_config");
+
+    txn_status[0] = txn_status[1] = txn_status[2] = -1;
+    ret = xaf_txn_commit(p_txn, &txn_status[0]);
+
+    CTRL_CHK(ret != XAF_NO_ERR, "txn: commit with a failing command returned %d\n", ret);
+    CTRL_CHK(txn_status[0] == XAF_NO_ERR, "txn: valid set_config status %d\n", txn_status[0]);
+    CTRL_CHK(txn_status[1] != XAF_NO_ERR, "txn: invalid set_config status %d\n", txn_status[1]);
+    CTRL_CHK(txn_status[2] == XAF_NO_ERR && param[2][1] == -6, "txn: get_config status %d, gain %d dB\n", txn_status[2], param[2][1]);
+
+    /* ...nothing recorded in an aborted transaction reaches the component */
+    param[0][1] = 2;
+    TST_CHK_API(xaf_txn_begin(p_adev, &p_txn), "xaf_txn_begin");
+    TST_CHK_API(xaf_txn_set_config(p_txn, p_comp[0], 1, &param[0][0]), "xaf_txn_set_config");
+    TST_CHK_API(xaf_txn_abort(p_txn), "xaf_txn_abort");
+
+    param[2][1] = 0;
+    TST_CHK_API(xaf_comp_get_config(p_comp[0], 1, &param[2][0]), "xaf_comp_get_config");
+    CTRL_CHK(param[2][1] == -6, "txn: gain %d dB after abort\n", param[2][1]);
+
+    /* ...the duplicate is refused when recorded, the first connect still commits */
+    TST_CHK_API_COMP_CREATE(p_adev, &p_comp[1], "post-proc/pcm_gain", 0, 1, NULL, XAF_POST_PROC, "xaf_comp_create");
+    TST_CHK_API(pcm_gain_setup(p_comp[1]), "pcm_gain_setup");
+
+    TST_CHK_API(xaf_txn_begin(p_adev, &p_txn), "xaf_txn_begin");
+    TST_CHK_API(xaf_txn_connect(p_txn, p_comp[0], 1, p_comp[1], 0, XAF_GRAPH_CONN_BUFS), "xaf_txn_connect");
+
+    ret = xaf_txn_connect(p_txn, p_comp[0], 1, p_comp[1], 0, XAF_GRAPH_CONN_BUFS);
+    CTRL_CHK(ret == XAF_ROUTING_ERR, "txn: duplicate connect returned %d\n", ret);
+
+    txn_status[0] = -1;
+    TST_CHK_API(xaf_txn_commit(p_txn, &txn_status[0]), "xaf_txn_commit");
+    CTRL_CHK(txn_status[0] == XAF_NO_ERR, "txn: connect status %d\n", txn_status[0]);
+
+    TST_CHK_API(xaf_comp_process(p_adev, p_comp[1], NULL, 0, XAF_START_FLAG), "xaf_comp_process");
+    TST_CHK_API(xaf_comp_get_status(p_adev, p_comp[1], &status, &info[0]), "xaf_comp_get_status");
+    CTRL_CHK(status == XAF_INIT_DONE, "txn: connected component status %d\n", status);
+
+    TST_CHK_API(xaf_comp_delete(p_comp[1]), "xaf_comp_delete");
+    TST_CHK_API(xaf_comp_delete(p_comp[0]), "xaf_comp_delete");
+
+    TST_CHK_API(xaf_adev_close(p_adev, XAF_ADEV_NORMAL_CLOSE), "xaf_adev_close");
+
+    return errors;
+}
+
+/* ...initialization input of the graph chain head: silence */
+static WORD32 ctrl_graph_input(pVOID cb_data, WORD32 comp_idx, pVOID p_buf, UWORD32 buf_size)
+{
+    memset(p_buf, 0, PCM_GAIN_FRAME_SIZE);
+
+    return PCM_GAIN_FRAME_SIZE;
+}
+
+/* ...a chain built from a graph description carries frames from its head to its tail in order;
+ * a graph that fails half-way is rolled back without leaking memory */
+static int ctrl_graph(int num_comp, int frames)
+{
+    void *p_adev = NULL;
+    void *p_comp[CTRL_GRAPH_COMP];
+    void *inbuf[2];
+    void *p_buf;
+    xaf_adev_config_t adev_config;
+    xaf_graph_comp_t gcomp[CTRL_GRAPH_COMP];
+    xaf_graph_conn_t gconn[CTRL_GRAPH_COMP];
+    xaf_graph_t desc;
+    xaf_comp_status status;
+    WORD32 mem[3][5];
+    short *p_pcm;
+    int param[10];
+    int info[4];
+    int errors = 0;
+    int i, k, n, ret;
+
+    TST_CHK_API(xaf_adev_config_default_init(&adev_config), "xaf_adev_config_default_init");
+    TST_CHK_API(ctrl_adev_open(&p_adev, &adev_config, num_comp), "ctrl_adev_open");
+
+    /* ...0 dB, the chain passes samples through unchanged */
+    param[0] = XA_PCM_GAIN_CONFIG_PARAM_CHANNELS;
+    param[1] = PCM_GAIN_NUM_CH;
+    param[2] = XA_PCM_GAIN_CONFIG_PARAM_SAMPLE_RATE;
+    param[3] = PCM_GAIN_SAMPLE_RATE;
+    param[4] = XA_PCM_GAIN_CONFIG_PARAM_PCM_WIDTH;
+    param[5] = PCM_GAIN_SAMPLE_WIDTH;
+    param[6] = XA_PCM_GAIN_CONFIG_PARAM_FRAME_SIZE;
+    param[7] = PCM_GAIN_FRAME_SIZE;
+    param[8] = XA_PCM_GAIN_CONFIG_PARAM_GAIN_FACTOR;
+    param[9] = 0;
+
+    memset(gcomp, 0, sizeof(gcomp));
+    memset(gconn, 0, sizeof(gconn));
+
+    for (i = 0; i < num_comp; i++)
+    {
+        TST_CHK_API(xaf_comp_config_default_init(&gcomp[i].config), "xaf_comp_config_default_init");
+        gcomp[i].config.comp_id = "post-proc/pcm_gain";
+        gcomp[i].config.comp_type = XAF_POST_PROC;
+        gcomp[i].config.num_input_buffers = (i == 0 ? 2 : 0);
+        gcomp[i].config.num_output_buffers = (i == num_comp - 1);
+        gcomp[i].config.pp_inbuf = (pVOID (*)[XAF_MAX_INBUFS])&inbuf[0];
+        gcomp[i].num_param = 5;
+        gcomp[i].p_param = &param[0];
+        gcomp[i].priority = XAF_GRAPH_PRIORITY_DEFAULT;
+        gcomp[i].init_input_cb = ctrl_graph_input;
+
+        if (i > 0)
+        {
+            gconn[i - 1].src = i - 1;
+            gconn[i - 1].src_out_port = 1;
+            gconn[i - 1].dest = i;
+            gconn[i - 1].dest_in_port = 0;
+            gconn[i - 1].num_buf = 0;
+        }
+    }
+
+    desc.num_comp = num_comp;
+    desc.comp = &gcomp[0];
+    desc.num_conn = num_comp - 1;
+    desc.conn = &gconn[0];
+
+    /* ...worker scratch is kept once allocated; take the reference after the first graph is gone */
+    TST_CHK_API(xaf_graph_create(p_adev, &desc, p_comp), "xaf_graph_create");
+    TST_CHK_API(xaf_graph_delete(&desc, p_comp), "xaf_graph_delete");
+    TST_CHK_API(xaf_get_mem_stats(p_adev, &mem[0][0]), "xaf_get_mem_stats");
+
+    /* ...route buffers of the last link do not fit, failing after all other links are made */
+    gconn[num_comp - 2].num_buf = 1024;
+    ret = xaf_graph_create(p_adev, &desc, p_comp);
+    gconn[num_comp - 2].num_buf = 0;
+
+    CTRL_CHK(ret != XAF_NO_ERR, "graph: oversized link did not fail\n");
+
+    for (i = 0, n = 0; i < num_comp; i++)
+    {
+        n += (p_comp[i] != NULL);
+    }
+
+    CTRL_CHK(n == 0, "graph: %d components left after rollback\n", n);
+
+    TST_CHK_API(xaf_get_mem_stats(p_adev, &mem[1][0]), "xaf_get_mem_stats");
+
+    /* ...current local and shared memory in use */
+    CTRL_CHK(mem[1][3] == mem[0][3] && mem[1][4] == mem[0][4], "graph: rollback leaked memory: local %d -> %d, shared %d -> %d\n",
+        mem[0][3], mem[1][3], mem[0][4], mem[1][4]);
+
+    TST_CHK_API(xaf_graph_create(p_adev, &desc, p_comp), "xaf_graph_create");
+
+    for (i = 0; i < num_comp; i++)
+    {
+        TST_CHK_API(xaf_comp_process(p_adev, p_comp[i], NULL, 0, XAF_EXEC_FLAG), "xaf_comp_process");
+    }
+
+    /* ...every frame is filled with its own sample value and must come out of the tail whole and in
+     * order; silence fed during initialization may still precede the first one */
+    for (k = 0, n = 1; n <= frames && k < 2 * frames; k++)
+    {
+        if (k < frames)
+        {
+            TST_CHK_API(ctrl_comp_next_input(p_adev, p_comp[0], &p_buf), "ctrl_comp_next_input");
+
+            CTRL_CHK(p_buf == inbuf[0] || p_buf == inbuf[1], "graph: head got foreign buffer %p\n", p_buf);
+
+            p_pcm = (short *)p_buf;
+            for (i = 0; i < PCM_GAIN_FRAME_SIZE / 2; i++)
+            {
+                p_pcm[i] = (short)(k + 1);
+            }
+
+            TST_CHK_API(xaf_comp_process(p_adev, p_comp[0], p_buf, PCM_GAIN_FRAME_SIZE, XAF_INPUT_READY_FLAG), "xaf_comp_process");
+        }
+
+        TST_CHK_API(xaf_comp_get_status(p_adev, p_comp[num_comp - 1], &status, &info[0]), "xaf_comp_get_status");
+
+        CTRL_CHK(status == XAF_OUTPUT_READY && info[1] == PCM_GAIN_FRAME_SIZE, "graph: tail status %d, %d bytes\n", status, info[1]);
+        if (status != XAF_OUTPUT_READY) break;
+
+        p_pcm = (short *)info[0];
+        if (p_pcm[0] != 0 || n > 1)
+        {
+            CTRL_CHK(p_pcm[0] == n && p_pcm[info[1] / 2 - 1] == n, "graph: frame %d out of tail holds %d..%d\n", n, p_pcm[0], p_pcm[info[1] / 2 - 1]);
+            n++;
+        }
+
+        TST_CHK_API(xaf_comp_process(p_adev, p_comp[num_comp - 1], (void *)info[0], info[1], XAF_NEED_OUTPUT_FLAG), "xaf_comp_process");
+    }
+
+    CTRL_CHK(n > frames, "graph: %d of %d frames out of tail\n", n - 1, frames);
+
+    TST_CHK_API(xaf_graph_delete(&desc, p_comp), "xaf_graph_delete");
+    TST_CHK_API(xaf_get_mem_stats(p_adev, &mem[2][0]), "xaf_get_mem_stats");
+
+    CTRL_CHK(mem[2][3] == mem[0][3] && mem[2][4] == mem[0][4], "graph: memory not released: local %d -> %d, shared %d -> %d\n",
+        mem[0][3], mem[2][3], mem[0][4], mem[2][4]);
+
+    TST_CHK_API(xaf_adev_close(p_adev, XAF_ADEV_NORMAL_CLOSE), "xaf_adev_close");
+
+    return errors;
+}
+
+typedef struct ctrl_close_s {
+    volatile int calls;
+    volatile int deleting;
+    volatile int queued;
+    volatile int deleted;
+    volatile int late;
+} ctrl_close_t;
+
+/* ...completion callback slow enough for responses to queue up behind it on the dispatcher */
+static void ctrl_close_cb(void *p_comp, void *cb_data)
+{
+    ctrl_close_t *close = (ctrl_close_t *)cb_data;
+
+    close->late += (close->deleted != 0);
+    close->queued += (close->deleting != 0);
+    close->calls++;
+
+    __xf_thread_sleep_msec(CTRL_CB_SLEEP_MSEC);
+}
+
+/* ...with responses sharded over dispatcher threads, input buffers of every component come back in
+ * the order they were submitted; a component deleted with responses still queued gets no callback
+ * once the delete returns, and a component reusing its client id streams normally */
+static int ctrl_dispatch(int num_comp, int frames, int dispatch)
+{
+    void *p_adev = NULL;
+    void *p_comp[CTRL_MAX_COMP];
+    void *inbuf[CTRL_MAX_COMP][2];
+    void *fifo[CTRL_MAX_COMP][2];
+    void *p_close;
+    void *close_inbuf[2];
+    void *p_buf;
+    ctrl_close_t close[2];
+    xaf_adev_config_t adev_config;
+    int errors = 0;
+    int i, k;
+
+    TST_CHK_API(xaf_adev_config_default_init(&adev_config), "xaf_adev_config_default_init");
+    adev_config.proxy_dispatch_threads = dispatch;
+    TST_CHK_API(ctrl_adev_open(&p_adev, &adev_config, num_comp + 1), "ctrl_adev_open");
+
+    for (i = 0; i < num_comp; i++)
+    {
+        TST_CHK_API(ctrl_comp_create(p_adev, &p_comp[i], &inbuf[i][0]), "ctrl_comp_create");
+        TST_CHK_API(xaf_comp_process(p_adev, p_comp[i], NULL, 0, XAF_EXEC_FLAG), "xaf_comp_process");
+    }
+
+    /* ...the first two buffers returned set the submission order of a component */
+    for (k = 0; k < frames; k++)
+    {
+        for (i = 0; i < num_comp; i++)
+        {
+            TST_CHK_API(ctrl_comp_next_input(p_adev, p_comp[i], &p_buf), "ctrl_comp_next_input");
+
+            CTRL_CHK(k < 2 || p_buf == fifo[i][k % 2], "dispatch: component %d frame %d got %p, submitted %p first\n", i, k, p_buf, fifo[i][k % 2]);
+            fifo[i][k % 2] = p_buf;
+
+            TST_CHK_API(xaf_comp_process(p_adev, p_comp[i], p_buf, PCM_GAIN_FRAME_SIZE, XAF_INPUT_READY_FLAG), "xaf_comp_process");
+        }
+    }
+
+    /* ...delete returns only after the responses already queued for the component are delivered */
+    memset(close, 0, sizeof(close));
+
+    TST_CHK_API(ctrl_comp_create(p_adev, &p_close, &close_inbuf[0]), "ctrl_comp_create");
+    TST_CHK_API(xaf_comp_set_completion_cb(p_close, ctrl_close_cb, (void *)&close[0]), "xaf_comp_set_completion_cb");
+    TST_CHK_API(xaf_comp_process(p_adev, p_close, NULL, 0, XAF_EXEC_FLAG), "xaf_comp_process");
+
+    close[0].deleting = 1;
+    TST_CHK_API(xaf_comp_delete(p_close), "xaf_comp_delete");
+    close[0].deleted = 1;
+
+    CTRL_CHK(close[0].queued > 0, "dispatch: no responses were queued on delete, %d callbacks\n", close[0].calls);
+
+    /* ...the client id is free again */
+    TST_CHK_API(ctrl_comp_create(p_adev, &p_close, &close_inbuf[0]), "ctrl_comp_create");
+    TST_CHK_API(xaf_comp_set_completion_cb(p_close, ctrl_close_cb, (void *)&close[1]), "xaf_comp_set_completion_cb");
+    TST_CHK_API(xaf_comp_process(p_adev, p_close, NULL, 0, XAF_EXEC_FLAG), "xaf_comp_process");
+
+    for (k = 0; k < frames; k++)
+    {
+        TST_CHK_API(ctrl_comp_next_input(p_adev, p_close, &p_buf), "ctrl_comp_next_input");
+
+        CTRL_CHK(p_buf == close_inbuf[0] || p_buf == close_inbuf[1], "dispatch: reused client got foreign buffer %p\n", p_buf);
+
+        TST_CHK_API(xaf_comp_process(p_adev, p_close, p_buf, PCM_GAIN_FRAME_SIZE, XAF_INPUT_READY_FLAG), "xaf_comp_process");
+    }
+
+    close[1].deleting = 1;
+    TST_CHK_API(xaf_comp_delete(p_close), "xaf_comp_delete");
+
+    CTRL_CHK(close[1].calls >= frames, "dispatch: %d callbacks for %d frames of reused client\n", close[1].calls, frames);
+    CTRL_CHK(close[0].late == 0, "dispatch: %d callbacks after delete\n", close[0].late);
+
+    for (i = num_comp - 1; i >= 0; i--)
+    {
+        TST_CHK_API(xaf_comp_delete(p_comp[i]), "xaf_comp_delete");
+    }
+
+    TST_CHK_API(xaf_adev_close(p_adev, XAF_ADEV_NORMAL_CLOSE), "xaf_adev_close");
+
+    return errors;
+}
+
+/* ...a component reset in place after its stream has ended takes its new parameters without
+ * leaking memory and streams again; a component feeding a peer can not be reset */
+static int ctrl_reset(int frames)
+{
+    void *p_adev = NULL;
+    void *p_comp[2];
+    void *inbuf[2];
+    void *p_buf;
+    xaf_adev_config_t adev_config;
+    xaf_comp_status status;
+    WORD32 mem[2][5];
+    int param[10];
+    int info[4];
+    int errors = 0;
+    int k, ret;
+
+    TST_CHK_API(xaf_adev_config_default_init(&adev_config), "xaf_adev_config_default_init");
+    TST_CHK_API(ctrl_adev_open(&p_adev, &adev_config, 2), "ctrl_adev_open");
+
+    TST_CHK_API(ctrl_comp_create(p_adev, &p_comp[0], &inbuf[0]), "ctrl_comp_create");
+    TST_CHK_API(xaf_comp_process(p_adev, p_comp[0], NULL, 0, XAF_EXEC_FLAG), "xaf_comp_process");
+
+    for (k = 0; k < frames; k++)
+    {
+        TST_CHK_API(ctrl_comp_next_input(p_adev, p_comp[0], &p_buf), "ctrl_comp_next_input");
+        TST_CHK_API(xaf_comp_process(p_adev, p_comp[0], p_buf, PCM_GAIN_FRAME_SIZE, XAF_INPUT_READY_FLAG), "xaf_comp_process");
+    }
+
+    /* ...end of stream; returned input buffers are kept */
+    TST_CHK_API(xaf_comp_process(p_adev, p_comp[0], NULL, 0, XAF_INPUT_OVER_FLAG), "xaf_comp_process");
+
+    do
+    {
+        TST_CHK_API(xaf_comp_get_status(p_adev, p_comp[0], &status, &info[0]), "xaf_comp_get_status");
+
+        if (status == XAF_OUTPUT_READY)
+        {
+            TST_CHK_API(xaf_comp_process(p_adev, p_comp[0], (void *)info[0], info[1], XAF_NEED_OUTPUT_FLAG), "xaf_comp_process");
+        }
+        else if (status != XAF_NEED_INPUT && status != XAF_EXEC_DONE)
+        {
+            FIO_PRINTF(stderr, "Unexpected status:%d\n", status);
+            return -1;
+        }
+    }
+    while (status != XAF_EXEC_DONE);
+
+    TST_CHK_API(xaf_get_mem_stats(p_adev, &mem[0][0]), "xaf_get_mem_stats");
+
+    /* ...reset restores the plugin defaults; pass the whole configuration */
+    param[0] = XA_PCM_GAIN_CONFIG_PARAM_CHANNELS;
+    param[1] = PCM_GAIN_NUM_CH;
+    param[2] = XA_PCM_GAIN_CONFIG_PARAM_SAMPLE_RATE;
+    param[3] = 48000;
+    param[4] = XA_PCM_GAIN_CONFIG_PARAM_PCM_WIDTH;
+    param[5] = PCM_GAIN_SAMPLE_WIDTH;
+    param[6] = XA_PCM_GAIN_CONFIG_PARAM_FRAME_SIZE;
+    param[7] = PCM_GAIN_FRAME_SIZE;
+    param[8] = XA_PCM_GAIN_CONFIG_PARAM_GAIN_FACTOR;
+    param[9] = 2;
+
+    TST_CHK_API(xaf_comp_reset(p_comp[0], 5, &param[0]), "xaf_comp_reset");
+    TST_CHK_API(ctrl_comp_start(p_adev, p_comp[0], inbuf, 1), "ctrl_comp_start");
+
+    TST_CHK_API(xaf_get_mem_stats(p_adev, &mem[1][0]), "xaf_get_mem_stats");
+
+    /* ...current local and shared memory in use */
+    CTRL_CHK(mem[1][3] == mem[0][3] && mem[1][4] == mem[0][4], "reset: memory changed: local %d -> %d, shared %d -> %d\n",
+        mem[0][3], mem[1][3], mem[0][4], mem[1][4]);
+
+    /* ...gain index 2 is -12 dB */
+    param[1] = param[3] = 0;
+    param[0] = XA_PCM_GAIN_CONFIG_PARAM_SAMPLE_RATE;
+    param[2] = XA_PCM_GAIN_CONFIG_PARAM_GAIN_FACTOR;
+    TST_CHK_API(xaf_comp_get_config(p_comp[0], 2, &param[0]), "xaf_comp_get_config");
+
+    CTRL_CHK(param[1] == 48000 && param[3] == -12, "reset: sample rate %d, gain %d dB after reset\n", param[1], param[3]);
+
+    TST_CHK_API(xaf_comp_process(p_adev, p_comp[0], NULL, 0, XAF_EXEC_FLAG), "xaf_comp_process");
+
+    for (k = 0; k < frames; k++)
+    {
+        TST_CHK_API(ctrl_comp_next_input(p_adev, p_comp[0], &p_buf), "ctrl_comp_next_input");
+
+        CTRL_CHK(p_buf == inbuf[0] || p_buf == inbuf[1], "reset: foreign buffer %p after restart\n", p_buf);
+
+        TST_CHK_API(xaf_comp_process(p_adev, p_comp[0], p_buf, PCM_GAIN_FRAME_SIZE, XAF_INPUT_READY_FLAG), "xaf_comp_process");
+    }
+
+    TST_CHK_API(xaf_comp_delete(p_comp[0]), "xaf_comp_delete");
+
+    /* ...the peer's runtime initialization depends on the connected output */
+    TST_CHK_API(ctrl_comp_create(p_adev, &p_comp[0], &inbuf[0]), "ctrl_comp_create");
+    TST_CHK_API_COMP_CREATE(p_adev, &p_comp[1], "post-proc/pcm_gain", 0, 1, NULL, XAF_POST_PROC, "xaf_comp_create");
+    TST_CHK_API(pcm_gain_setup(p_comp[1]), "pcm_gain_setup");
+    TST_CHK_API(xaf_connect(p_comp[0], 1, p_comp[1], 0, XAF_GRAPH_CONN_BUFS), "xaf_connect");
+
+    ret = xaf_comp_reset(p_comp[0], 5, &param[0]);
+    CTRL_CHK(ret == XAF_ROUTING_ERR, "reset: connected component returned %d\n", ret);
+
+    TST_CHK_API(xaf_comp_delete(p_comp[1]), "xaf_comp_delete");
+    TST_CHK_API(xaf_comp_delete(p_comp[0]), "xaf_comp_delete");
+
+    TST_CHK_API(xaf_adev_close(p_adev, XAF_ADEV_NORMAL_CLOSE), "xaf_adev_close");
+
+    return errors;
+}
+
+void fio_quit()
+{
+    return;
+}
+
+int main_task(int argc, char **argv)
+{
+    void *p_adev = NULL;
+    pUWORD8 ver_info[3] = {0,0,0};    //{ver,lib_rev,api_rev}
+    unsigned short board_id = 0;
+    mem_obj_t* mem_handle;
+    int errors = 0, ret;
+
+    // NOTE: set_wbna() should be called before any other dynamic
+    // adjustment of the region attributes for cache.
+    set_wbna(&argc, argv);
+
+    /* ...start xos */
+    board_id = start_rtos();
+
+    /* ...get xaf version info*/
+    TST_CHK_API(xaf_get_verinfo(ver_info), "xaf_get_verinfo");
+
+    /* ...show xaf version info*/
+    TST_CHK_API(print_verinfo(ver_info,(pUWORD8)"\'Control Path\'"), "print_verinfo");
+
+    /* ...initialize tracing facility */
+    TRACE_INIT("Xtensa Audio Framework - \'Control Path\' Sample App");
+
+    /* ...check input arguments */
+    if (argc > 1)
+    {
+        PRINT_USAGE;
+        return 0;
+    }
+
+    mem_handle = mem_init();
+
+    TST_CHK_API((ret = ctrl_delete(CTRL_MAX_COMP, CTRL_FRAMES)), "ctrl_delete");
+    errors += ret;
+
+    TST_CHK_API((ret = ctrl_backpressure(CTRL_MAX_COMP, CTRL_FRAMES, CTRL_QUEUE_DEPTH)), "ctrl_backpressure");
+    errors += ret;
+
+    TST_CHK_API((ret = ctrl_doorbell(CTRL_BATCH_COMP, CTRL_FRAMES, 0)), "ctrl_doorbell");
+    errors += ret;
+    TST_CHK_API((ret = ctrl_doorbell(CTRL_BATCH_COMP, CTRL_FRAMES, 1)), "ctrl_doorbell");
+    errors += ret;
+
+    TST_CHK_API((ret = ctrl_wait_any(CTRL_MAX_COMP, CTRL_FRAMES)), "ctrl_wait_any");
+    errors += ret;
+
+    TST_CHK_API((ret = ctrl_feeders(CTRL_FEEDERS, CTRL_FRAMES, 0)), "ctrl_feeders");
+    errors += ret;
+
+    TST_CHK_API((ret = ctrl_txn()), "ctrl_txn");
+    errors += ret;
+
+    TST_CHK_API((ret = ctrl_graph(CTRL_GRAPH_COMP, CTRL_FRAMES)), "ctrl_graph");
+    errors += ret;
+
+    TST_CHK_API((ret = ctrl_feeders(CTRL_FEEDERS, CTRL_FRAMES, CTRL_DISPATCH_THREADS)), "ctrl_feeders");
+    errors += ret;
+    TST_CHK_API((ret = ctrl_dispatch(CTRL_FEEDERS, CTRL_FRAMES, CTRL_DISPATCH_THREADS)), "ctrl_dispatch");
+    errors += ret;
+
+    TST_CHK_API((ret = ctrl_reset(CTRL_FRAMES)), "ctrl_reset");
+    errors += ret;
+
+    (void)p_adev;
+    (void)board_id;
+    (void)mem_handle;
+    mem_exit();
+
+    fio_quit();
+
+    /* ...deinitialize tracing facility */
+    TRACE_DEINIT();
+
+    if (errors)
+    {
+        FIO_PRINTF(stderr, "Control path FAILED: %d of %d checks\n", errors, checks);
+        return -1;
+    }
+
+    FIO_PRINTF(stdout, "Control path PASSED: %d checks\n", checks);
+
+    return 0;
+}
@@ -85,6 +85,7 @@ XA_ERRORCODE xa_aac_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pV
 XA_ERRORCODE xa_mixer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
 XA_ERRORCODE xa_mp3_encoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
 XA_ERRORCODE xa_src_pp_fx(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_src_poly(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
 XA_ERRORCODE xa_renderer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
 XA_ERRORCODE xa_capturer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
 XA_ERRORCODE xa_amr_wb_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
@@ -94,6 +95,8 @@ XA_ERRORCODE xa_vorbis_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3,
 XA_ERRORCODE xa_dummy_aec22(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
 XA_ERRORCODE xa_dummy_aec23(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
 XA_ERRORCODE xa_pcm_split(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_pcm_split14(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_pcm_split18(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
 ///XA_ERRORCODE xa_mimo_mix(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
 XA_ERRORCODE xa_dummy_wwd(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
 XA_ERRORCODE xa_dummy_hbuf(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
@@ -564,7 +567,14 @@ int main_task(int argc, char **argv)
 
 #ifndef XA_DISABLE_EVENT
     TST_CHK_API(xaf_create_event_channel(p_comp[XA_MIMO21_0], XA_MIMO_MIX_CONFIG_PARAM_EVENT_GAIN_FACTOR, p_comp[XA_GAIN0], XA_PCM_GAIN_CONFIG_PARAM_EVENT_GAIN_FACTOR, 4, 4), "xaf_create_event_channel");
-    TST_CHK_API(xaf_create_event_channel(p_comp[XA_MIMO21_0], XA_MIMO_MIX_CONFIG_PARAM_EVENT_GAIN_FACTOR, p_comp[XA_GAIN1], XA_PCM_GAIN_CONFIG_PARAM_EVENT_GAIN_FACTOR, 4, 4), "xaf_create_event_channel");
+    {
+        /* ...second gain only needs the latest factor; pending events are merged */
+        xaf_event_channel_config_t event_cfg;
+
+        memset(&event_cfg, 0, sizeof(event_cfg));
+        event_cfg.coalesce_mode = XAF_EVENT_COALESCE_LATEST;
+        TST_CHK_API(xaf_create_event_channel_ext(p_comp[XA_MIMO21_0], XA_MIMO_MIX_CONFIG_PARAM_EVENT_GAIN_FACTOR, p_comp[XA_GAIN1], XA_PCM_GAIN_CONFIG_PARAM_EVENT_GAIN_FACTOR, 1, 4, &event_cfg), "xaf_create_event_channel_ext");
+    }
 #endif
 
 #ifdef XAF_PROFILE
@@ -626,6 +636,16 @@ int main_task(int argc, char **argv)
             FIO_PRINTF(stderr,"Local Memory used by Framework, in bytes                 : %8d\n", meminfo[2]);
         }
     }
+
+    {
+        /* report single-arena graph memory plan against per-call allocation */
+        xaf_mem_plan_t mem_plan;
+        if(xaf_get_mem_plan(p_adev, &mem_plan) == XAF_NO_ERR)
+        {
+            FIO_PRINTF(stderr,"Graph memory plan, in bytes: persist=%d io=%d route=%d scratch=%d\n", mem_plan.persist_size, mem_plan.io_size, mem_plan.route_size, mem_plan.scratch_size);
+            FIO_PRINTF(stderr,"Graph memory planned (single arena) : %8d, actual (per-call allocation) : %8d\n", mem_plan.planned_size, mem_plan.actual_size);
+        }
+    }
     /* ...exec done, clean-up */
     for(k=0; k<(NUM_THREADS);k++)
     {
@@ -634,6 +654,17 @@ int main_task(int argc, char **argv)
     }
 
 #ifndef XA_DISABLE_EVENT
+    {
+        /* ...both channels share the source and destination parameters, only the destination differs */
+        xaf_event_channel_stats_t event_stats;
+
+        for (k = XA_GAIN0; k <= XA_GAIN1; k++)
+        {
+            TST_CHK_API(xaf_get_event_channel_stats(p_comp[XA_MIMO21_0], XA_MIMO_MIX_CONFIG_PARAM_EVENT_GAIN_FACTOR, p_comp[k], XA_PCM_GAIN_CONFIG_PARAM_EVENT_GAIN_FACTOR, &event_stats), "xaf_get_event_channel_stats");
+            FIO_PRINTF(stderr, "Event channel to component %d: delivered=%u merged=%u dropped=%u\n", k, event_stats.delivered, event_stats.merged, event_stats.dropped);
+        }
+    }
+
     TST_CHK_API(xaf_delete_event_channel(p_comp[XA_MIMO21_0], XA_MIMO_MIX_CONFIG_PARAM_EVENT_GAIN_FACTOR, p_comp[XA_GAIN0], XA_PCM_GAIN_CONFIG_PARAM_EVENT_GAIN_FACTOR), "xaf_delete_event_channel");
     TST_CHK_API(xaf_delete_event_channel(p_comp[XA_MIMO21_0], XA_MIMO_MIX_CONFIG_PARAM_EVENT_GAIN_FACTOR, p_comp[XA_GAIN1], XA_PCM_GAIN_CONFIG_PARAM_EVENT_GAIN_FACTOR), "xaf_delete_event_channel");
 #endif
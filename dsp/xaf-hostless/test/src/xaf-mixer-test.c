@@ -0,0 +1,570 @@
+/*
+* Copyright (c) 2015-2022 Cadence Design Systems Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to deal in the Software without restriction, including
+* without limitation the rights to use, copy, modify, merge, publish,
+* distribute, sublicense, and/or sell copies of the Software, and to
+* permit persons to whom the Software is furnished to do so, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "audio/xa-pcm-gain-api.h"
+#include "audio/xa-mixer-api.h"
+#include "xaf-utils-test.h"
+#include "xaf-fio-test.h"
+
+/* mixer test: XA_MIXER_MAX_TRACK_NUMBER (16) constant tracks are fed through 0 dB pcm-gain components into
+ * the mixer, one frame at a time, for 16-bit stereo, 24-bit 6-channel and 32-bit 8-channel formats; the output must match the
+ * per-track, per-channel and master volumes exactly, and a volume ramp must glide monotonically over
+ * XA_MIXER_CONFIG_PARAM_RAMP_LENGTH samples and land exactly on the new mix */
+
+#define PRINT_USAGE FIO_PRINTF(stdout, "\nUsage: %s\n\n", argv[0]);
+
+#define AUDIO_FRMWK_BUF_SIZE   (256 << 10)
+#define AUDIO_COMP_BUF_SIZE    (1024 << 10)
+
+//component parameters
+#define MIX_SAMPLE_RATE         48000
+/* ...8 channels of 32-bit samples fit in an application input buffer */
+#define MIX_FRAME_SIZE          120
+#define MIX_TRACKS              XA_MIXER_MAX_TRACK_NUMBER
+
+/* ...frames before and after the volume change; the ramp spans frame boundaries */
+#define MIX_FRAMES_STEADY       3
+#define MIX_FRAMES_RAMP         4
+#define MIX_RAMP_LENGTH         (MIX_FRAME_SIZE * 3 / 2)
+
+#define MIX_FRAME_BYTES(f)      (MIX_FRAME_SIZE * (f)->channels * ((f)->pcm_width == 16 ? 2 : 4))
+
+unsigned int num_bytes_read, num_bytes_write;
+extern int audio_frmwk_buf_size;
+extern int audio_comp_buf_size;
+double strm_duration;
+
+#ifdef XAF_PROFILE
+    extern long long tot_cycles, frmwk_cycles, fread_cycles, fwrite_cycles;
+    extern long long dsp_comps_cycles, pcm_gain_cycles, mix_cycles;
+    extern double dsp_mcps;
+#endif
+
+/* Dummy unused functions */
+XA_ERRORCODE xa_mp3_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_aac_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_mp3_encoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_src_pp_fx(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_src_poly(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_renderer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_capturer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_amr_wb_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_hotword_decoder(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value){return 0;}
+XA_ERRORCODE xa_vorbis_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_dummy_aec22(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_dummy_aec23(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_pcm_split(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_pcm_split14(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_pcm_split18(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_mimo_mix(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_dummy_wwd(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_dummy_hbuf(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_opus_encoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_dummy_wwd_msg(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_dummy_hbuf_msg(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_opus_decoder(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_microspeech_fe(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_microspeech_inference(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_person_detect_inference(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_keyword_detection_inference(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+
+static const struct
+{
+    int pcm_width;
+    int channels;
+
+} mix_formats[] = {
+    { 16, 2 },
+    { 24, 6 },
+    { 32, 8 },
+};
+
+/* ...initial volumes (Q12) of all channels of a track, repeated over the tracks */
+static const int mix_track_volume[4] = { 4096, 2048, 1024, 3072 };
+
+typedef struct mix_graph
+{
+    void   *p_adev;
+    void   *p_gain[MIX_TRACKS];
+    void   *p_mixer;
+    void   *inbuf[MIX_TRACKS][2];
+    void   *free[MIX_TRACKS][2];
+    int     nfree[MIX_TRACKS];
+    int     pcm_width;
+    int     channels;
+    int     done;
+
+    /* ...volumes in effect, track MIX_TRACKS is the master */
+    int     volume[MIX_TRACKS + 1][XA_MIXER_MAX_CHANNELS];
+
+} mix_graph_t;
+
+/* ...constant input sample of a track channel; 24-bit samples are MSB-aligned in 32 bits;
+ * the mix of all tracks stays below saturation */
+static int mix_input(mix_graph_t *g, int t, int c)
+{
+    int x = (t + 1) * (c + 1) * 50;
+
+    return (g->pcm_width == 16 ? x : x << 14);
+}
+
+/* ...expected output of a channel for the volumes in effect */
+static int mix_expected(mix_graph_t *g, int c)
+{
+    long long acc = 0, v;
+    long long max = (g->pcm_width == 16 ? 0x7FFF : (g->pcm_width == 24 ? 0x7FFFFF00 : 0x7FFFFFFF));
+    int t;
+
+    for (t = 0; t < MIX_TRACKS; t++)
+    {
+        acc += ((long long)mix_input(g, t, c) * g->volume[t][c]) >> 12;
+    }
+
+    v = (acc * g->volume[MIX_TRACKS][c]) >> 12;
+    v = (v > max ? max : v);
+
+    return (int)(g->pcm_width == 24 ? v & ~0xFF : v);
+}
+
+static int mix_output(mix_graph_t *g, void *p_buf, int i)
+{
+    return (g->pcm_width == 16 ? ((short *)p_buf)[i] : ((int *)p_buf)[i]);
+}
+
+static int mix_set_param(void *p_comp, int param_id, int value)
+{
+    int param[2];
+
+    param[0] = param_id;
+    param[1] = value;
+
+    return(xaf_comp_set_config(p_comp, 1, &param[0]));
+}
+
+/* ...set volume of a track (or master) channel and record it for the reference */
+static int mix_set_volume(mix_graph_t *g, int t, int c, int volume)
+{
+    int k;
+
+    for (k = 0; k < g->channels; k++)
+    {
+        if (c == XA_MIXER_VOLUME_ALL_CHANNELS || c == k)
+        {
+            g->volume[t][k] = volume;
+        }
+    }
+
+    return(mix_set_param(g->p_mixer, XA_MIXER_CONFIG_PARAM_VOLUME, XA_MIXER_VOLUME(t, c, (double)volume / 4096)));
+}
+
+static int pcm_gain_setup(void *p_comp, mix_graph_t *g)
+{
+    int param[8];
+
+    param[0] = XA_PCM_GAIN_CONFIG_PARAM_CHANNELS;
+    param[1] = g->channels;
+    param[2] = XA_PCM_GAIN_CONFIG_PARAM_SAMPLE_RATE;
+    param[3] = MIX_SAMPLE_RATE;
+    param[4] = XA_PCM_GAIN_CONFIG_PARAM_PCM_WIDTH;
+    param[5] = g->pcm_width;
+    param[6] = XA_PCM_GAIN_CONFIG_PARAM_FRAME_SIZE;
+    param[7] = MIX_FRAME_BYTES(g);
+
+    return(xaf_comp_set_config(p_comp, 4, &param[0]));
+}
+
+static int mixer_setup(void *p_comp, mix_graph_t *g)
+{
+    int param[8];
+
+    param[0] = XA_MIXER_CONFIG_PARAM_SAMPLE_RATE;
+    param[1] = MIX_SAMPLE_RATE;
+    param[2] = XA_MIXER_CONFIG_PARAM_CHANNELS;
+    param[3] = g->channels;
+    param[4] = XA_MIXER_CONFIG_PARAM_PCM_WIDTH;
+    param[5] = g->pcm_width;
+    param[6] = XA_MIXER_CONFIG_PARAM_FRAME_SIZE_IN_SAMPLES;
+    param[7] = MIX_FRAME_SIZE;
+
+    return(xaf_comp_set_config(p_comp, 4, &param[0]));
+}
+
+static int mix_comp_start(void *p_adev, void *p_comp)
+{
+    xaf_comp_status status;
+    int info[4];
+
+    TST_CHK_API(xaf_comp_process(p_adev, p_comp, NULL, 0, XAF_START_FLAG), "xaf_comp_process");
+    TST_CHK_API(xaf_comp_get_status(p_adev, p_comp, &status, &info[0]), "xaf_comp_get_status");
+
+    if (status != XAF_INIT_DONE)
+    {
+        FIO_PRINTF(stderr, "Failed to init, status:%d\n", status);
+        return -1;
+    }
+
+    return 0;
+}
+
+/* ...handle one response; mixer output is copied to p_out (if any) and 1 is returned */
+static int mix_wait(mix_graph_t *g, void *p_out)
+{
+    void *p_adev = g->p_adev;
+    void *p_ready;
+    xaf_comp_status status;
+    int info[4];
+    int t;
+
+    TST_CHK_API(xaf_comp_wait_any(p_adev, &p_ready), "xaf_comp_wait_any");
+
+    /* ...response is already delivered, so this does not block */
+    TST_CHK_API(xaf_comp_get_status(p_adev, p_ready, &status, &info[0]), "xaf_comp_get_status");
+
+    if (status == XAF_EXEC_DONE)
+    {
+        g->done++;
+        return 0;
+    }
+
+    for (t = 0; t < MIX_TRACKS; t++)
+    {
+        if (g->p_gain[t] == p_ready) break;
+    }
+
+    if (t < MIX_TRACKS && status == XAF_NEED_INPUT)
+    {
+        if (info[0] && g->nfree[t] < 2)
+        {
+            g->free[t][g->nfree[t]++] = (void *)info[0];
+        }
+        return 0;
+    }
+    else if (p_ready == g->p_mixer && status == XAF_OUTPUT_READY)
+    {
+        if (p_out)
+        {
+            if (info[1] != MIX_FRAME_BYTES(g))
+            {
+                FIO_PRINTF(stderr, "Unexpected output length %d\n", info[1]);
+                return -1;
+            }
+            memcpy(p_out, (void *)info[0], info[1]);
+        }
+
+        TST_CHK_API(xaf_comp_process(p_adev, p_ready, (void *)info[0], info[1], XAF_NEED_OUTPUT_FLAG), "xaf_comp_process");
+        return 1;
+    }
+
+    FIO_PRINTF(stderr, "Unexpected status:%d\n", status);
+    return -1;
+}
+
+/* ...feed one frame to every track */
+static int mix_feed(mix_graph_t *g)
+{
+    void *p_adev = g->p_adev;
+    void *p_buf;
+    int t, i, c, ret;
+
+    for (t = 0; t < MIX_TRACKS; t++)
+    {
+        while (g->nfree[t] == 0)
+        {
+            if ((ret = mix_wait(g, NULL)) != 0)
+            {
+                FIO_PRINTF(stderr, "Mixer output before all tracks were fed\n");
+                return -1;
+            }
+        }
+
+        p_buf = g->free[t][--g->nfree[t]];
+
+        for (i = 0; i < MIX_FRAME_SIZE; i++)
+        {
+            for (c = 0; c < g->channels; c++)
+            {
+                if (g->pcm_width == 16)
+                    ((short *)p_buf)[i * g->channels + c] = (short)mix_input(g, t, c);
+                else
+                    ((int *)p_buf)[i * g->channels + c] = mix_input(g, t, c);
+            }
+        }
+
+        TST_CHK_API(xaf_comp_process(p_adev, g->p_gain[t], p_buf, MIX_FRAME_BYTES(g), XAF_INPUT_READY_FLAG), "xaf_comp_process");
+    }
+
+    return 0;
+}
+
+/* ...feed one frame to every track and collect the mixed frame; nothing is left in flight */
+static int mix_step(mix_graph_t *g, void *p_out, int feed)
+{
+    int ret;
+
+    if (feed && (ret = mix_feed(g)) < 0)
+    {
+        return ret;
+    }
+
+    while ((ret = mix_wait(g, p_out)) == 0);
+
+    return (ret < 0 ? ret : 0);
+}
+
+/* ...run one format; returns the number of failed checks */
+static int mix_run(void *p_adev, int f)
+{
+    mix_graph_t g;
+    void *p_out;
+    int expect[2][XA_MIXER_MAX_CHANNELS];
+    int errors = 0, last[XA_MIXER_MAX_CHANNELS];
+    int frame, t, c, i, s, y;
+
+    memset(&g, 0, sizeof(g));
+    g.p_adev = p_adev;
+    g.pcm_width = mix_formats[f].pcm_width;
+    g.channels = mix_formats[f].channels;
+
+    TST_CHK_PTR((p_out = malloc(MIX_FRAME_BYTES(&g))), "malloc");
+
+    TST_CHK_API_COMP_CREATE(p_adev, &g.p_mixer, "mixer", 0, 1, NULL, XAF_MIXER, "xaf_comp_create");
+    TST_CHK_API(mixer_setup(g.p_mixer, &g), "mixer_setup");
+
+    /* ...application feeds every track through a 0 dB pcm-gain */
+    for (t = 0; t < MIX_TRACKS; t++)
+    {
+        TST_CHK_API_COMP_CREATE(p_adev, &g.p_gain[t], "post-proc/pcm_gain", 2, 0, &g.inbuf[t][0], XAF_POST_PROC, "xaf_comp_create");
+        TST_CHK_API(pcm_gain_setup(g.p_gain[t], &g), "pcm_gain_setup");
+        TST_CHK_API(mix_comp_start(p_adev, g.p_gain[t]), "mix_comp_start");
+        TST_CHK_API(xaf_connect(g.p_gain[t], 1, g.p_mixer, t, 4), "xaf_connect");
+
+        g.free[t][0] = g.inbuf[t][0];
+        g.free[t][1] = g.inbuf[t][1];
+        g.nfree[t] = 2;
+    }
+
+    TST_CHK_API(mix_comp_start(p_adev, g.p_mixer), "mix_comp_start");
+
+    /* ...track volumes for all channels, one channel of each track and one master channel differ */
+    for (c = 0; c < g.channels; c++)
+    {
+        g.volume[MIX_TRACKS][c] = 4096;
+    }
+    for (t = 0; t < MIX_TRACKS; t++)
+    {
+        TST_CHK_API(mix_set_volume(&g, t, XA_MIXER_VOLUME_ALL_CHANNELS, mix_track_volume[t % 4]), "mix_set_volume");
+        TST_CHK_API(mix_set_volume(&g, t, t % g.channels, 512 * (t + 1)), "mix_set_volume");
+    }
+    TST_CHK_API(mix_set_volume(&g, MIX_TRACKS, g.channels - 1, 2048), "mix_set_volume");
+
+    for (t = 0; t < MIX_TRACKS; t++)
+    {
+        TST_CHK_API(xaf_comp_process(p_adev, g.p_gain[t], NULL, 0, XAF_EXEC_FLAG), "xaf_comp_process");
+    }
+
+    /* ...a track joins the mix with its first data, so every track gets the first frame before the
+       mixer receives an output buffer; then each output mixes all tracks */
+    TST_CHK_API(mix_feed(&g), "mix_feed");
+
+    for (t = 0; t < MIX_TRACKS; t++)
+    {
+        while (g.nfree[t] < 2)
+        {
+            if (mix_wait(&g, NULL) != 0) return -1;
+        }
+    }
+
+    TST_CHK_API(xaf_comp_process(p_adev, g.p_mixer, NULL, 0, XAF_EXEC_FLAG), "xaf_comp_process");
+
+    for (c = 0; c < g.channels; c++)
+    {
+        expect[0][c] = mix_expected(&g, c);
+    }
+
+    for (frame = 0; frame < MIX_FRAMES_STEADY; frame++)
+    {
+        TST_CHK_API(mix_step(&g, p_out, frame > 0), "mix_step");
+
+        for (i = 0; i < MIX_FRAME_SIZE * g.channels; i++)
+        {
+            if ((y = mix_output(&g, p_out, i)) != expect[0][i % g.channels])
+            {
+                FIO_PRINTF(stderr, "%d-bit: frame %d channel %d: %d, expected %d\n", g.pcm_width, frame, i % g.channels, y, expect[0][i % g.channels]);
+                errors++;
+                break;
+            }
+        }
+    }
+
+    /* ...fade the first track out; all data sent so far is mixed, so the ramp starts with the next frame */
+    TST_CHK_API(mix_set_param(g.p_mixer, XA_MIXER_CONFIG_PARAM_RAMP_LENGTH, MIX_RAMP_LENGTH), "mix_set_param");
+    TST_CHK_API(mix_set_volume(&g, 0, XA_MIXER_VOLUME_ALL_CHANNELS, 0), "mix_set_volume");
+
+    for (c = 0; c < g.channels; c++)
+    {
+        expect[1][c] = mix_expected(&g, c);
+        last[c] = expect[0][c];
+    }
+
+    for (frame = 0; frame < MIX_FRAMES_RAMP; frame++)
+    {
+        TST_CHK_API(mix_step(&g, p_out, 1), "mix_step");
+
+        for (i = 0; i < MIX_FRAME_SIZE * g.channels; i++)
+        {
+            c = i % g.channels;
+            s = frame * MIX_FRAME_SIZE + i / g.channels;
+            y = mix_output(&g, p_out, i);
+
+            if (s >= MIX_RAMP_LENGTH ? (y != expect[1][c]) : (y > last[c] || y < expect[1][c]))
+            {
+                FIO_PRINTF(stderr, "%d-bit: ramp sample %d channel %d: %d after %d, target %d\n", g.pcm_width, s, c, y, last[c], expect[1][c]);
+                errors++;
+                break;
+            }
+
+            /* ...ramp is linear: half-way through it the output is half-way to the target */
+            if (s == MIX_RAMP_LENGTH / 2)
+            {
+                int mid = expect[0][c] - (expect[0][c] - expect[1][c]) / 2;
+                int tol = (expect[0][c] - expect[1][c]) / 50 + 2;
+
+                if (y > mid + tol || y < mid - tol)
+                {
+                    FIO_PRINTF(stderr, "%d-bit: ramp mid-point channel %d: %d, expected %d\n", g.pcm_width, c, y, mid);
+                    errors++;
+                }
+            }
+
+            last[c] = y;
+        }
+    }
+
+    FIO_PRINTF(stdout, "%d-bit, %d channels, %d tracks: %d frames mixed, %d errors\n", g.pcm_width, g.channels, MIX_TRACKS, MIX_FRAMES_STEADY + MIX_FRAMES_RAMP, errors);
+
+    for (t = 0; t < MIX_TRACKS; t++)
+    {
+        TST_CHK_API(xaf_comp_process(p_adev, g.p_gain[t], NULL, 0, XAF_INPUT_OVER_FLAG), "xaf_comp_process");
+    }
+
+    while (g.done < MIX_TRACKS + 1)
+    {
+        if (mix_wait(&g, NULL) < 0) return -1;
+    }
+
+    for (t = MIX_TRACKS - 1; t >= 0; t--)
+    {
+        TST_CHK_API(xaf_comp_delete(g.p_gain[t]), "xaf_comp_delete");
+    }
+    TST_CHK_API(xaf_comp_delete(g.p_mixer), "xaf_comp_delete");
+
+    free(p_out);
+
+    return errors;
+}
+
+void fio_quit()
+{
+    return;
+}
+
+int main_task(int argc, char **argv)
+{
+    void *p_adev = NULL;
+    pUWORD8 ver_info[3] = {0,0,0};    //{ver,lib_rev,api_rev}
+    unsigned short board_id = 0;
+    mem_obj_t* mem_handle;
+    xaf_adev_config_t adev_config;
+    int errors = 0, ret;
+    int f;
+
+    audio_frmwk_buf_size = AUDIO_FRMWK_BUF_SIZE;
+    audio_comp_buf_size = AUDIO_COMP_BUF_SIZE;
+
+    // NOTE: set_wbna() should be called before any other dynamic
+    // adjustment of the region attributes for cache.
+    set_wbna(&argc, argv);
+
+    /* ...start xos */
+    board_id = start_rtos();
+
+    /* ...get xaf version info*/
+    TST_CHK_API(xaf_get_verinfo(ver_info), "xaf_get_verinfo");
+
+    /* ...show xaf version info*/
+    TST_CHK_API(print_verinfo(ver_info,(pUWORD8)"\'Mixer\'"), "print_verinfo");
+
+    /* ...initialize tracing facility */
+    TRACE_INIT("Xtensa Audio Framework - \'Mixer\' Sample App");
+
+    /* ...check input arguments */
+    if (argc > 1)
+    {
+        PRINT_USAGE;
+        return 0;
+    }
+
+    mem_handle = mem_init();
+
+    TST_CHK_API(xaf_adev_config_default_init(&adev_config), "xaf_adev_config_default_init");
+
+    adev_config.pmem_malloc = mem_malloc;
+    adev_config.pmem_free = mem_free;
+    adev_config.audio_framework_buffer_size = audio_frmwk_buf_size;
+    adev_config.audio_component_buffer_size = audio_comp_buf_size;
+    TST_CHK_API(xaf_adev_open(&p_adev, &adev_config), "xaf_adev_open");
+    FIO_PRINTF(stdout,"Audio Device Ready\n");
+
+    for (f = 0; f < (int)(sizeof(mix_formats) / sizeof(mix_formats[0])); f++)
+    {
+        ret = mix_run(p_adev, f);
+        if (ret < 0)
+        {
+            return ret;
+        }
+        errors += ret;
+    }
+
+    TST_CHK_API(xaf_adev_close(p_adev, XAF_ADEV_NORMAL_CLOSE), "xaf_adev_close");
+    FIO_PRINTF(stdout,"Audio device closed\n\n");
+
+    (void)board_id;
+    (void)mem_handle;
+    mem_exit();
+
+    /* ...deinitialize tracing facility */
+    TRACE_DEINIT();
+
+    if (errors)
+    {
+        FIO_PRINTF(stderr, "Mixer FAILED: %d errors\n", errors);
+        return -1;
+    }
+
+    FIO_PRINTF(stdout, "Mixer PASSED\n");
+
+    return 0;
+}
@@ -0,0 +1,447 @@
+/*
+* Copyright (c) 2015-2022 Cadence Design Systems Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to deal in the Software without restriction, including
+* without limitation the rights to use, copy, modify, merge, publish,
+* distribute, sublicense, and/or sell copies of the Software, and to
+* permit persons to whom the Software is furnished to do so, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include "audio/xa-renderer-api.h"
+#include "audio/xa-capturer-api.h"
+#include "xaf-utils-test.h"
+#include "xaf-fio-test.h"
+
+/* multi-zone throughput: N renderers (and optionally N capturers) running concurrently in one device,
+ * all streams serviced from a single application thread; zone N renders into renderer_out_N.pcm
+ * and captures from capturer_in_N.pcm (zone 0 uses the default file names) */
+
+#define PRINT_USAGE FIO_PRINTF(stdout, "\nUsage: %s [-zones:N (default %d, max %d)] [-frames:N (default %d)] [-capture]\n", argv[0], ZONES_DEFAULT, ZONES_MAX, ZONE_FRAMES);\
+    FIO_PRINTF(stdout, "\nNote: with -capture, zone N expects input file 'capturer_in_N.pcm' ('capturer_in.pcm' for zone 0) in the execution directory.\n\n");
+
+#define ZONES_MAX               8
+#define ZONES_DEFAULT           4
+#define ZONE_FRAMES             200
+
+#define ZONE_SAMPLE_RATE        48000
+#define ZONE_NUM_CH             2
+#define ZONE_PCM_WIDTH          16
+#define ZONE_FRAME_SIZE         480
+#define ZONE_FRAME_BYTES        (ZONE_FRAME_SIZE * ZONE_NUM_CH * (ZONE_PCM_WIDTH >> 3))
+
+/* ...per-component memory is scaled with the number of zones */
+#define AUDIO_FRMWK_BUF_SIZE(n) ((256 << 8) + (n) * (1024 << 4))
+#define AUDIO_COMP_BUF_SIZE(n)  ((1024 << 7) + (n) * (1024 << 6))
+
+unsigned int num_bytes_read, num_bytes_write;
+extern int audio_frmwk_buf_size;
+extern int audio_comp_buf_size;
+double strm_duration;
+
+#ifdef XAF_PROFILE
+    extern long long tot_cycles, frmwk_cycles, fread_cycles, fwrite_cycles;
+    extern long long dsp_comps_cycles, renderer_cycles, capturer_cycles;
+    extern double dsp_mcps;
+#define ZONE_CLK()              clk_read_start(CLK_SELN_WALL)
+#define ZONE_CLK_DIFF(a, b)     clk_diff((a), (b))
+#else
+#define ZONE_CLK()              0
+#define ZONE_CLK_DIFF(a, b)     0
+#endif
+
+/* Dummy unused functions */
+XA_ERRORCODE xa_mp3_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_aac_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_mixer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_mp3_encoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_src_pp_fx(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_src_poly(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_pcm_gain(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_amr_wb_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_hotword_decoder(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value){return 0;}
+XA_ERRORCODE xa_vorbis_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_dummy_aec22(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_dummy_aec23(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_pcm_split(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_pcm_split14(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_pcm_split18(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_mimo_mix(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_dummy_wwd(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_dummy_hbuf(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_opus_encoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_dummy_wwd_msg(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_dummy_hbuf_msg(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_opus_decoder(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_microspeech_fe(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_microspeech_inference(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_person_detect_inference(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_keyword_detection_inference(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+
+static int renderer_setup(void *p_comp, int zone)
+{
+    int param[10];
+
+    param[0] = XA_RENDERER_CONFIG_PARAM_PCM_WIDTH;
+    param[1] = ZONE_PCM_WIDTH;
+    param[2] = XA_RENDERER_CONFIG_PARAM_CHANNELS;
+    param[3] = ZONE_NUM_CH;
+    param[4] = XA_RENDERER_CONFIG_PARAM_SAMPLE_RATE;
+    param[5] = ZONE_SAMPLE_RATE;
+    param[6] = XA_RENDERER_CONFIG_PARAM_FRAME_SIZE_IN_SAMPLES;
+    param[7] = ZONE_FRAME_SIZE;
+    param[8] = XA_RENDERER_CONFIG_PARAM_INSTANCE_ID;
+    param[9] = zone;
+
+    return(xaf_comp_set_config(p_comp, 5, &param[0]));
+}
+
+static int capturer_setup(void *p_comp, int zone, int frames)
+{
+    int param[12];
+
+    param[0] = XA_CAPTURER_CONFIG_PARAM_PCM_WIDTH;
+    param[1] = ZONE_PCM_WIDTH;
+    param[2] = XA_CAPTURER_CONFIG_PARAM_CHANNELS;
+    param[3] = ZONE_NUM_CH;
+    param[4] = XA_CAPTURER_CONFIG_PARAM_SAMPLE_RATE;
+    param[5] = ZONE_SAMPLE_RATE;
+    param[6] = XA_CAPTURER_CONFIG_PARAM_FRAME_SIZE_IN_SAMPLES;
+    param[7] = ZONE_FRAME_SIZE;
+    param[8] = XA_CAPTURER_CONFIG_PARAM_SAMPLE_END;
+    param[9] = frames * ZONE_FRAME_SIZE;
+    param[10] = XA_CAPTURER_CONFIG_PARAM_INSTANCE_ID;
+    param[11] = zone;
+
+    return(xaf_comp_set_config(p_comp, 6, &param[0]));
+}
+
+static int zone_set_state(void *p_comp, int param_id, int state)
+{
+    int param[2];
+
+    param[0] = param_id;
+    param[1] = state;
+
+    return(xaf_comp_set_config(p_comp, 1, &param[0]));
+}
+
+static int zone_get_param(void *p_comp, int param_id)
+{
+    int param[2];
+
+    param[0] = param_id;
+    param[1] = 0;
+
+    if (xaf_comp_get_config(p_comp, 1, &param[0]) != XAF_NO_ERR)
+    {
+        return 0;
+    }
+
+    return param[1];
+}
+
+/* ...one frame of a per-zone tone, so that the output files can be told apart */
+static void zone_fill(void *p_buf, int zone, int frame)
+{
+    WORD16 *p = (WORD16 *)p_buf;
+    int i;
+
+    for (i = 0; i < ZONE_FRAME_SIZE * ZONE_NUM_CH; i++)
+    {
+        p[i] = (WORD16)((((frame * ZONE_FRAME_SIZE + i / ZONE_NUM_CH) * (zone + 1) * 64) & 0x7FFF) - 0x4000);
+    }
+}
+
+/* ...size of the file the renderer of a zone writes into, -1 if it cannot be opened */
+static long zone_out_size(int zone)
+{
+    char name[32];
+    FILE *fp;
+    long size;
+
+    if (zone)
+        snprintf(name, sizeof(name), "renderer_out_%d.pcm", zone);
+    else
+        snprintf(name, sizeof(name), "renderer_out.pcm");
+
+    if ((fp = fopen(name, "rb")) == NULL)
+    {
+        return -1;
+    }
+
+    fseek(fp, 0, SEEK_END);
+    size = ftell(fp);
+    fclose(fp);
+
+    return size;
+}
+
+void fio_quit()
+{
+    return;
+}
+
+int main_task(int argc, char **argv)
+{
+    void *p_adev = NULL;
+    void *p_rend[ZONES_MAX], *p_cap[ZONES_MAX];
+    void *rend_inbuf[ZONES_MAX][2];
+    int fed[ZONES_MAX];
+    void *p_ready;
+    pUWORD8 ver_info[3] = {0,0,0};    //{ver,lib_rev,api_rev}
+    unsigned short board_id = 0;
+    mem_obj_t* mem_handle;
+    xaf_adev_config_t adev_config;
+    xaf_comp_status status;
+    int info[4];
+    int zones = ZONES_DEFAULT;
+    int frames = ZONE_FRAMES;
+    int capture = 0;
+    int num_comp, done;
+    long long t_stream, t0;
+    long long rendered = 0, captured = 0;
+    int failed = 0;
+    int i, z;
+
+    // NOTE: set_wbna() should be called before any other dynamic
+    // adjustment of the region attributes for cache.
+    set_wbna(&argc, argv);
+
+    /* ...start xos */
+    board_id = start_rtos();
+
+    /* ...get xaf version info*/
+    TST_CHK_API(xaf_get_verinfo(ver_info), "xaf_get_verinfo");
+
+    /* ...show xaf version info*/
+    TST_CHK_API(print_verinfo(ver_info,(pUWORD8)"\'Multi-Zone Renderer/Capturer\'"), "print_verinfo");
+
+    /* ...initialize tracing facility */
+    TRACE_INIT("Xtensa Audio Framework - \'Multi-Zone Renderer/Capturer\' Sample App");
+
+    /* ...check input arguments */
+    for (i = 1; i < argc; i++)
+    {
+        if (NULL != strstr(argv[i], "-zones:"))
+        {
+            zones = atoi((char *)&(argv[i][7]));
+        }
+        else if (NULL != strstr(argv[i], "-frames:"))
+        {
+            frames = atoi((char *)&(argv[i][8]));
+        }
+        else if (NULL != strstr(argv[i], "-capture"))
+        {
+            capture = 1;
+        }
+        else
+        {
+            PRINT_USAGE;
+            return 0;
+        }
+    }
+
+    if ((zones <= 0) || (zones > ZONES_MAX) || (frames <= 0))
+    {
+        PRINT_USAGE;
+        return 0;
+    }
+
+    mem_handle = mem_init();
+
+    num_comp = zones * (capture ? 2 : 1);
+
+    TST_CHK_API(xaf_adev_config_default_init(&adev_config), "xaf_adev_config_default_init");
+
+    adev_config.pmem_malloc = mem_malloc;
+    adev_config.pmem_free = mem_free;
+    adev_config.audio_framework_buffer_size = AUDIO_FRMWK_BUF_SIZE(num_comp);
+    adev_config.audio_component_buffer_size = AUDIO_COMP_BUF_SIZE(num_comp);
+    TST_CHK_API(xaf_adev_open(&p_adev, &adev_config), "xaf_adev_open");
+    FIO_PRINTF(stdout,"Audio Device Ready\n");
+
+    for (z = 0; z < zones; z++)
+    {
+        /* ...renderer fed by the application; non XAF_DECODER type components do not need initial input data to initialize */
+        TST_CHK_API_COMP_CREATE(p_adev, &p_rend[z], "renderer", 2, 0, &rend_inbuf[z][0], XAF_RENDERER, "xaf_comp_create");
+        TST_CHK_API(renderer_setup(p_rend[z], z), "renderer_setup");
+        TST_CHK_API(xaf_comp_process(p_adev, p_rend[z], NULL, 0, XAF_START_FLAG), "xaf_comp_process");
+        TST_CHK_API(xaf_comp_get_status(p_adev, p_rend[z], &status, &info[0]), "xaf_comp_get_status");
+        if (status != XAF_INIT_DONE)
+        {
+            FIO_PRINTF(stderr, "Failed to init renderer of zone %d, status:%d\n", z, status);
+            exit(-1);
+        }
+        fed[z] = 0;
+
+        if (capture)
+        {
+            /* ...capturer drained by the application */
+            TST_CHK_API_COMP_CREATE(p_adev, &p_cap[z], "capturer", 0, 1, NULL, XAF_CAPTURER, "xaf_comp_create");
+            TST_CHK_API(capturer_setup(p_cap[z], z, frames), "capturer_setup");
+            TST_CHK_API(xaf_comp_process(p_adev, p_cap[z], NULL, 0, XAF_START_FLAG), "xaf_comp_process");
+            TST_CHK_API(xaf_comp_get_status(p_adev, p_cap[z], &status, &info[0]), "xaf_comp_get_status");
+            if (status != XAF_INIT_DONE)
+            {
+                FIO_PRINTF(stderr, "Failed to init capturer of zone %d, status:%d\n", z, status);
+                exit(-1);
+            }
+        }
+    }
+
+#ifdef XAF_PROFILE
+    clk_start();
+#endif
+
+    /* ...start all zones back-to-back so that their timers run concurrently */
+    for (z = 0; z < zones; z++)
+    {
+        TST_CHK_API(zone_set_state(p_rend[z], XA_RENDERER_CONFIG_PARAM_STATE, XA_RENDERER_STATE_START), "zone_set_state");
+        TST_CHK_API(xaf_comp_process(p_adev, p_rend[z], NULL, 0, XAF_EXEC_FLAG), "xaf_comp_process");
+
+        /* ...prime both input buffers; the renderer asks for more only after consuming one */
+        for (i = 0; i < 2; i++)
+        {
+            if (fed[z] < frames)
+            {
+                zone_fill(rend_inbuf[z][i], z, fed[z]++);
+                TST_CHK_API(xaf_comp_process(p_adev, p_rend[z], rend_inbuf[z][i], ZONE_FRAME_BYTES, XAF_INPUT_READY_FLAG), "xaf_comp_process");
+            }
+            else
+            {
+                fed[z]++;
+                TST_CHK_API(xaf_comp_process(p_adev, p_rend[z], NULL, 0, XAF_INPUT_OVER_FLAG), "xaf_comp_process");
+                break;
+            }
+        }
+
+        if (capture)
+        {
+            TST_CHK_API(zone_set_state(p_cap[z], XA_CAPTURER_CONFIG_PARAM_STATE, XA_CAPTURER_STATE_START), "zone_set_state");
+            TST_CHK_API(xaf_comp_process(p_adev, p_cap[z], NULL, 0, XAF_EXEC_FLAG), "xaf_comp_process");
+        }
+    }
+
+    t0 = ZONE_CLK();
+    for (done = 0; done < num_comp; )
+    {
+        TST_CHK_API(xaf_comp_wait_any(p_adev, &p_ready), "xaf_comp_wait_any");
+
+        /* ...response is already delivered, so this does not block */
+        TST_CHK_API(xaf_comp_get_status(p_adev, p_ready, &status, &info[0]), "xaf_comp_get_status");
+
+        if (status == XAF_EXEC_DONE)
+        {
+            done++;
+            continue;
+        }
+
+        for (z = 0; z < zones; z++)
+        {
+            if (p_rend[z] == p_ready) break;
+        }
+
+        if (z < zones && status == XAF_NEED_INPUT)
+        {
+            if (fed[z] < frames)
+            {
+                zone_fill((void *)info[0], z, fed[z]++);
+                TST_CHK_API(xaf_comp_process(p_adev, p_rend[z], (void *)info[0], ZONE_FRAME_BYTES, XAF_INPUT_READY_FLAG), "xaf_comp_process");
+            }
+            else if (fed[z]++ == frames)
+            {
+                TST_CHK_API(xaf_comp_process(p_adev, p_rend[z], NULL, 0, XAF_INPUT_OVER_FLAG), "xaf_comp_process");
+            }
+        }
+        else if (z == zones && status == XAF_OUTPUT_READY)
+        {
+            /* ...captured data is only accounted; return the buffer */
+            TST_CHK_API(xaf_comp_process(p_adev, p_ready, (void *)info[0], info[1], XAF_NEED_OUTPUT_FLAG), "xaf_comp_process");
+        }
+        else
+        {
+            FIO_PRINTF(stderr, "Unexpected status:%d\n", status);
+            exit(-1);
+        }
+    }
+    t_stream = ZONE_CLK_DIFF(ZONE_CLK(), t0);
+
+#ifdef XAF_PROFILE
+    clk_stop();
+#endif
+
+    for (z = 0; z < zones; z++)
+    {
+        int r = zone_get_param(p_rend[z], XA_RENDERER_CONFIG_PARAM_BYTES_PRODUCED);
+        int c = (capture ? zone_get_param(p_cap[z], XA_CAPTURER_CONFIG_PARAM_BYTES_PRODUCED) : 0);
+        int u = zone_get_param(p_rend[z], XA_RENDERER_CONFIG_PARAM_UNDERRUNS);
+        long f = zone_out_size(z);
+
+        FIO_PRINTF(stderr, "zone %d : rendered %d bytes, captured %d bytes, underruns %d, sink stalls %d, source stalls %d\n", z, r, c,
+            u, zone_get_param(p_rend[z], XA_RENDERER_CONFIG_PARAM_SINK_STALLS),
+            (capture ? zone_get_param(p_cap[z], XA_CAPTURER_CONFIG_PARAM_SOURCE_STALLS) : 0));
+
+        /* ...the file sink is drained at exec done: the file holds every rendered frame, plus the
+         * zero-filled start-up frame and the zero-filled frame that completes the stream */
+        if ((r != frames * ZONE_FRAME_BYTES) || (u == 0 ? f != r + 2 * ZONE_FRAME_BYTES : f < r))
+        {
+            FIO_PRINTF(stderr, "zone %d : output file size %ld, expected %d rendered bytes of %d\n", z, f, r, frames * ZONE_FRAME_BYTES);
+            failed = 1;
+        }
+
+        rendered += r;
+        captured += c;
+    }
+
+    /* ...aggregate throughput; renderers and capturers are paced by their own timers */
+    strm_duration = (double)frames * ZONE_FRAME_SIZE / ZONE_SAMPLE_RATE;
+    FIO_PRINTF(stderr, "zones %d : rendered %lld bytes, captured %lld bytes, stream %.3f s, %lld cycles\n",
+        zones, rendered, captured, strm_duration, t_stream);
+
+    for (z = zones - 1; z >= 0; z--)
+    {
+        if (capture)
+        {
+            TST_CHK_API(xaf_comp_delete(p_cap[z]), "xaf_comp_delete");
+        }
+        TST_CHK_API(xaf_comp_delete(p_rend[z]), "xaf_comp_delete");
+    }
+
+    TST_CHK_API(xaf_adev_close(p_adev, XAF_ADEV_NORMAL_CLOSE), "xaf_adev_close");
+    FIO_PRINTF(stdout,"Audio device closed\n\n");
+
+    if (failed)
+    {
+        FIO_PRINTF(stderr, "Multi-zone output check failed\n");
+        exit(-1);
+    }
+
+    (void)board_id;
+    (void)mem_handle;
+    mem_exit();
+
+    fio_quit();
+
+    /* ...deinitialize tracing facility */
+    TRACE_DEINIT();
+
+    return 0;
+}
@@ -0,0 +1,337 @@
+/*
+* Copyright (c) 2015-2022 Cadence Design Systems Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to deal in the Software without restriction, including
+* without limitation the rights to use, copy, modify, merge, publish,
+* distribute, sublicense, and/or sell copies of the Software, and to
+* permit persons to whom the Software is furnished to do so, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include "audio/xa-pcm-gain-api.h"
+#include "xaf-utils-test.h"
+#include "xaf-fio-test.h"
+
+/* state transfer test: pcm-gain component A is snapshot in the middle of a gain ramp and restored into
+ * component B that runs a different gain; from that point both are fed the same frames and their
+ * outputs must match bit for bit */
+
+#define PRINT_USAGE FIO_PRINTF(stdout, "\nUsage: %s [optional -frames:N (default %d)]\n\n", argv[0], SNAP_FRAMES);
+
+#define AUDIO_FRMWK_BUF_SIZE   (256 << 8)
+#define AUDIO_COMP_BUF_SIZE    (1024 << 7)
+#define NUM_COMP_IN_GRAPH       2
+
+//component parameters
+#define PCM_GAIN_SAMPLE_WIDTH   16
+#define PCM_GAIN_NUM_CH         2
+#define PCM_GAIN_SAMPLE_RATE    48000
+#define PCM_GAIN_FRAME_SIZE     1024
+
+/* ...ramp spans several frames, so the snapshot lands in the middle of it */
+#define SNAP_RAMP_LENGTH        1000
+#define SNAP_GAIN_DB            -120
+#define SNAP_GAIN_FRAME         2
+#define SNAP_FRAME              4
+#define SNAP_FRAMES             12
+
+unsigned int num_bytes_read, num_bytes_write;
+extern int audio_frmwk_buf_size;
+extern int audio_comp_buf_size;
+double strm_duration;
+
+#ifdef XAF_PROFILE
+    extern long long tot_cycles, frmwk_cycles, fread_cycles, fwrite_cycles;
+    extern long long dsp_comps_cycles, pcm_gain_cycles;
+    extern double dsp_mcps;
+#endif
+
+/* Dummy unused functions */
+XA_ERRORCODE xa_mp3_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_aac_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_mixer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_mp3_encoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_src_pp_fx(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_src_poly(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_renderer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_capturer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_amr_wb_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_hotword_decoder(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value){return 0;}
+XA_ERRORCODE xa_vorbis_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_dummy_aec22(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_dummy_aec23(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_pcm_split(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_pcm_split14(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_pcm_split18(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_mimo_mix(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_dummy_wwd(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_dummy_hbuf(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_opus_encoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_dummy_wwd_msg(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_dummy_hbuf_msg(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_opus_decoder(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_microspeech_fe(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_microspeech_inference(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_person_detect_inference(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_keyword_detection_inference(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+
+static int pcm_gain_setup(void *p_comp, int gain_idx)
+{
+    int param[12];
+
+    param[0] = XA_PCM_GAIN_CONFIG_PARAM_CHANNELS;
+    param[1] = PCM_GAIN_NUM_CH;
+    param[2] = XA_PCM_GAIN_CONFIG_PARAM_SAMPLE_RATE;
+    param[3] = PCM_GAIN_SAMPLE_RATE;
+    param[4] = XA_PCM_GAIN_CONFIG_PARAM_PCM_WIDTH;
+    param[5] = PCM_GAIN_SAMPLE_WIDTH;
+    param[6] = XA_PCM_GAIN_CONFIG_PARAM_FRAME_SIZE;
+    param[7] = PCM_GAIN_FRAME_SIZE;
+    param[8] = XA_PCM_GAIN_CONFIG_PARAM_GAIN_FACTOR;
+    param[9] = gain_idx;
+    param[10] = XA_PCM_GAIN_CONFIG_PARAM_RAMP_LENGTH;
+    param[11] = SNAP_RAMP_LENGTH;
+
+    return(xaf_comp_set_config(p_comp, 6, &param[0]));
+}
+
+/* ...deterministic full-scale test signal; frame index selects the segment */
+static void snap_fill(void *p_buf, int frame)
+{
+    short *p = (short *)p_buf;
+    unsigned int seed = 0x1234567u + (unsigned int)frame * 0x9E3779B9u;
+    int i;
+
+    for (i = 0; i < PCM_GAIN_FRAME_SIZE / 2; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        p[i] = (short)(seed >> 16);
+    }
+}
+
+/* ...create and start a pcm-gain component; no input is needed to complete its initialization */
+static int snap_comp_create(void *p_adev, void **pp_comp, void *inbuf[1], int gain_idx)
+{
+    xaf_comp_status status;
+    int info[4];
+
+    TST_CHK_API_COMP_CREATE(p_adev, pp_comp, "post-proc/pcm_gain", 1, 1, &inbuf[0], XAF_POST_PROC, "xaf_comp_create");
+    TST_CHK_API(pcm_gain_setup(*pp_comp, gain_idx), "pcm_gain_setup");
+    TST_CHK_API(xaf_comp_process(p_adev, *pp_comp, NULL, 0, XAF_START_FLAG), "xaf_comp_process");
+    TST_CHK_API(xaf_comp_get_status(p_adev, *pp_comp, &status, &info[0]), "xaf_comp_get_status");
+
+    if (status != XAF_INIT_DONE)
+    {
+        FIO_PRINTF(stderr, "Failed to init, status:%d\n", status);
+        return -1;
+    }
+
+    TST_CHK_API(xaf_comp_process(p_adev, *pp_comp, NULL, 0, XAF_EXEC_FLAG), "xaf_comp_process");
+
+    return 0;
+}
+
+/* ...process one frame and wait for both its output and the return of the input buffer,
+ * so that the component holds no data between frames */
+static int snap_step(void *p_adev, void *p_comp, void *p_inbuf, int frame, void *p_out)
+{
+    xaf_comp_status status;
+    int info[4];
+    int got_out = 0, got_in = 0;
+
+    snap_fill(p_inbuf, frame);
+    TST_CHK_API(xaf_comp_process(p_adev, p_comp, p_inbuf, PCM_GAIN_FRAME_SIZE, XAF_INPUT_READY_FLAG), "xaf_comp_process");
+
+    while (!got_out || !got_in)
+    {
+        TST_CHK_API(xaf_comp_get_status(p_adev, p_comp, &status, &info[0]), "xaf_comp_get_status");
+
+        if (status == XAF_OUTPUT_READY)
+        {
+            if (info[1] != PCM_GAIN_FRAME_SIZE)
+            {
+                FIO_PRINTF(stderr, "Frame %d: unexpected output length %d\n", frame, info[1]);
+                return -1;
+            }
+            memcpy(p_out, (void *)info[0], PCM_GAIN_FRAME_SIZE);
+            TST_CHK_API(xaf_comp_process(p_adev, p_comp, (void *)info[0], info[1], XAF_NEED_OUTPUT_FLAG), "xaf_comp_process");
+            got_out = 1;
+        }
+        else if (status == XAF_NEED_INPUT)
+        {
+            got_in = 1;
+        }
+        else
+        {
+            FIO_PRINTF(stderr, "Frame %d: unexpected status:%d\n", frame, status);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+void fio_quit()
+{
+    return;
+}
+
+int main_task(int argc, char **argv)
+{
+    void *p_adev = NULL;
+    void *p_gain[2];
+    void *inbuf[2][1];
+    void *p_snap;
+    unsigned char out[2][PCM_GAIN_FRAME_SIZE];
+    pUWORD8 ver_info[3] = {0,0,0};    //{ver,lib_rev,api_rev}
+    unsigned short board_id = 0;
+    mem_obj_t* mem_handle;
+    xaf_adev_config_t adev_config;
+    UWORD32 snap_length;
+    int param[2];
+    int frames = SNAP_FRAMES;
+    int mismatch = 0, diverged = 0;
+    int k;
+
+    audio_frmwk_buf_size = AUDIO_FRMWK_BUF_SIZE;
+    audio_comp_buf_size = AUDIO_COMP_BUF_SIZE;
+
+    // NOTE: set_wbna() should be called before any other dynamic
+    // adjustment of the region attributes for cache.
+    set_wbna(&argc, argv);
+
+    /* ...start xos */
+    board_id = start_rtos();
+
+    /* ...get xaf version info*/
+    TST_CHK_API(xaf_get_verinfo(ver_info), "xaf_get_verinfo");
+
+    /* ...show xaf version info*/
+    TST_CHK_API(print_verinfo(ver_info,(pUWORD8)"\'PCM Gain Snapshot\'"), "print_verinfo");
+
+    /* ...initialize tracing facility */
+    TRACE_INIT("Xtensa Audio Framework - \'PCM Gain Snapshot\' Sample App");
+
+    /* ...check input arguments */
+    if (argc > 2)
+    {
+        PRINT_USAGE;
+        return 0;
+    }
+
+    if (argc == 2)
+    {
+        if (NULL != strstr(argv[1], "-frames:"))
+        {
+            frames = atoi((char *)&(argv[1][8]));
+        }
+        else
+        {
+            PRINT_USAGE;
+            return 0;
+        }
+    }
+
+    if (frames <= SNAP_FRAME)
+    {
+        FIO_PRINTF(stderr, "Number of frames must be above %d\n", SNAP_FRAME);
+        exit(-1);
+    }
+
+    mem_handle = mem_init();
+
+    TST_CHK_API(xaf_adev_config_default_init(&adev_config), "xaf_adev_config_default_init");
+
+    adev_config.pmem_malloc = mem_malloc;
+    adev_config.pmem_free = mem_free;
+    adev_config.audio_framework_buffer_size = audio_frmwk_buf_size;
+    adev_config.audio_component_buffer_size = audio_comp_buf_size;
+    TST_CHK_API(xaf_adev_open(&p_adev, &adev_config), "xaf_adev_open");
+    FIO_PRINTF(stdout,"Audio Device Ready\n");
+
+    /* ...same format, different gain: without the state transfer B output would differ */
+    TST_CHK_API(snap_comp_create(p_adev, &p_gain[0], &inbuf[0][0], 0), "snap_comp_create");
+    TST_CHK_API(snap_comp_create(p_adev, &p_gain[1], &inbuf[1][0], 3), "snap_comp_create");
+
+    /* ...B has to be running before it accepts a state */
+    TST_CHK_API(snap_step(p_adev, p_gain[1], inbuf[1][0], 0, out[1]), "snap_step");
+
+    for (k = 0; k < SNAP_FRAME; k++)
+    {
+        if (k == SNAP_GAIN_FRAME)
+        {
+            param[0] = XA_PCM_GAIN_CONFIG_PARAM_GAIN_DB;
+            param[1] = SNAP_GAIN_DB;
+            TST_CHK_API(xaf_comp_set_config(p_gain[0], 1, &param[0]), "xaf_comp_set_config");
+        }
+
+        TST_CHK_API(snap_step(p_adev, p_gain[0], inbuf[0][0], k, out[0]), "snap_step");
+    }
+
+    /* ...transfer state of A into B in the middle of the ramp */
+    param[0] = XAF_COMP_CONFIG_PARAM_SNAPSHOT_SIZE;
+    TST_CHK_API(xaf_comp_get_config(p_gain[0], 1, &param[0]), "xaf_comp_get_config");
+    TST_CHK_PTR((p_snap = malloc(param[1])), "malloc");
+
+    TST_CHK_API(xaf_comp_snapshot(p_gain[0], p_snap, param[1], &snap_length), "xaf_comp_snapshot");
+    TST_CHK_API(xaf_comp_restore(p_gain[1], p_snap, snap_length), "xaf_comp_restore");
+
+    FIO_PRINTF(stdout, "Snapshot at frame %d: %u of %d bytes\n", SNAP_FRAME, snap_length, param[1]);
+
+    for (k = SNAP_FRAME; k < frames; k++)
+    {
+        TST_CHK_API(snap_step(p_adev, p_gain[0], inbuf[0][0], k, out[0]), "snap_step");
+        TST_CHK_API(snap_step(p_adev, p_gain[1], inbuf[1][0], k, out[1]), "snap_step");
+
+        if (memcmp(out[0], out[1], PCM_GAIN_FRAME_SIZE))
+        {
+            FIO_PRINTF(stderr, "Frame %d: restored output differs\n", k);
+            mismatch++;
+        }
+
+        /* ...A must carry the gain rather than pass its input through */
+        snap_fill(out[1], k);
+        diverged += (memcmp(out[0], out[1], PCM_GAIN_FRAME_SIZE) != 0);
+    }
+
+    free(p_snap);
+
+    TST_CHK_API(xaf_comp_delete(p_gain[1]), "xaf_comp_delete");
+    TST_CHK_API(xaf_comp_delete(p_gain[0]), "xaf_comp_delete");
+    TST_CHK_API(xaf_adev_close(p_adev, XAF_ADEV_NORMAL_CLOSE), "xaf_adev_close");
+    FIO_PRINTF(stdout,"Audio device closed\n\n");
+
+    mem_exit();
+
+    TST_CHK_API(print_mem_mcps_info(mem_handle, NUM_COMP_IN_GRAPH), "print_mem_mcps_info");
+
+    /* ...deinitialize tracing facility */
+    TRACE_DEINIT();
+
+    if (mismatch || diverged != frames - SNAP_FRAME)
+    {
+        FIO_PRINTF(stderr, "Snapshot/restore FAILED: %d of %d frames differ, %d frames with gain applied\n", mismatch, frames - SNAP_FRAME, diverged);
+        return -1;
+    }
+
+    FIO_PRINTF(stdout, "Snapshot/restore PASSED: %d frames bit-exact after restore\n", frames - SNAP_FRAME);
+
+    return 0;
+}
@@ -69,6 +69,7 @@ XA_ERRORCODE xa_aac_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pV
 XA_ERRORCODE xa_mixer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
 XA_ERRORCODE xa_mp3_encoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
 XA_ERRORCODE xa_src_pp_fx(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_src_poly(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
 XA_ERRORCODE xa_renderer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
 XA_ERRORCODE xa_capturer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
 XA_ERRORCODE xa_amr_wb_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
@@ -77,6 +78,8 @@ XA_ERRORCODE xa_vorbis_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3,
 XA_ERRORCODE xa_dummy_aec22(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
 XA_ERRORCODE xa_dummy_aec23(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
 XA_ERRORCODE xa_pcm_split(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_pcm_split14(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_pcm_split18(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
 XA_ERRORCODE xa_mimo_mix(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
 XA_ERRORCODE xa_dummy_wwd(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
 XA_ERRORCODE xa_dummy_hbuf(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
@@ -144,6 +147,145 @@ static int get_comp_config(void *p_comp, xaf_format_t *comp_format)
     return 0;
 }
 
+/* ...plugin API self-check: stereo frames per call are not a multiple of the plugin's 16-frame ramp sub-block */
+#define PCM_GAIN_CHECK_CH       2
+#define PCM_GAIN_CHECK_FRAMES   37
+#define PCM_GAIN_CHECK_CALLS    4
+#define PCM_GAIN_CHECK_RAMP     100
+#define PCM_GAIN_CHECK_BLOCK    16
+#define PCM_GAIN_CHECK_SAMPLES  (PCM_GAIN_CHECK_CH * PCM_GAIN_CHECK_FRAMES)
+
+/* ...reference 16-bit gain: MSB-aligned sample scaled by Q12 gain */
+static short pcm_gain_check_ref(short x, int gain)
+{
+    return (short)((((long long)x << 16) * gain >> 12) >> 16);
+}
+
+/* ...run one buffer through the plugin; output may alias the input */
+static int pcm_gain_check_run(xa_codec_handle_t h, short *in, short *out)
+{
+    WORD32 size = PCM_GAIN_CHECK_SAMPLES * sizeof(short);
+    WORD32 produced = 0;
+
+    if (xa_pcm_gain(h, XA_API_CMD_SET_MEM_PTR, 0, in) != XA_NO_ERROR ||
+        xa_pcm_gain(h, XA_API_CMD_SET_MEM_PTR, 1, out) != XA_NO_ERROR ||
+        xa_pcm_gain(h, XA_API_CMD_SET_INPUT_BYTES, 0, &size) != XA_NO_ERROR ||
+        xa_pcm_gain(h, XA_API_CMD_EXECUTE, XA_CMD_TYPE_DO_EXECUTE, NULL) != XA_NO_ERROR ||
+        xa_pcm_gain(h, XA_API_CMD_GET_OUTPUT_BYTES, 1, &produced) != XA_NO_ERROR)
+        return -1;
+
+    return (produced == size ? 0 : -1);
+}
+
+/* ...set a single configuration parameter */
+static int pcm_gain_check_set(xa_codec_handle_t h, WORD32 idx, WORD32 value)
+{
+    return (xa_pcm_gain(h, XA_API_CMD_SET_CONFIG_PARAM, idx, &value) == XA_NO_ERROR ? 0 : -1);
+}
+
+/* ...check linear / dB gain, gain ramp and in-place operation on the plugin API directly */
+static int pcm_gain_api_check(void)
+{
+    static short x[PCM_GAIN_CHECK_SAMPLES], y[PCM_GAIN_CHECK_SAMPLES];
+    static short ramp[PCM_GAIN_CHECK_CALLS * PCM_GAIN_CHECK_SAMPLES];
+    xa_codec_handle_t h;
+    WORD32 size, gain;
+    int i, err = -1;
+
+    if (xa_pcm_gain(NULL, XA_API_CMD_GET_API_SIZE, 0, &size) != XA_NO_ERROR || (h = malloc(size)) == NULL)
+        return -1;
+
+    for (i = 0; i < PCM_GAIN_CHECK_SAMPLES; i++)
+        x[i] = (short)((i * 7919) % 30000 - 15000);
+
+    if (xa_pcm_gain(h, XA_API_CMD_INIT, XA_CMD_TYPE_INIT_API_PRE_CONFIG_PARAMS, NULL) != XA_NO_ERROR ||
+        pcm_gain_check_set(h, XA_PCM_GAIN_CONFIG_PARAM_CHANNELS, PCM_GAIN_CHECK_CH) ||
+        pcm_gain_check_set(h, XA_PCM_GAIN_CONFIG_PARAM_PCM_WIDTH, 16) ||
+        pcm_gain_check_set(h, XA_PCM_GAIN_CONFIG_PARAM_FRAME_SIZE, PCM_GAIN_CHECK_SAMPLES * sizeof(short)) ||
+        xa_pcm_gain(h, XA_API_CMD_INIT, XA_CMD_TYPE_INIT_API_POST_CONFIG_PARAMS, NULL) != XA_NO_ERROR ||
+        xa_pcm_gain(h, XA_API_CMD_INIT, XA_CMD_TYPE_INIT_PROCESS, NULL) != XA_NO_ERROR)
+        goto out;
+
+    /* ...linear gain of one half */
+    if (pcm_gain_check_set(h, XA_PCM_GAIN_CONFIG_PARAM_GAIN_LINEAR, 2048) || pcm_gain_check_run(h, x, y))
+        goto out;
+
+    for (i = 0; i < PCM_GAIN_CHECK_SAMPLES; i++)
+        if (y[i] != pcm_gain_check_ref(x[i], 2048))
+        {
+            FIO_PRINTF(stderr, "pcm gain check: linear gain mismatch at %d\n", i);
+            goto out;
+        }
+
+    /* ...same gain in place must give the same result */
+    memcpy(ramp, x, sizeof(x));
+
+    if (pcm_gain_check_run(h, ramp, ramp) || memcmp(ramp, y, sizeof(y)))
+    {
+        FIO_PRINTF(stderr, "pcm gain check: in-place output differs\n");
+        goto out;
+    }
+
+    /* ...-6.0 dB is the -6dB gain table entry; 0 dB passes samples through */
+    if (pcm_gain_check_set(h, XA_PCM_GAIN_CONFIG_PARAM_GAIN_DB, -60) ||
+        xa_pcm_gain(h, XA_API_CMD_GET_CONFIG_PARAM, XA_PCM_GAIN_CONFIG_PARAM_GAIN_LINEAR, &gain) != XA_NO_ERROR ||
+        gain < 2052 || gain > 2054 || pcm_gain_check_run(h, x, y))
+    {
+        FIO_PRINTF(stderr, "pcm gain check: -6 dB gain failed\n");
+        goto out;
+    }
+
+    for (i = 0; i < PCM_GAIN_CHECK_SAMPLES; i++)
+        if (y[i] != pcm_gain_check_ref(x[i], gain))
+        {
+            FIO_PRINTF(stderr, "pcm gain check: dB gain mismatch at %d\n", i);
+            goto out;
+        }
+
+    if (pcm_gain_check_set(h, XA_PCM_GAIN_CONFIG_PARAM_GAIN_DB, 0) || pcm_gain_check_run(h, x, y) || memcmp(x, y, sizeof(x)))
+    {
+        FIO_PRINTF(stderr, "pcm gain check: 0 dB gain failed\n");
+        goto out;
+    }
+
+    /* ...ramp a constant signal down to mute in place over several buffers */
+    if (pcm_gain_check_set(h, XA_PCM_GAIN_CONFIG_PARAM_RAMP_LENGTH, PCM_GAIN_CHECK_RAMP) ||
+        pcm_gain_check_set(h, XA_PCM_GAIN_CONFIG_PARAM_GAIN_LINEAR, 0))
+        goto out;
+
+    for (i = 0; i < PCM_GAIN_CHECK_CALLS * PCM_GAIN_CHECK_SAMPLES; i++)
+        ramp[i] = 8000;
+
+    for (i = 0; i < PCM_GAIN_CHECK_CALLS; i++)
+        if (pcm_gain_check_run(h, &ramp[i * PCM_GAIN_CHECK_SAMPLES], &ramp[i * PCM_GAIN_CHECK_SAMPLES]))
+            goto out;
+
+    /* ...gain falls monotonically, is still audible on the last ramp frame and lands on mute right after it */
+    for (i = 1; i < PCM_GAIN_CHECK_CALLS * PCM_GAIN_CHECK_FRAMES; i++)
+        if (ramp[i * PCM_GAIN_CHECK_CH] > ramp[(i - 1) * PCM_GAIN_CHECK_CH] ||
+            ramp[i * PCM_GAIN_CHECK_CH] != ramp[i * PCM_GAIN_CHECK_CH + 1] ||
+            (i < PCM_GAIN_CHECK_RAMP) != (ramp[i * PCM_GAIN_CHECK_CH] != 0))
+        {
+            FIO_PRINTF(stderr, "pcm gain check: ramp mismatch at frame %d\n", i);
+            goto out;
+        }
+
+    /* ...half way through the ramp is within one sub-block of half gain */
+    i = ramp[PCM_GAIN_CHECK_RAMP / 2 * PCM_GAIN_CHECK_CH];
+
+    if (i < 4000 || i > 4000 + 8000 * PCM_GAIN_CHECK_BLOCK / PCM_GAIN_CHECK_RAMP)
+    {
+        FIO_PRINTF(stderr, "pcm gain check: ramp mid-point %d out of range\n", i);
+        goto out;
+    }
+
+    err = 0;
+
+out:
+    free(h);
+    return err;
+}
+
 void fio_quit()
 {
     return;
@@ -290,6 +432,13 @@ int main_task(int argc, char **argv)
     p_input  = fp;
     p_output = ofp;
 
+    /* ...check gain parameters and in-place operation before streaming */
+    if (pcm_gain_api_check())
+    {
+        FIO_PRINTF(stderr, "PCM gain API check failed\n");
+        exit(-1);
+    }
+
     mem_handle = mem_init();
 
     xaf_adev_config_t adev_config;
@@ -395,9 +544,52 @@ int main_task(int argc, char **argv)
             FIO_PRINTF(stderr,"Local Memory used by Framework, in bytes                 : %8d\n", meminfo[2]);
         }
     }
-    /* ...exec done, clean-up */
-    __xf_thread_destroy(&pcm_gain_thread);
-    TST_CHK_API(xaf_comp_delete(p_pcm_gain), "xaf_comp_delete");
+    {
+        /* per-component memory, current (peak) in bytes */
+        xaf_comp_mem_stats_t comp_mem;
+        WORD32 memtab[6], meminfo[2][5];
+        WORD32 charged, released;
+
+        TST_CHK_API(xaf_comp_get_mem_stats(p_pcm_gain, &comp_mem), "xaf_comp_get_mem_stats");
+        FIO_PRINTF(stderr,"pcm-gain memory, in bytes: persist %d (%d) scratch %d (%d) io %d (%d) event %d (%d)\n",
+            comp_mem.curr[XAF_MEM_TYPE_PERSIST], comp_mem.peak[XAF_MEM_TYPE_PERSIST],
+            comp_mem.curr[XAF_MEM_TYPE_SCRATCH], comp_mem.peak[XAF_MEM_TYPE_SCRATCH],
+            comp_mem.curr[XAF_MEM_TYPE_IO], comp_mem.peak[XAF_MEM_TYPE_IO],
+            comp_mem.curr[XAF_MEM_TYPE_EVENT], comp_mem.peak[XAF_MEM_TYPE_EVENT]);
+
+        /* ...peak usage must cover what the memory planner reports for the component; output port is not
+         * routed, so the output memtab is served by the application buffer and only the input side
+         * (same size for pcm-gain) is held by the component */
+        memtab[0] = XAF_COMP_CONFIG_PARAM_MEMTAB_PERSIST;
+        memtab[2] = XAF_COMP_CONFIG_PARAM_MEMTAB_SCRATCH;
+        memtab[4] = XAF_COMP_CONFIG_PARAM_MEMTAB_IO;
+        TST_CHK_API(xaf_comp_get_config(p_pcm_gain, 3, &memtab[0]), "xaf_comp_get_config");
+
+        if (comp_mem.peak[XAF_MEM_TYPE_PERSIST] < memtab[1] ||
+            comp_mem.peak[XAF_MEM_TYPE_SCRATCH] < memtab[3] ||
+            comp_mem.peak[XAF_MEM_TYPE_IO] < memtab[5] / 2)
+        {
+            FIO_PRINTF(stderr,"pcm-gain memory FAILED: peak below memtab persist %d scratch %d io %d\n", memtab[1], memtab[3], memtab[5]);
+            return -1;
+        }
+
+        /* ...scratch is the worker share and stays with the worker; everything else goes with the component */
+        charged = comp_mem.curr[XAF_MEM_TYPE_PERSIST] + comp_mem.curr[XAF_MEM_TYPE_IO] + comp_mem.curr[XAF_MEM_TYPE_EVENT];
+
+        /* ...exec done, clean-up */
+        __xf_thread_destroy(&pcm_gain_thread);
+        TST_CHK_API(xaf_get_mem_stats(p_adev, &meminfo[0][0]), "xaf_get_mem_stats");
+        TST_CHK_API(xaf_comp_delete(p_pcm_gain), "xaf_comp_delete");
+        TST_CHK_API(xaf_get_mem_stats(p_adev, &meminfo[1][0]), "xaf_get_mem_stats");
+
+        released = meminfo[0][3] - meminfo[1][3];
+        if (released != charged)
+        {
+            FIO_PRINTF(stderr,"pcm-gain memory FAILED: %d bytes charged, %d released on delete\n", charged, released);
+            return -1;
+        }
+        FIO_PRINTF(stderr,"pcm-gain memory PASSED: %d bytes released on delete\n", released);
+    }
     TST_CHK_API(xaf_adev_close(p_adev, XAF_ADEV_NORMAL_CLOSE), "xaf_adev_close");
     FIO_PRINTF(stdout,"Audio device closed\n\n");
 
@@ -0,0 +1,412 @@
+/*
+* Copyright (c) 2015-2022 Cadence Design Systems Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to deal in the Software without restriction, including
+* without limitation the rights to use, copy, modify, merge, publish,
+* distribute, sublicense, and/or sell copies of the Software, and to
+* permit persons to whom the Software is furnished to do so, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "audio/xa-pcm-gain-api.h"
+#include "audio/xa-pcm-split-api.h"
+#include "xaf-utils-test.h"
+#include "xaf-fio-test.h"
+
+/* pcm-split fan-out test: for mimo-proc14 and mimo-proc18 the splitter must refuse more outputs than
+ * the component has ports and copy its input to every port; the application feeds a pcm-gain in front
+ * of the splitter and drains a 0 dB pcm-gain behind each output, from a single thread */
+
+#define PRINT_USAGE FIO_PRINTF(stdout, "\nUsage: %s [optional -frames:N (default %d)]\n\n", argv[0], SPLIT_FRAMES);
+
+#define AUDIO_FRMWK_BUF_SIZE   (256 << 10)
+#define AUDIO_COMP_BUF_SIZE    (1024 << 10)
+
+//component parameters
+#define SPLIT_PCM_WIDTH         16
+#define SPLIT_NUM_CH            1
+#define SPLIT_SAMPLE_RATE       48000
+#define SPLIT_FRAME_BYTES       1024
+#define SPLIT_FRAMES            64
+
+unsigned int num_bytes_read, num_bytes_write;
+extern int audio_frmwk_buf_size;
+extern int audio_comp_buf_size;
+double strm_duration;
+
+#ifdef XAF_PROFILE
+    extern long long tot_cycles, frmwk_cycles, fread_cycles, fwrite_cycles;
+    extern long long dsp_comps_cycles, pcm_gain_cycles, pcm_split_cycles;
+    extern double dsp_mcps;
+#endif
+
+/* Dummy unused functions */
+XA_ERRORCODE xa_mp3_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_aac_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_mixer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_mp3_encoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_src_pp_fx(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_src_poly(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_renderer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_capturer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_amr_wb_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_hotword_decoder(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value){return 0;}
+XA_ERRORCODE xa_vorbis_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_dummy_aec22(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_dummy_aec23(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_mimo_mix(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_dummy_wwd(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_dummy_hbuf(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_opus_encoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_dummy_wwd_msg(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_dummy_hbuf_msg(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_opus_decoder(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_microspeech_fe(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_microspeech_inference(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_person_detect_inference(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_keyword_detection_inference(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+
+static const struct
+{
+    const char *id;
+    xaf_comp_type type;
+    int ports;
+
+} split_graphs[] = {
+    { "mimo-proc14/pcm_split", XAF_MIMO_PROC_14, 4 },
+    { "mimo-proc18/pcm_split", XAF_MIMO_PROC_18, 8 },
+};
+
+/* ...input stream sample; position selects the value, so that any lost or repeated data shows */
+static short split_sample(int n)
+{
+    return (short)(n * 97 + (n >> 9) * 13);
+}
+
+static void split_fill(void *p_buf, int frame)
+{
+    short *p = (short *)p_buf;
+    int i, n = frame * (SPLIT_FRAME_BYTES / 2);
+
+    for (i = 0; i < SPLIT_FRAME_BYTES / 2; i++)
+    {
+        p[i] = split_sample(n + i);
+    }
+}
+
+static int pcm_gain_setup(void *p_comp)
+{
+    int param[8];
+
+    param[0] = XA_PCM_GAIN_CONFIG_PARAM_CHANNELS;
+    param[1] = SPLIT_NUM_CH;
+    param[2] = XA_PCM_GAIN_CONFIG_PARAM_SAMPLE_RATE;
+    param[3] = SPLIT_SAMPLE_RATE;
+    param[4] = XA_PCM_GAIN_CONFIG_PARAM_PCM_WIDTH;
+    param[5] = SPLIT_PCM_WIDTH;
+    param[6] = XA_PCM_GAIN_CONFIG_PARAM_FRAME_SIZE;
+    param[7] = SPLIT_FRAME_BYTES;
+
+    return(xaf_comp_set_config(p_comp, 4, &param[0]));
+}
+
+static int pcm_split_setup(void *p_comp, int num_outputs)
+{
+    int param[8];
+
+    param[0] = XA_PCM_SPLIT_CONFIG_PARAM_CHANNELS;
+    param[1] = SPLIT_NUM_CH;
+    param[2] = XA_PCM_SPLIT_CONFIG_PARAM_SAMPLE_RATE;
+    param[3] = SPLIT_SAMPLE_RATE;
+    param[4] = XA_PCM_SPLIT_CONFIG_PARAM_PCM_WIDTH;
+    param[5] = SPLIT_PCM_WIDTH;
+    param[6] = XA_PCM_SPLIT_CONFIG_PARAM_NUM_OUTPUTS;
+    param[7] = num_outputs;
+
+    return(xaf_comp_set_config(p_comp, 4, &param[0]));
+}
+
+static int pcm_split_get_outputs(void *p_comp)
+{
+    int param[2];
+
+    param[0] = XA_PCM_SPLIT_CONFIG_PARAM_NUM_OUTPUTS;
+    param[1] = 0;
+
+    if (xaf_comp_get_config(p_comp, 1, &param[0]) != XAF_NO_ERR)
+    {
+        return -1;
+    }
+
+    return param[1];
+}
+
+static int split_comp_start(void *p_adev, void *p_comp)
+{
+    xaf_comp_status status;
+    int info[4];
+
+    TST_CHK_API(xaf_comp_process(p_adev, p_comp, NULL, 0, XAF_START_FLAG), "xaf_comp_process");
+    TST_CHK_API(xaf_comp_get_status(p_adev, p_comp, &status, &info[0]), "xaf_comp_get_status");
+
+    if (status != XAF_INIT_DONE)
+    {
+        FIO_PRINTF(stderr, "Failed to init, status:%d\n", status);
+        return -1;
+    }
+
+    return 0;
+}
+
+/* ...run one splitter graph; returns the number of failed checks */
+static int split_run(void *p_adev, int g, int frames)
+{
+    void *p_in, *p_split, *p_out[XA_PCM_SPLIT_MAX_OUTPUTS];
+    void *inbuf[2];
+    void *p_ready;
+    xaf_comp_status status;
+    int info[4];
+    int received[XA_PCM_SPLIT_MAX_OUTPUTS];
+    int ports = split_graphs[g].ports;
+    int fed = 0, done, errors = 0;
+    int i, k;
+
+    /* ...application feeds the splitter through a pcm-gain; non XAF_DECODER type components do not need initial input data to initialize */
+    TST_CHK_API_COMP_CREATE(p_adev, &p_in, "post-proc/pcm_gain", 2, 0, &inbuf[0], XAF_POST_PROC, "xaf_comp_create");
+    TST_CHK_API(pcm_gain_setup(p_in), "pcm_gain_setup");
+    TST_CHK_API(split_comp_start(p_adev, p_in), "split_comp_start");
+
+    TST_CHK_API_COMP_CREATE(p_adev, &p_split, split_graphs[g].id, 0, 0, NULL, split_graphs[g].type, "xaf_comp_create");
+
+    /* ...all ports of the component are active by default */
+    if (pcm_split_get_outputs(p_split) != ports)
+    {
+        FIO_PRINTF(stderr, "%s: %d outputs by default, expected %d\n", split_graphs[g].id, pcm_split_get_outputs(p_split), ports);
+        return -1;
+    }
+
+    /* ...one output beyond the ports of the component must be refused; the configuration is then redone */
+    if (pcm_split_setup(p_split, ports + 1) == XAF_NO_ERR)
+    {
+        FIO_PRINTF(stderr, "%s: %d outputs accepted\n", split_graphs[g].id, ports + 1);
+        return -1;
+    }
+
+    TST_CHK_API(pcm_split_setup(p_split, ports), "pcm_split_setup");
+    TST_CHK_API(xaf_connect(p_in, 1, p_split, 0, 4), "xaf_connect");
+    TST_CHK_API(split_comp_start(p_adev, p_split), "split_comp_start");
+
+    /* ...every output drained by the application through a 0 dB pcm-gain */
+    for (k = 0; k < ports; k++)
+    {
+        TST_CHK_API_COMP_CREATE(p_adev, &p_out[k], "post-proc/pcm_gain", 0, 1, NULL, XAF_POST_PROC, "xaf_comp_create");
+        TST_CHK_API(pcm_gain_setup(p_out[k]), "pcm_gain_setup");
+        TST_CHK_API(xaf_connect(p_split, k + 1, p_out[k], 0, 4), "xaf_connect");
+        TST_CHK_API(split_comp_start(p_adev, p_out[k]), "split_comp_start");
+        TST_CHK_API(xaf_comp_process(p_adev, p_out[k], NULL, 0, XAF_EXEC_FLAG), "xaf_comp_process");
+        received[k] = 0;
+    }
+
+    TST_CHK_API(xaf_comp_process(p_adev, p_in, NULL, 0, XAF_EXEC_FLAG), "xaf_comp_process");
+
+    /* ...prime both input buffers; the pcm-gain asks for more only after consuming one */
+    for (i = 0; i < 2 && fed < frames; i++)
+    {
+        split_fill(inbuf[i], fed++);
+        TST_CHK_API(xaf_comp_process(p_adev, p_in, inbuf[i], SPLIT_FRAME_BYTES, XAF_INPUT_READY_FLAG), "xaf_comp_process");
+    }
+
+    for (done = 0; done < ports + 1; )
+    {
+        TST_CHK_API(xaf_comp_wait_any(p_adev, &p_ready), "xaf_comp_wait_any");
+
+        /* ...response is already delivered, so this does not block */
+        TST_CHK_API(xaf_comp_get_status(p_adev, p_ready, &status, &info[0]), "xaf_comp_get_status");
+
+        if (status == XAF_EXEC_DONE)
+        {
+            done++;
+            continue;
+        }
+
+        for (k = 0; k < ports; k++)
+        {
+            if (p_out[k] == p_ready) break;
+        }
+
+        if (p_ready == p_in && status == XAF_NEED_INPUT)
+        {
+            if (fed < frames)
+            {
+                split_fill((void *)info[0], fed++);
+                TST_CHK_API(xaf_comp_process(p_adev, p_in, (void *)info[0], SPLIT_FRAME_BYTES, XAF_INPUT_READY_FLAG), "xaf_comp_process");
+            }
+            else if (fed++ == frames)
+            {
+                TST_CHK_API(xaf_comp_process(p_adev, p_in, NULL, 0, XAF_INPUT_OVER_FLAG), "xaf_comp_process");
+            }
+        }
+        else if (k < ports && status == XAF_OUTPUT_READY)
+        {
+            short *p = (short *)info[0];
+            int n = received[k] / 2;
+
+            for (i = 0; i < info[1] / 2; i++)
+            {
+                if (p[i] != split_sample(n + i))
+                {
+                    FIO_PRINTF(stderr, "%s output %d: sample %d is %d, expected %d\n", split_graphs[g].id, k, n + i, p[i], split_sample(n + i));
+                    errors++;
+                    break;
+                }
+            }
+            received[k] += info[1];
+
+            TST_CHK_API(xaf_comp_process(p_adev, p_ready, (void *)info[0], info[1], XAF_NEED_OUTPUT_FLAG), "xaf_comp_process");
+        }
+        else
+        {
+            FIO_PRINTF(stderr, "Unexpected status:%d\n", status);
+            exit(-1);
+        }
+    }
+
+    for (k = 0; k < ports; k++)
+    {
+        if (received[k] != frames * SPLIT_FRAME_BYTES)
+        {
+            FIO_PRINTF(stderr, "%s output %d: %d bytes, expected %d\n", split_graphs[g].id, k, received[k], frames * SPLIT_FRAME_BYTES);
+            errors++;
+        }
+    }
+
+    FIO_PRINTF(stdout, "%s: %d outputs, %d bytes each, %d errors\n", split_graphs[g].id, ports, received[0], errors);
+
+    for (k = ports - 1; k >= 0; k--)
+    {
+        TST_CHK_API(xaf_comp_delete(p_out[k]), "xaf_comp_delete");
+    }
+    TST_CHK_API(xaf_comp_delete(p_split), "xaf_comp_delete");
+    TST_CHK_API(xaf_comp_delete(p_in), "xaf_comp_delete");
+
+    return errors;
+}
+
+void fio_quit()
+{
+    return;
+}
+
+int main_task(int argc, char **argv)
+{
+    void *p_adev = NULL;
+    pUWORD8 ver_info[3] = {0,0,0};    //{ver,lib_rev,api_rev}
+    unsigned short board_id = 0;
+    mem_obj_t* mem_handle;
+    xaf_adev_config_t adev_config;
+    int frames = SPLIT_FRAMES;
+    int errors = 0, ret;
+    int g;
+
+    audio_frmwk_buf_size = AUDIO_FRMWK_BUF_SIZE;
+    audio_comp_buf_size = AUDIO_COMP_BUF_SIZE;
+
+    // NOTE: set_wbna() should be called before any other dynamic
+    // adjustment of the region attributes for cache.
+    set_wbna(&argc, argv);
+
+    /* ...start xos */
+    board_id = start_rtos();
+
+    /* ...get xaf version info*/
+    TST_CHK_API(xaf_get_verinfo(ver_info), "xaf_get_verinfo");
+
+    /* ...show xaf version info*/
+    TST_CHK_API(print_verinfo(ver_info,(pUWORD8)"\'PCM Split\'"), "print_verinfo");
+
+    /* ...initialize tracing facility */
+    TRACE_INIT("Xtensa Audio Framework - \'PCM Split\' Sample App");
+
+    /* ...check input arguments */
+    if (argc > 2)
+    {
+        PRINT_USAGE;
+        return 0;
+    }
+
+    if (argc == 2)
+    {
+        if (NULL != strstr(argv[1], "-frames:"))
+        {
+            frames = atoi((char *)&(argv[1][8]));
+        }
+        else
+        {
+            PRINT_USAGE;
+            return 0;
+        }
+    }
+
+    if (frames <= 0)
+    {
+        PRINT_USAGE;
+        return 0;
+    }
+
+    mem_handle = mem_init();
+
+    TST_CHK_API(xaf_adev_config_default_init(&adev_config), "xaf_adev_config_default_init");
+
+    adev_config.pmem_malloc = mem_malloc;
+    adev_config.pmem_free = mem_free;
+    adev_config.audio_framework_buffer_size = audio_frmwk_buf_size;
+    adev_config.audio_component_buffer_size = audio_comp_buf_size;
+    TST_CHK_API(xaf_adev_open(&p_adev, &adev_config), "xaf_adev_open");
+    FIO_PRINTF(stdout,"Audio Device Ready\n");
+
+    for (g = 0; g < (int)(sizeof(split_graphs) / sizeof(split_graphs[0])); g++)
+    {
+        ret = split_run(p_adev, g, frames);
+        if (ret < 0)
+        {
+            return ret;
+        }
+        errors += ret;
+    }
+
+    TST_CHK_API(xaf_adev_close(p_adev, XAF_ADEV_NORMAL_CLOSE), "xaf_adev_close");
+    FIO_PRINTF(stdout,"Audio device closed\n\n");
+
+    (void)board_id;
+    (void)mem_handle;
+    mem_exit();
+
+    /* ...deinitialize tracing facility */
+    TRACE_DEINIT();
+
+    if (errors)
+    {
+        FIO_PRINTF(stderr, "PCM split FAILED: %d errors\n", errors);
+        return -1;
+    }
+
+    FIO_PRINTF(stdout, "PCM split PASSED\n");
+
+    return 0;
+}
@@ -32,7 +32,7 @@
 #include "xaf-utils-test.h"
 #include "xaf-fio-test.h"
 
-#define PRINT_USAGE FIO_PRINTF(stdout, "\nUsage: %s  infile:PD_image.raw -outfile:dummy_out.pcm -samples:<samples-per-channel to be captured(zero for endless capturing)>\n", argv[0]);\
+#define PRINT_USAGE FIO_PRINTF(stdout, "\nUsage: %s  infile:PD_image.raw -outfile:dummy_out.pcm -samples:<samples-per-channel to be captured(zero for endless capturing)> [-shared_arena]\n", argv[0]);\
     FIO_PRINTF(stdout, "\nNote: Microspeech works with capturer-plugin which expects input file named 'capturer_in.pcm' to be present in the execution directory.\n\n");
 
 #define AUDIO_FRMWK_BUF_SIZE   (256 << 10)
@@ -60,6 +60,11 @@
 #define THREAD1_SCRATCH_SIZE         (1024)
 #define THREAD2_SCRATCH_SIZE         (1024)
 
+/* ...with -shared_arena both inference components run on one worker and their arenas live in its scratch;
+ * priority 0 selects worker 1 (the same as the microspeech components), sized for the larger arena (person detect) */
+#define SHARED_ARENA_PRIORITY        (0)
+#define SHARED_ARENA_SCRATCH_SIZE    (136*1024)
+
 unsigned int num_bytes_read, num_bytes_write;
 extern int audio_frmwk_buf_size;
 extern int audio_comp_buf_size;
@@ -78,6 +83,7 @@ XA_ERRORCODE xa_aac_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pV
 XA_ERRORCODE xa_mixer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
 XA_ERRORCODE xa_mp3_encoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
 XA_ERRORCODE xa_src_pp_fx(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_src_poly(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
 XA_ERRORCODE xa_renderer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
 XA_ERRORCODE xa_amr_wb_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
 XA_ERRORCODE xa_hotword_decoder(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value){return 0;}
@@ -85,6 +91,8 @@ XA_ERRORCODE xa_vorbis_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3,
 XA_ERRORCODE xa_dummy_aec22(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
 XA_ERRORCODE xa_dummy_aec23(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
 XA_ERRORCODE xa_pcm_split(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_pcm_split14(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_pcm_split18(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
 XA_ERRORCODE xa_mimo_mix(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
 XA_ERRORCODE xa_dummy_wwd(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
 XA_ERRORCODE xa_dummy_hbuf(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
@@ -144,7 +152,7 @@ static int microspeech_fe_setup(void *p_comp,xaf_format_t comp_format)
     return(xaf_comp_set_config(p_comp, ARRAY_SIZE(param), param[0]));
 }
 
-static int microspeech_inference_setup(void *p_comp,xaf_format_t comp_format)
+static int microspeech_inference_setup(void *p_comp,xaf_format_t comp_format, int shared_arena)
 {
     int param[][2] = {
         {
@@ -156,28 +164,35 @@ static int microspeech_inference_setup(void *p_comp,xaf_format_t comp_format)
         }, {
             XA_MICROSPEECH_INFERENCE_CONFIG_PARAM_PCM_WIDTH,
             comp_format.pcm_width,
+        }, {
+            XA_MICROSPEECH_INFERENCE_CONFIG_PARAM_SHARED_ARENA,
+            shared_arena,
         }, {
             XAF_COMP_CONFIG_PARAM_PRIORITY,
-            0,
+            SHARED_ARENA_PRIORITY,
         },
     };
 
     return(xaf_comp_set_config(p_comp, ARRAY_SIZE(param), param[0]));
 }
 
-static int person_detect_setup(void *p_comp,xaf_format_t comp_format)
+static int person_detect_setup(void *p_comp,xaf_format_t comp_format, int shared_arena)
 {
     int param[][2] = {
         {
             XA_PERSON_DETECT_INFERENCE_CONFIG_PARAM_PCM_WIDTH,
             comp_format.pcm_width,
-        /*}, {
+        }, {
+            XA_PERSON_DETECT_INFERENCE_CONFIG_PARAM_SHARED_ARENA,
+            shared_arena,
+        }, {
             XAF_COMP_CONFIG_PARAM_PRIORITY,
-            0,*/
+            SHARED_ARENA_PRIORITY,
         },
     };
 
-    return(xaf_comp_set_config(p_comp, ARRAY_SIZE(param), param[0]));
+    /* ...person detect stays on the default worker unless it shares the arena with microspeech inference */
+    return(xaf_comp_set_config(p_comp, ARRAY_SIZE(param) - (shared_arena ? 0 : 1), param[0]));
 }
 
 static int capturer_start_operation(void *p_capturer)
@@ -241,6 +256,20 @@ static int capturer_get_config(void *p_comp, xaf_format_t *comp_format)
     return 0;
 }
 
+static void inference_print_mem(void *p_comp, const char *name)
+{
+    int param[6];
+
+    param[0] = XAF_COMP_CONFIG_PARAM_MEM_CURR_PERSIST;
+    param[2] = XAF_COMP_CONFIG_PARAM_MEM_CURR_SCRATCH;
+    param[4] = XA_INFERENCE_CONFIG_PARAM_BYTES_COPIED;
+
+    if (xaf_comp_get_config(p_comp, 3, &param[0]) < 0)
+        return;
+
+    FIO_PRINTF(stderr,"%-21s persist %8d scratch %8d copied/inference %8d bytes\n", name, param[1], param[3], param[5]);
+}
+
 void fio_quit()
 {
     return;
@@ -296,6 +325,7 @@ int main_task(int argc, char **argv)
     int dsp_comp0_scratch_size;
     int dsp_comp1_scratch_size;
     int dsp_comp2_scratch_size;
+    int shared_arena = 0;
 
 #ifdef XAF_PROFILE
     frmwk_cycles = 0;
@@ -339,6 +369,14 @@ int main_task(int argc, char **argv)
     /* ...initialize tracing facility */
     TRACE_INIT("Xtensa Audio Framework - \'Person detect and microspeech  \' Sample App");
 
+    /* ...optional: share one tensor arena between the inference components */
+    if (argc == 5 && !strcmp(argv[4], "-shared_arena"))
+    {
+        shared_arena = 1;
+        dsp_comp1_scratch_size = SHARED_ARENA_SCRATCH_SIZE;
+        argc--;
+    }
+
     /* ...check input arguments */
     if (argc != 4)
     {
@@ -446,7 +484,7 @@ int main_task(int argc, char **argv)
 
     person_detect_format.pcm_width = PERSON_DETECT_SAMPLE_WIDTH;
     TST_CHK_API_COMP_CREATE(p_adev, &p_person_detect, "post-proc/person_detect_inference", 1, 1, &inp_buff, XAF_POST_PROC, "xaf_comp_create");
-    TST_CHK_API(person_detect_setup(p_person_detect, person_detect_format), "person_detect_setup");
+    TST_CHK_API(person_detect_setup(p_person_detect, person_detect_format, shared_arena), "person_detect_setup");
 
      /* ...create micro speech component */
     microspeech_fe_format.sample_rate = MICROSPEECH_FE_SAMPLE_RATE;
@@ -459,7 +497,7 @@ int main_task(int argc, char **argv)
     inference_format.channels = INFERENCE_NUM_CH;
     inference_format.pcm_width = INFERENCE_SAMPLE_WIDTH;
     TST_CHK_API_COMP_CREATE(p_adev, &p_inference, "post-proc/microspeech_inference", 0, 1, NULL, XAF_POST_PROC, "xaf_comp_create");
-    TST_CHK_API(microspeech_inference_setup(p_inference,inference_format), "microspeech_inference_setup");
+    TST_CHK_API(microspeech_inference_setup(p_inference,inference_format, shared_arena), "microspeech_inference_setup");
 
     /* ...start capturer component */
     TST_CHK_API(xaf_comp_process(p_adev, p_capturer, NULL, 0, XAF_START_FLAG),"xaf_comp_process");
@@ -586,6 +624,9 @@ int main_task(int argc, char **argv)
             FIO_PRINTF(stderr,"Shared Memory used by Components and Framework, in bytes : %8d of %8d\n", meminfo[1], adev_config.audio_framework_buffer_size);
             FIO_PRINTF(stderr,"Local Memory used by Framework, in bytes                 : %8d\n", meminfo[2]);
         }
+
+        inference_print_mem(p_person_detect, "person_detect:");
+        inference_print_mem(p_inference, "microspeech_inference:");
     }
     /* ...exec done, clean-up */
     TST_CHK_API(xaf_comp_delete(p_inference), "xaf_comp_delete");
@@ -126,6 +126,7 @@ int num_connect_bufs = NUM_CONNECT_BUFS;
 //XA_ERRORCODE xa_mixer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
 XA_ERRORCODE xa_mp3_encoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4) { return 0; }
 //XA_ERRORCODE xa_src_pp_fx(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_src_poly(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
 XA_ERRORCODE xa_renderer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4) { return 0; }
 XA_ERRORCODE xa_capturer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4) { return 0; }
 XA_ERRORCODE xa_amr_wb_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4) { return 0; }
@@ -135,6 +136,8 @@ XA_ERRORCODE xa_vorbis_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3,
 XA_ERRORCODE xa_dummy_aec22(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4) { return 0; }
 XA_ERRORCODE xa_dummy_aec23(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4) { return 0; }
 //XA_ERRORCODE xa_pcm_split(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+//XA_ERRORCODE xa_pcm_split14(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+//XA_ERRORCODE xa_pcm_split18(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
 XA_ERRORCODE xa_mimo_mix(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4) { return 0; }
 XA_ERRORCODE xa_dummy_wwd(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4) { return 0; }
 XA_ERRORCODE xa_dummy_hbuf(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4) { return 0; }
@@ -819,9 +822,9 @@ int main_task(int argc, char **argv)
                 FILE *fp;
                 char probefname[64];
                 port_num = atoi(token);
-                if ((port_num < 0) || (port_num > 7))
+                if ((port_num < 0) || (port_num > XA_MIXER_MAX_TRACK_NUMBER))
                 {
-                    fprintf(stderr, "Invalid port number %d. Allowed range: 0-7\n", port_num);
+                    fprintf(stderr, "Invalid port number %d. Allowed range: 0-%d\n", port_num, XA_MIXER_MAX_TRACK_NUMBER);
                     return -1;
                 }
                 sprintf(probefname, "comp%d_port%d.bin", cid, port_num);
@@ -1061,7 +1064,7 @@ int main_task(int argc, char **argv)
     TST_CHK_API(xaf_comp_process(p_adev, p_comp[XA_MIXER0], NULL, 0, XAF_START_FLAG), "xaf_comp_process");
     TST_CHK_API(xaf_comp_get_status(p_adev, p_comp[XA_MIXER0], &comp_status, &dec_info[0]), "xaf_comp_get_status");
 
-    TST_CHK_API(xaf_connect(p_comp[XA_MIXER0], 4, p_comp[XA_MIMO12_0], 0, num_connect_bufs), "xaf_connect"); 
+    TST_CHK_API(xaf_connect(p_comp[XA_MIXER0], XA_MIXER_MAX_TRACK_NUMBER, p_comp[XA_MIMO12_0], 0, num_connect_bufs), "xaf_connect"); 
     TST_CHK_API(xaf_comp_process(p_adev, p_comp[XA_MIMO12_0], NULL, 0, XAF_START_FLAG), "xaf_comp_process");
     TST_CHK_API(xaf_comp_get_status(p_adev, p_comp[XA_MIMO12_0], &comp_status, &dec_info[0]), "xaf_comp_get_status");
 
@@ -0,0 +1,518 @@
+/*
+* Copyright (c) 2015-2022 Cadence Design Systems Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to deal in the Software without restriction, including
+* without limitation the rights to use, copy, modify, merge, publish,
+* distribute, sublicense, and/or sell copies of the Software, and to
+* permit persons to whom the Software is furnished to do so, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include "audio/xa-src-poly-api.h"
+#include "xaf-utils-test.h"
+#include "xaf-fio-test.h"
+
+/* functional test of the polyphase sample-rate converter running as a framework component: a stereo
+ * tone is converted for a set of rate pairs at every quality level, and the output length has to
+ * follow the rate ratio and the output tone has to keep its frequency; then a half-gain coefficient
+ * table spanning several messages is streamed in chunks and a constant input has to come out halved */
+
+#define PRINT_USAGE FIO_PRINTF(stdout, "\nUsage: %s [optional -frames:N (default %d)]\n\n", argv[0], SRC_FRAMES);
+
+#define AUDIO_FRMWK_BUF_SIZE   (256 << 8)
+#define AUDIO_COMP_BUF_SIZE    (1024 << 7)
+#define NUM_COMP_IN_GRAPH       1
+
+//component parameters
+#define SRC_NUM_CH              2
+#define SRC_BYTES_PER_SAMPLE    2
+#define SRC_CHUNK_SIZE          (XAF_INBUF_SIZE / (SRC_NUM_CH * SRC_BYTES_PER_SAMPLE))
+
+#define SRC_FRAMES              32
+#define SRC_TONE_HZ             1000
+#define SRC_TONE_LEVEL          16384
+#define SRC_ALIAS_HZ            7000
+#define SRC_ALIAS_LEVEL         (SRC_TONE_LEVEL / 100)
+#define SRC_PI                  3.14159265358979323846
+
+/* ...streamed table: small chunks, so the table takes several messages */
+#define SRC_COEF_CHUNK          200
+#define SRC_COEF_HALF           8192
+
+unsigned int num_bytes_read, num_bytes_write;
+extern int audio_frmwk_buf_size;
+extern int audio_comp_buf_size;
+double strm_duration;
+
+#ifdef XAF_PROFILE
+    extern long long tot_cycles, frmwk_cycles, fread_cycles, fwrite_cycles;
+    extern long long dsp_comps_cycles, src_cycles;
+    extern double dsp_mcps;
+#endif
+
+/* Dummy unused functions */
+XA_ERRORCODE xa_mp3_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_aac_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_pcm_gain(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_mixer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_mp3_encoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_src_pp_fx(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_renderer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_capturer(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_amr_wb_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_hotword_decoder(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value){return 0;}
+XA_ERRORCODE xa_vorbis_decoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_dummy_aec22(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_dummy_aec23(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_pcm_split(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_pcm_split14(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_pcm_split18(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_mimo_mix(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_dummy_wwd(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_dummy_hbuf(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_opus_encoder(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_dummy_wwd_msg(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_dummy_hbuf_msg(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_opus_decoder(xa_codec_handle_t p_xa_module_obj, WORD32 i_cmd, WORD32 i_idx, pVOID pv_value) {return 0;}
+XA_ERRORCODE xa_microspeech_fe(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_microspeech_inference(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_person_detect_inference(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+XA_ERRORCODE xa_keyword_detection_inference(xa_codec_handle_t var1, WORD32 var2, WORD32 var3, pVOID var4){return 0;}
+
+/* ...rate pairs covering up-, down- and integer-ratio conversion */
+static const int src_rates[][2] = {
+    { 44100, 48000 },
+    { 48000, 16000 },
+    { 16000, 48000 },
+    {  8000, 44100 },
+    { 192000,  8000 },
+};
+
+/* ...filter length and number of phases of each quality level */
+static const int src_dims[XA_SRC_POLY_QUALITY_NUM][2] = {
+    [XA_SRC_POLY_QUALITY_LOW]       = {  8, 32 },
+    [XA_SRC_POLY_QUALITY_MEDIUM]    = { 16, 64 },
+    [XA_SRC_POLY_QUALITY_HIGH]      = { 32, 64 },
+};
+
+typedef struct src_tone_s
+{
+    double phase, step;                 /* input tone generator; zero step gives a constant */
+    long long pos, first, last;         /* output position and rising zero crossings */
+    long long start, end;               /* output is checked past the start-up and before the flushed tail */
+    int cycles, prev;
+    int min, max;                       /* output range within the checked part */
+    long long out_frames;
+} src_tone_t;
+
+/* ...cosine by Taylor series for |x| <= pi; keeps the test free of libm */
+static double src_cos(double x)
+{
+    double x2 = x * x, t = 1, s = 1;
+    int k;
+
+    for (k = 2; k <= 28; k += 2)
+    {
+        t *= -x2 / (double)((k - 1) * k);
+        s += t;
+    }
+
+    return s;
+}
+
+/* ...next input frame of a continuous-phase tone, same on both channels */
+static void src_fill(src_tone_t *t, void *p_buf)
+{
+    short *p = (short *)p_buf;
+    int i;
+
+    for (i = 0; i < SRC_CHUNK_SIZE; i++)
+    {
+        p[2 * i] = p[2 * i + 1] = (short)(SRC_TONE_LEVEL * src_cos(t->phase));
+        if ((t->phase += t->step) > SRC_PI)
+            t->phase -= 2 * SRC_PI;
+    }
+}
+
+/* ...count output frames, and rising zero crossings and range of the left channel between the filter start-up and the flush */
+static void src_scan(src_tone_t *t, void *p_buf, int length)
+{
+    short *p = (short *)p_buf;
+    int i;
+
+    for (i = 0; i < length / (SRC_NUM_CH * SRC_BYTES_PER_SAMPLE); i++, t->pos++)
+    {
+        if (t->pos >= t->start && t->pos < t->end)
+        {
+            if (t->prev < 0 && p[2 * i] >= 0)
+            {
+                if (t->first < 0)
+                    t->first = t->pos;
+                t->last = t->pos;
+                t->cycles++;
+            }
+
+            t->min = (p[2 * i] < t->min ? p[2 * i] : t->min);
+            t->max = (p[2 * i] > t->max ? p[2 * i] : t->max);
+        }
+        t->prev = p[2 * i];
+    }
+
+    t->out_frames = t->pos;
+}
+
+static int src_setup(void *p_comp, int in_fs, int out_fs, int quality)
+{
+    int param[12];
+
+    param[0] = XA_SRC_POLY_CONFIG_PARAM_INPUT_SAMPLE_RATE;
+    param[1] = in_fs;
+    param[2] = XA_SRC_POLY_CONFIG_PARAM_OUTPUT_SAMPLE_RATE;
+    param[3] = out_fs;
+    param[4] = XA_SRC_POLY_CONFIG_PARAM_INPUT_CHANNELS;
+    param[5] = SRC_NUM_CH;
+    param[6] = XA_SRC_POLY_CONFIG_PARAM_BYTES_PER_SAMPLE;
+    param[7] = SRC_BYTES_PER_SAMPLE;
+    param[8] = XA_SRC_POLY_CONFIG_PARAM_INPUT_CHUNK_SIZE;
+    param[9] = SRC_CHUNK_SIZE;
+    param[10] = XA_SRC_POLY_CONFIG_PARAM_QUALITY;
+    param[11] = quality;
+
+    return(xaf_comp_set_config(p_comp, 6, &param[0]));
+}
+
+static void src_tone_init(src_tone_t *t, int in_fs, int out_fs, int taps, int tone_hz, int frames)
+{
+    memset(t, 0, sizeof(*t));
+    t->step = 2 * SRC_PI * tone_hz / in_fs;
+    t->first = t->last = -1;
+    t->start = (long long)taps * out_fs / in_fs + 1;
+    t->end = ((long long)frames * SRC_CHUNK_SIZE - taps) * out_fs / in_fs;
+    t->min = 32767;
+    t->max = -32768;
+}
+
+/* ...create, configure and start a component; it runs the designed filter */
+static int src_create(void *p_adev, void **pp_src, void *inbuf[2], int in_fs, int out_fs, int quality)
+{
+    xaf_comp_status status;
+    int info[4];
+
+    TST_CHK_API_COMP_CREATE(p_adev, pp_src, "post-proc/src-poly", 2, 1, &inbuf[0], XAF_POST_PROC, "xaf_comp_create");
+    TST_CHK_API(src_setup(*pp_src, in_fs, out_fs, quality), "src_setup");
+    TST_CHK_API(xaf_comp_process(p_adev, *pp_src, NULL, 0, XAF_START_FLAG), "xaf_comp_process");
+    TST_CHK_API(xaf_comp_get_status(p_adev, *pp_src, &status, &info[0]), "xaf_comp_get_status");
+
+    if (status != XAF_INIT_DONE)
+    {
+        FIO_PRINTF(stderr, "Failed to init, status:%d\n", status);
+        return -1;
+    }
+
+    return 0;
+}
+
+/* ...stream the given number of input frames through a started component up to the end of stream, then delete it */
+static int src_convert(void *p_adev, void *p_src, void *inbuf[2], src_tone_t *t, int frames)
+{
+    xaf_comp_status status;
+    int info[4];
+    int fed = 0, done = 0, i;
+
+    TST_CHK_API(xaf_comp_process(p_adev, p_src, NULL, 0, XAF_EXEC_FLAG), "xaf_comp_process");
+
+    /* ...prime both input buffers */
+    for (i = 0; i < 2; i++)
+    {
+        src_fill(t, inbuf[i]);
+        TST_CHK_API(xaf_comp_process(p_adev, p_src, inbuf[i], XAF_INBUF_SIZE, XAF_INPUT_READY_FLAG), "xaf_comp_process");
+        fed++;
+    }
+
+    while (!done)
+    {
+        TST_CHK_API(xaf_comp_get_status(p_adev, p_src, &status, &info[0]), "xaf_comp_get_status");
+
+        switch (status)
+        {
+        case XAF_OUTPUT_READY:
+            src_scan(t, (void *)info[0], info[1]);
+            TST_CHK_API(xaf_comp_process(p_adev, p_src, (void *)info[0], info[1], XAF_NEED_OUTPUT_FLAG), "xaf_comp_process");
+            break;
+
+        case XAF_NEED_INPUT:
+            if (fed < frames)
+            {
+                src_fill(t, (void *)info[0]);
+                TST_CHK_API(xaf_comp_process(p_adev, p_src, (void *)info[0], XAF_INBUF_SIZE, XAF_INPUT_READY_FLAG), "xaf_comp_process");
+                fed++;
+            }
+            else if (fed++ == frames)
+            {
+                TST_CHK_API(xaf_comp_process(p_adev, p_src, NULL, 0, XAF_INPUT_OVER_FLAG), "xaf_comp_process");
+            }
+            break;
+
+        case XAF_EXEC_DONE:
+            done = 1;
+            break;
+
+        default:
+            FIO_PRINTF(stderr, "Unexpected status:%d\n", status);
+            return -1;
+        }
+    }
+
+    TST_CHK_API(xaf_comp_delete(p_src), "xaf_comp_delete");
+
+    return 0;
+}
+
+/* ...convert a tone of given length through a fresh component and check the result */
+static int src_run(void *p_adev, int in_fs, int out_fs, int quality, int frames)
+{
+    static const char *name[XA_SRC_POLY_QUALITY_NUM] = {"low", "medium", "high"};
+    int taps = XA_SRC_POLY_TAPS(src_dims[quality][0], in_fs, out_fs);
+    void *p_src;
+    void *inbuf[2];
+    src_tone_t tone;
+    long long expected, slack;
+    double freq;
+
+    src_tone_init(&tone, in_fs, out_fs, taps, SRC_TONE_HZ, frames);
+
+    TST_CHK_API(src_create(p_adev, &p_src, inbuf, in_fs, out_fs, quality), "src_create");
+    TST_CHK_API(src_convert(p_adev, p_src, inbuf, &tone, frames), "src_convert");
+
+    /* ...end of stream flushes half a filter of delay line on top of the converted input */
+    expected = (long long)frames * SRC_CHUNK_SIZE * out_fs / in_fs;
+    slack = (long long)(taps / 2 + 1) * out_fs / in_fs + 2;
+    freq = (tone.cycles > 1 ? (double)(tone.cycles - 1) * out_fs / (tone.last - tone.first) : 0);
+
+    FIO_PRINTF(stdout, "%-6s %6d -> %6d: %3d taps, %lld frames (expected %lld), tone %.1f Hz\n", name[quality], in_fs, out_fs, taps, tone.out_frames, expected, freq);
+
+    if (tone.out_frames < expected - 1 || tone.out_frames > expected + slack)
+    {
+        FIO_PRINTF(stderr, "Output length %lld out of range [%lld, %lld]\n", tone.out_frames, expected - 1, expected + slack);
+        return -1;
+    }
+
+    if (freq < SRC_TONE_HZ * 0.995 || freq > SRC_TONE_HZ * 1.005)
+    {
+        FIO_PRINTF(stderr, "Output tone %.1f Hz, expected %d Hz\n", freq, SRC_TONE_HZ);
+        return -1;
+    }
+
+    return 0;
+}
+
+/* ...stream a table of given dimensions where every phase is a two-tap average scaled by 1/2 */
+static int src_load_half(void *p_src, int taps, int phases)
+{
+    xaf_ext_buffer_t blob;
+    short *coef;
+    int p, ret;
+
+    TST_CHK_PTR((coef = calloc((phases + 1) * taps, sizeof(short))), "calloc");
+
+    for (p = 0; p <= phases; p++)
+    {
+        coef[p * taps + taps / 2 - 1] = coef[p * taps + taps / 2] = SRC_COEF_HALF;
+    }
+
+    memset(&blob, 0, sizeof(blob));
+    blob.max_data_size = blob.valid_data_size = XA_SRC_POLY_COEF_SIZE(taps, phases);
+    blob.data = (UWORD8 *)coef;
+
+    ret = xaf_comp_set_config_stream(p_src, XA_SRC_POLY_CONFIG_PARAM_COEF, &blob, SRC_COEF_CHUNK);
+
+    free(coef);
+
+    return ret;
+}
+
+/* ...replace the filter by a streamed half-gain table; a constant input has to come out exactly halved */
+static int src_coef_run(void *p_adev, int in_fs, int out_fs, int quality, int frames)
+{
+    int taps = XA_SRC_POLY_TAPS(src_dims[quality][0], in_fs, out_fs), phases = src_dims[quality][1];
+    void *p_src;
+    void *inbuf[2];
+    src_tone_t dc;
+
+    src_tone_init(&dc, in_fs, out_fs, taps, 0, frames);
+
+    TST_CHK_API(src_create(p_adev, &p_src, inbuf, in_fs, out_fs, quality), "src_create");
+
+    /* ...table of other dimensions is rejected and leaves the filter in place */
+    if (src_load_half(p_src, taps + 4, phases) == XAF_NO_ERR)
+    {
+        FIO_PRINTF(stderr, "Coefficient table of wrong size accepted\n");
+        return -1;
+    }
+
+    TST_CHK_API(src_load_half(p_src, taps, phases), "src_load_half");
+    TST_CHK_API(src_convert(p_adev, p_src, inbuf, &dc, frames), "src_convert");
+
+    FIO_PRINTF(stdout, "coef   %6d -> %6d: %d-byte table in %d-byte chunks, output %d..%d\n", in_fs, out_fs, (int)XA_SRC_POLY_COEF_SIZE(taps, phases), SRC_COEF_CHUNK, dc.min, dc.max);
+
+    if (dc.min != SRC_TONE_LEVEL / 2 || dc.max != SRC_TONE_LEVEL / 2)
+    {
+        FIO_PRINTF(stderr, "Output range %d..%d, expected %d\n", dc.min, dc.max, SRC_TONE_LEVEL / 2);
+        return -1;
+    }
+
+    return 0;
+}
+
+/* ...down-convert a tone above the output Nyquist frequency; the filter has to keep its alias out of the output */
+static int src_alias_run(void *p_adev, int in_fs, int out_fs, int quality, int frames)
+{
+    static const char *name[XA_SRC_POLY_QUALITY_NUM] = {"low", "medium", "high"};
+    int taps = XA_SRC_POLY_TAPS(src_dims[quality][0], in_fs, out_fs);
+    void *p_src;
+    void *inbuf[2];
+    src_tone_t tone;
+
+    src_tone_init(&tone, in_fs, out_fs, taps, SRC_ALIAS_HZ, frames);
+
+    TST_CHK_API(src_create(p_adev, &p_src, inbuf, in_fs, out_fs, quality), "src_create");
+    TST_CHK_API(src_convert(p_adev, p_src, inbuf, &tone, frames), "src_convert");
+
+    FIO_PRINTF(stdout, "alias  %-6s %6d -> %6d: %3d taps, %d Hz tone, output %d..%d\n", name[quality], in_fs, out_fs, taps, SRC_ALIAS_HZ, tone.min, tone.max);
+
+    if (tone.min < -SRC_ALIAS_LEVEL || tone.max > SRC_ALIAS_LEVEL)
+    {
+        FIO_PRINTF(stderr, "Alias range %d..%d, expected within +/-%d\n", tone.min, tone.max, SRC_ALIAS_LEVEL);
+        return -1;
+    }
+
+    return 0;
+}
+
+void fio_quit()
+{
+    return;
+}
+
+int main_task(int argc, char **argv)
+{
+    void *p_adev = NULL;
+    pUWORD8 ver_info[3] = {0,0,0};    //{ver,lib_rev,api_rev}
+    unsigned short board_id = 0;
+    mem_obj_t* mem_handle;
+    xaf_adev_config_t adev_config;
+    int frames = SRC_FRAMES;
+    int failed = 0, runs = 0;
+    int i, q;
+
+    audio_frmwk_buf_size = AUDIO_FRMWK_BUF_SIZE;
+    audio_comp_buf_size = AUDIO_COMP_BUF_SIZE;
+
+    // NOTE: set_wbna() should be called before any other dynamic
+    // adjustment of the region attributes for cache.
+    set_wbna(&argc, argv);
+
+    /* ...start xos */
+    board_id = start_rtos();
+
+    /* ...get xaf version info*/
+    TST_CHK_API(xaf_get_verinfo(ver_info), "xaf_get_verinfo");
+
+    /* ...show xaf version info*/
+    TST_CHK_API(print_verinfo(ver_info,(pUWORD8)"\'SRC Poly\'"), "print_verinfo");
+
+    /* ...initialize tracing facility */
+    TRACE_INIT("Xtensa Audio Framework - \'SRC Poly\' Sample App");
+
+    /* ...check input arguments */
+    if (argc > 2)
+    {
+        PRINT_USAGE;
+        return 0;
+    }
+
+    if (argc == 2)
+    {
+        if (NULL != strstr(argv[1], "-frames:"))
+        {
+            frames = atoi((char *)&(argv[1][8]));
+        }
+        else
+        {
+            PRINT_USAGE;
+            return 0;
+        }
+    }
+
+    if (frames < 4)
+    {
+        FIO_PRINTF(stderr, "Number of frames must be at least 4\n");
+        exit(-1);
+    }
+
+    mem_handle = mem_init();
+
+    TST_CHK_API(xaf_adev_config_default_init(&adev_config), "xaf_adev_config_default_init");
+
+    adev_config.pmem_malloc = mem_malloc;
+    adev_config.pmem_free = mem_free;
+    adev_config.audio_framework_buffer_size = audio_frmwk_buf_size;
+    adev_config.audio_component_buffer_size = audio_comp_buf_size;
+    TST_CHK_API(xaf_adev_open(&p_adev, &adev_config), "xaf_adev_open");
+    FIO_PRINTF(stdout,"Audio Device Ready\n");
+
+    for (i = 0; i < (int)(sizeof(src_rates) / sizeof(src_rates[0])); i++)
+    {
+        for (q = 0; q < XA_SRC_POLY_QUALITY_NUM; q++, runs++)
+        {
+            failed += (src_run(p_adev, src_rates[i][0], src_rates[i][1], q, frames) != 0);
+        }
+    }
+
+    for (q = 0; q < XA_SRC_POLY_QUALITY_NUM; q++, runs++)
+    {
+        failed += (src_coef_run(p_adev, src_rates[q][0], src_rates[q][1], q, frames) != 0);
+    }
+
+    for (q = 0; q < XA_SRC_POLY_QUALITY_NUM; q++, runs++)
+    {
+        failed += (src_alias_run(p_adev, 192000, 8000, q, frames) != 0);
+    }
+
+    TST_CHK_API(xaf_adev_close(p_adev, XAF_ADEV_NORMAL_CLOSE), "xaf_adev_close");
+    FIO_PRINTF(stdout,"Audio device closed\n\n");
+
+    mem_exit();
+
+    TST_CHK_API(print_mem_mcps_info(mem_handle, NUM_COMP_IN_GRAPH), "print_mem_mcps_info");
+
+    /* ...deinitialize tracing facility */
+    TRACE_DEINIT();
+
+    if (failed)
+    {
+        FIO_PRINTF(stderr, "SRC poly FAILED: %d of %d conversions\n", failed, runs);
+        return -1;
+    }
+
+    FIO_PRINTF(stdout, "SRC poly PASSED: %d conversions\n", runs);
+
+    return 0;
+}